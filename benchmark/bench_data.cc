@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "benchmark/bench_data.h"
+
+#include <rapidjson/document.h>
+
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+#include "modules/devapi/base_constants.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace bench {
+
+using mysqlshdk::db::Column;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+namespace {
+
+// Mutable_row has no setter for BIT values, they are stored as integers
+Type storage_type(Type type) {
+  return type == Type::Bit ? Type::UInteger : type;
+}
+
+std::string get_string(const rapidjson::Value &value) {
+  return value.IsString()
+             ? std::string(value.GetString(), value.GetStringLength())
+             : std::string();
+}
+
+void set_field(const rapidjson::Value &value, uint32_t index,
+               Mutable_row *row) {
+  if (value.IsNull()) {
+    row->set_field(index, nullptr);
+  } else if (value.IsString()) {
+    row->set_field(index, get_string(value));
+  } else {
+    switch (row->get_type(index)) {
+      case Type::Integer:
+        row->set_field(index, value.GetInt64());
+        break;
+      case Type::UInteger:
+        row->set_field(index, value.GetUint64());
+        break;
+      case Type::Float:
+      case Type::Double:
+        row->set_field(index, value.GetDouble());
+        break;
+      default:
+        row->set_field(index, nullptr);
+        break;
+    }
+  }
+}
+
+Result_data load_result(const rapidjson::Value &entry) {
+  Result_data result;
+  std::vector<Type> types;
+
+  for (const auto &column : entry["columns"].GetArray()) {
+    result.columns.emplace_back(
+        get_string(column["schema"]), get_string(column["table_name"]),
+        get_string(column["table_label"]), get_string(column["column_name"]),
+        get_string(column["column_label"]), column["length"].GetUint(),
+        column["fractional"].GetInt(),
+        mysqlshdk::db::string_to_type(get_string(column["type"])),
+        column["collation_id"].GetUint(), column["unsigned"].GetBool(),
+        column["zerofill"].GetBool(), column["binary"].GetBool());
+    types.push_back(storage_type(result.columns.back().get_type()));
+  }
+
+  for (const auto &fields : entry["rows"].GetArray()) {
+    Mutable_row row(types);
+
+    for (rapidjson::SizeType i = 0; i < fields.Size() && i < types.size();
+         ++i)
+      set_field(fields[i], i, &row);
+
+    result.rows.emplace_back(std::move(row));
+  }
+
+  return result;
+}
+
+void load_trace(const std::string &path, Trace_data *data) {
+  std::string text;
+  rapidjson::Document doc;
+
+  if (!shcore::load_text_file(path, text) ||
+      doc.Parse(text.c_str()).HasParseError() || !doc.IsArray()) {
+    std::cerr << "Skipping invalid trace file: " << path << "\n";
+    return;
+  }
+
+  // results are appended only once the whole trace is loaded
+  Trace_data trace;
+
+  try {
+    for (const auto &entry : doc.GetArray()) {
+      if (!entry.IsObject() || !entry.HasMember("subtype")) continue;
+
+      const auto subtype = get_string(entry["subtype"]);
+
+      if (subtype == "QUERY" && entry.HasMember("sql")) {
+        trace.sql.append(get_string(entry["sql"])).append(";\n");
+      } else if (subtype == "RESULT" && entry.HasMember("columns") &&
+                 entry.HasMember("rows") && !entry["rows"].Empty()) {
+        trace.results.emplace_back(load_result(entry));
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Skipping trace file " << path << ": " << e.what() << "\n";
+    return;
+  }
+
+  ++data->files;
+  data->sql.append(trace.sql);
+  std::move(trace.results.begin(), trace.results.end(),
+            std::back_inserter(data->results));
+}
+
+void find_traces(const std::string &folder, Trace_data *data) {
+  for (const auto &name : shcore::listdir(folder)) {
+    const auto path = shcore::path::join_path(folder, name);
+
+    if (shcore::is_folder(path))
+      find_traces(path, data);
+    else if (shcore::str_endswith(name, "_trace"))
+      load_trace(path, data);
+  }
+}
+
+}  // namespace
+
+const Trace_data &traces() {
+  static Trace_data data;
+  static bool loaded = false;
+
+  if (!loaded) {
+    loaded = true;
+    const auto &folder = options().traces_path;
+
+    if (!folder.empty() && shcore::is_folder(folder))
+      find_traces(folder, &data);
+  }
+
+  return data;
+}
+
+std::string data_file(const std::string &name) {
+  const auto path = shcore::path::join_path(options().data_path, name);
+  return shcore::is_file(path) ? path : std::string();
+}
+
+Result_data synthetic_result(size_t rows) {
+  static const char *const k_names[] = {
+      "Kraków", "Zürich", "São Paulo", "東京", "Reykjavík", "Łódź", "Oslo"};
+  constexpr size_t k_name_count = sizeof(k_names) / sizeof(k_names[0]);
+
+  Result_data result;
+  result.columns = {
+      Column("bench", "city", "city", "id", "id", 11, 0, Type::Integer, 63,
+             false, false, false),
+      Column("bench", "city", "city", "name", "name", 140, 0, Type::String,
+             255, false, false, false),
+      Column("bench", "city", "city", "area", "area", 22, 31, Type::Double,
+             63, false, false, false),
+      Column("bench", "city", "city", "note", "note", 1020, 0, Type::String,
+             255, false, false, false),
+      Column("bench", "city", "city", "updated", "updated", 19, 0,
+             Type::DateTime, 63, false, false, true)};
+
+  std::vector<Type> types;
+  for (const auto &column : result.columns) types.push_back(column.get_type());
+
+  for (size_t i = 0; i < rows; ++i) {
+    Mutable_row row(types);
+    const std::string name = k_names[i % k_name_count];
+
+    row.set_field(0, static_cast<int64_t>(i));
+    row.set_field(1, name + " " + std::to_string(i));
+    row.set_field(2, (i % 1000) * 1.25);
+
+    if (i % 3 == 0)
+      row.set_field(3, nullptr);
+    else
+      row.set_field(3, std::string(i % 50, 'x') + "\ttab\nnew line");
+
+    row.set_field(4, shcore::str_format("2018-%02zu-%02zu 12:%02zu:00",
+                                        i % 12 + 1, i % 28 + 1, i % 60));
+    result.rows.emplace_back(std::move(row));
+  }
+
+  return result;
+}
+
+std::string synthetic_sql(size_t statements) {
+  std::string sql;
+
+  for (size_t i = 0; i < statements; ++i) {
+    switch (i % 5) {
+      case 0:
+        sql += "CREATE TABLE IF NOT EXISTS `t" + std::to_string(i) +
+               "` (id INT PRIMARY KEY, name VARCHAR(64)) ENGINE=InnoDB;\n";
+        break;
+      case 1:
+        sql += "-- inserts a row; the delimiter in this comment is ignored\n"
+               "INSERT INTO t VALUES (" +
+               std::to_string(i) + ", 'it''s a \"quoted\" value; really');\n";
+        break;
+      case 2:
+        sql += "/* multi-line comment;\n   spanning lines */ "
+               "SELECT a, b FROM t WHERE c = ';' AND d = `e;f`;\n";
+        break;
+      case 3:
+        sql += "UPDATE t SET name = CONCAT(name, '\\';') WHERE id > " +
+               std::to_string(i) + ";\n";
+        break;
+      case 4:
+        sql += "delimiter $$\nCREATE PROCEDURE p" + std::to_string(i) +
+               "() BEGIN SELECT 1; SELECT 2; END$$\ndelimiter ;\n";
+        break;
+    }
+  }
+
+  return sql;
+}
+
+std::string synthetic_documents(size_t count) {
+  std::string documents;
+
+  for (size_t i = 0; i < count; ++i) {
+    documents += shcore::str_format(
+        "{\"_id\": \"%013zu\", \"name\": \"document \\\"%zu\\\"\", "
+        "\"tags\": [\"a\", \"b{\", \"c]\"], \"nested\": {\"level\": "
+        "{\"value\": %zu, \"ratio\": %zu.5}}, \"active\": %s}\n",
+        i, i, i * 7, i % 100, i % 2 ? "true" : "false");
+  }
+
+  return documents;
+}
+
+std::shared_ptr<mysqlsh::Column> make_column(const Column &column) {
+  std::string type_name;
+
+  switch (column.get_type()) {
+    case Type::Null:
+    case Type::String:
+      type_name = "STRING";
+      break;
+    case Type::Integer:
+    case Type::UInteger:
+      type_name = "INT";
+      break;
+    case Type::Float:
+      type_name = "FLOAT";
+      break;
+    case Type::Double:
+      type_name = "DOUBLE";
+      break;
+    case Type::Decimal:
+      type_name = "DECIMAL";
+      break;
+    case Type::Bytes:
+      type_name = "BYTES";
+      break;
+    case Type::Geometry:
+      type_name = "GEOMETRY";
+      break;
+    case Type::Json:
+      type_name = "JSON";
+      break;
+    case Type::DateTime:
+      type_name = "DATETIME";
+      break;
+    case Type::Date:
+      type_name = "DATE";
+      break;
+    case Type::Time:
+      type_name = "TIME";
+      break;
+    case Type::Bit:
+      type_name = "BIT";
+      break;
+    case Type::Enum:
+      type_name = "ENUM";
+      break;
+    case Type::Set:
+      type_name = "SET";
+      break;
+  }
+
+  return std::make_shared<mysqlsh::Column>(
+      column, mysqlsh::Constant::get_constant("mysqlx", "Type", type_name,
+                                              shcore::Argument_list()));
+}
+
+Temporary_file::Temporary_file(const std::string &name,
+                               const std::string &contents)
+    : m_path(name) {
+  if (!shcore::create_file(m_path, contents))
+    throw std::runtime_error("Unable to create '" + m_path +
+                             "': " + shcore::get_last_error());
+}
+
+Temporary_file::~Temporary_file() { shcore::delete_file(m_path); }
+
+}  // namespace bench
+}  // namespace mysqlsh
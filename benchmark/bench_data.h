@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef BENCHMARK_BENCH_DATA_H_
+#define BENCHMARK_BENCH_DATA_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/devapi/base_resultset.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlsh {
+namespace bench {
+
+/**
+ * Rows of a single result, either generated or taken from a replay trace.
+ */
+struct Result_data {
+  std::vector<mysqlshdk::db::Column> columns;
+  std::vector<mysqlshdk::db::Mutable_row> rows;
+};
+
+/**
+ * Everything the replay traces contain that can be used without a server.
+ */
+struct Trace_data {
+  size_t files = 0;
+  // All the recorded queries, each one terminated with a delimiter
+  std::string sql;
+  std::vector<Result_data> results;
+};
+
+/**
+ * Loads the traces found in the traces folder given in the options, they are
+ * loaded once and shared by all the benchmarks.
+ */
+const Trace_data &traces();
+
+/**
+ * Path to a file in the unit test data folder, empty if it does not exist.
+ */
+std::string data_file(const std::string &name);
+
+/**
+ * Result with the column types most often displayed in the shell, string
+ * values contain multi-byte characters.
+ */
+Result_data synthetic_result(size_t rows);
+
+/**
+ * SQL script with a mix of DDL, DML, comments and quoted delimiters.
+ */
+std::string synthetic_sql(size_t statements);
+
+/**
+ * Concatenated JSON documents, like the ones processed by util.importJson().
+ */
+std::string synthetic_documents(size_t count);
+
+/**
+ * DevAPI column of the given metadata, as created by the result objects.
+ */
+std::shared_ptr<mysqlsh::Column> make_column(
+    const mysqlshdk::db::Column &column);
+
+/**
+ * Writes the text to a file in the current folder, the file is removed when
+ * this object is destroyed.
+ */
+class Temporary_file {
+ public:
+  Temporary_file(const std::string &name, const std::string &contents);
+  Temporary_file(const Temporary_file &) = delete;
+  Temporary_file &operator=(const Temporary_file &) = delete;
+  ~Temporary_file();
+
+  const std::string &path() const { return m_path; }
+
+ private:
+  std::string m_path;
+};
+
+}  // namespace bench
+}  // namespace mysqlsh
+
+#endif  // BENCHMARK_BENCH_DATA_H_
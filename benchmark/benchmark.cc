@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+// Upper bound of the iterations of a single run, when estimating how many
+// iterations fit in the minimum time
+constexpr size_t k_max_iterations = 1000000000;
+
+volatile size_t g_sink = 0;
+
+Options g_options;
+
+std::vector<std::pair<std::string, Benchmark_function>> &registry() {
+  static std::vector<std::pair<std::string, Benchmark_function>> benchmarks;
+  return benchmarks;
+}
+
+struct Result {
+  std::string name;
+  size_t iterations = 0;
+  double ns_per_op = 0.0;
+  double bytes_per_second = 0.0;
+  double items_per_second = 0.0;
+};
+
+/**
+ * Runs the benchmark, increasing the number of iterations until the timed loop
+ * takes at least the configured minimum time.
+ */
+bool run_once(Benchmark_function function, Result *result,
+              std::string *skip_reason) {
+  const double min_time_ns = g_options.min_time * 1e9;
+  size_t iterations = 1;
+
+  while (true) {
+    State state(iterations);
+    function(&state);
+
+    if (state.skipped()) {
+      *skip_reason = state.skip_reason();
+      return false;
+    }
+
+    const double elapsed = std::max(state.elapsed_ns(), 1.0);
+
+    if (elapsed >= min_time_ns || iterations >= k_max_iterations) {
+      result->iterations = iterations;
+      result->ns_per_op = elapsed / iterations;
+      result->bytes_per_second =
+          state.bytes_per_iteration() * iterations * 1e9 / elapsed;
+      result->items_per_second =
+          state.items_per_iteration() * iterations * 1e9 / elapsed;
+      return true;
+    }
+
+    // aim a bit past the minimum time, but grow at most 10 times per step, the
+    // first iterations are usually slower (cold caches)
+    const double estimate = iterations * min_time_ns * 1.4 / elapsed;
+    iterations = static_cast<size_t>(
+        std::min(estimate, static_cast<double>(iterations) * 10));
+    iterations = std::min(std::max(iterations, size_t{2}), k_max_iterations);
+  }
+}
+
+std::map<std::string, double> load_baseline(const std::string &path) {
+  std::map<std::string, double> baseline;
+  std::string text;
+
+  if (!shcore::load_text_file(path, text))
+    throw std::runtime_error("Unable to read the baseline file '" + path +
+                             "': " + shcore::get_last_error());
+
+  const auto results = shcore::Value::parse_json(text).as_map()->get_array(
+      "benchmarks", std::make_shared<shcore::Value::Array_type>());
+
+  for (const auto &entry : *results) {
+    const auto map = entry.as_map();
+    baseline[map->get_string("name")] = map->get_double("ns_per_op");
+  }
+
+  return baseline;
+}
+
+void save_results(const std::string &path, const std::vector<Result> &results) {
+  shcore::JSON_dumper dumper(true);
+
+  dumper.start_object();
+  dumper.append_float("min_time", g_options.min_time);
+  dumper.append_int("repetitions", g_options.repetitions);
+  dumper.append_string("benchmarks");
+  dumper.start_array();
+
+  for (const auto &result : results) {
+    dumper.start_object();
+    dumper.append_string("name", result.name);
+    dumper.append_uint64("iterations", result.iterations);
+    dumper.append_float("ns_per_op", result.ns_per_op);
+    dumper.append_float("bytes_per_second", result.bytes_per_second);
+    dumper.append_float("items_per_second", result.items_per_second);
+    dumper.end_object();
+  }
+
+  dumper.end_array();
+  dumper.end_object();
+
+  if (!shcore::create_file(path, dumper.str() + "\n"))
+    throw std::runtime_error("Unable to write the results to '" + path +
+                             "': " + shcore::get_last_error());
+}
+
+std::string format_rate(double per_second, const char *unit) {
+  if (per_second >= 1e9)
+    return shcore::str_format("%8.2f G%s/s", per_second / 1e9, unit);
+  if (per_second >= 1e6)
+    return shcore::str_format("%8.2f M%s/s", per_second / 1e6, unit);
+  return shcore::str_format("%8.2f K%s/s", per_second / 1e3, unit);
+}
+
+}  // namespace
+
+void State::keep(size_t value) { g_sink = g_sink + value; }
+
+Registrar::Registrar(const char *name, Benchmark_function function) {
+  registry().emplace_back(name, function);
+}
+
+const Options &options() { return g_options; }
+
+int run_benchmarks(const Options &opts) {
+  g_options = opts;
+
+  std::map<std::string, double> baseline;
+  if (!g_options.baseline.empty()) baseline = load_baseline(g_options.baseline);
+
+  auto benchmarks = registry();
+  std::sort(benchmarks.begin(), benchmarks.end());
+
+  std::vector<Result> results;
+  int regressions = 0;
+
+  for (const auto &benchmark : benchmarks) {
+    if (!shcore::match_glob(g_options.filter, benchmark.first, true)) continue;
+
+    Result best;
+    best.name = benchmark.first;
+    best.ns_per_op = std::numeric_limits<double>::max();
+    std::string skip_reason;
+
+    for (int i = 0; i < std::max(g_options.repetitions, 1); ++i) {
+      Result result;
+
+      if (!run_once(benchmark.second, &result, &skip_reason)) break;
+
+      if (result.ns_per_op < best.ns_per_op) {
+        result.name = best.name;
+        best = result;
+      }
+    }
+
+    if (!skip_reason.empty()) {
+      std::cout << shcore::str_format("%-44s skipped: %s\n",
+                                      benchmark.first.c_str(),
+                                      skip_reason.c_str());
+      continue;
+    }
+
+    std::string line = shcore::str_format(
+        "%-44s %14.1f ns/op", best.name.c_str(), best.ns_per_op);
+
+    if (best.bytes_per_second > 0)
+      line += "  " + format_rate(best.bytes_per_second, "B");
+    if (best.items_per_second > 0)
+      line += "  " + format_rate(best.items_per_second, "item");
+
+    const auto base = baseline.find(best.name);
+    if (base != baseline.end() && base->second > 0) {
+      const double change = (best.ns_per_op / base->second - 1.0) * 100.0;
+      line += shcore::str_format("  %+6.1f%%", change);
+
+      if (change > g_options.threshold) {
+        line += " REGRESSION";
+        ++regressions;
+      }
+    }
+
+    std::cout << line << std::endl;
+    results.push_back(std::move(best));
+  }
+
+  if (!g_options.output.empty()) save_results(g_options.output, results);
+
+  if (regressions > 0)
+    std::cout << regressions << " benchmark(s) are more than "
+              << g_options.threshold << "% slower than the baseline\n";
+
+  return regressions;
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
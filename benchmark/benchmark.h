@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef BENCHMARK_BENCHMARK_H_
+#define BENCHMARK_BENCHMARK_H_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace mysqlsh {
+namespace bench {
+
+/**
+ * Drives the timed loop of a single benchmark run. Everything before the first
+ * call to keep_running() is setup and is not measured:
+ *
+ *   BENCHMARK(Group, name) {
+ *     const auto data = make_data();
+ *     state->set_bytes_per_iteration(data.size());
+ *
+ *     while (state->keep_running()) state->keep(code_under_test(data));
+ *   }
+ */
+class State {
+ public:
+  explicit State(size_t iterations) : m_remaining(iterations) {}
+
+  State(const State &) = delete;
+  State &operator=(const State &) = delete;
+
+  bool keep_running() {
+    if (!m_started) {
+      m_started = true;
+      m_start = Clock::now();
+    }
+
+    if (m_remaining > 0) {
+      --m_remaining;
+      return true;
+    }
+
+    m_elapsed = Clock::now() - m_start;
+    return false;
+  }
+
+  /**
+   * Consumes a result of the measured code, so the compiler cannot drop the
+   * computation.
+   */
+  void keep(size_t value);
+
+  /**
+   * Amount of input processed by one iteration, used to report throughput.
+   */
+  void set_bytes_per_iteration(size_t bytes) { m_bytes = bytes; }
+
+  /**
+   * Number of items (rows, statements, documents) processed by one iteration.
+   */
+  void set_items_per_iteration(size_t items) { m_items = items; }
+
+  /**
+   * Marks the benchmark as not runnable, i.e. its input is not available.
+   * Must be called before keep_running().
+   */
+  void skip(const std::string &reason) { m_skip_reason = reason; }
+
+  bool skipped() const { return !m_skip_reason.empty(); }
+  const std::string &skip_reason() const { return m_skip_reason; }
+
+  double elapsed_ns() const {
+    return std::chrono::duration<double, std::nano>(m_elapsed).count();
+  }
+
+  size_t bytes_per_iteration() const { return m_bytes; }
+  size_t items_per_iteration() const { return m_items; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  size_t m_remaining;
+  bool m_started = false;
+  Clock::time_point m_start;
+  Clock::duration m_elapsed = Clock::duration::zero();
+  size_t m_bytes = 0;
+  size_t m_items = 0;
+  std::string m_skip_reason;
+};
+
+using Benchmark_function = void (*)(State *state);
+
+class Registrar {
+ public:
+  Registrar(const char *name, Benchmark_function function);
+};
+
+struct Options {
+  // Glob pattern selecting the benchmarks to run
+  std::string filter = "*";
+  // Minimum time in seconds spent in the timed loop of each run, 0 runs every
+  // benchmark exactly once
+  double min_time = 0.5;
+  // Each benchmark is run this many times and the fastest run is reported
+  int repetitions = 3;
+  // File where the results are written as JSON
+  std::string output;
+  // Results of a previous run, used to detect regressions
+  std::string baseline;
+  // Slowdown (in percent) reported as a regression
+  double threshold = 10.0;
+  // Test data of the unit tests, i.e. unittest/data
+  std::string data_path;
+  // Folder which is recursively searched for replay traces
+  std::string traces_path;
+};
+
+const Options &options();
+
+/**
+ * Runs the selected benchmarks and prints the results.
+ *
+ * @return number of benchmarks which regressed when compared with the
+ *         baseline.
+ */
+int run_benchmarks(const Options &opts);
+
+}  // namespace bench
+}  // namespace mysqlsh
+
+#define BENCHMARK_FUNCTION_NAME(group, name) group##_##name##_benchmark
+
+#define BENCHMARK(group, name)                                       \
+  static void BENCHMARK_FUNCTION_NAME(group, name)(                  \
+      ::mysqlsh::bench::State * state);                              \
+  static ::mysqlsh::bench::Registrar group##_##name##_registrar(     \
+      #group "." #name, BENCHMARK_FUNCTION_NAME(group, name));       \
+  static void BENCHMARK_FUNCTION_NAME(group, name)(                  \
+      ::mysqlsh::bench::State * state)
+
+#endif  // BENCHMARK_BENCHMARK_H_
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+
+#include "benchmark/bench_data.h"
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/libs/utils/utils_buffered_input.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+constexpr const char k_documents_file[] = "run_benchmarks.documents.json";
+
+/**
+ * Splits the file into documents using the zero-copy variant, which references
+ * the mapped file when possible.
+ */
+void span_documents(const std::string &path, bool use_mmap, State *state) {
+  while (state->keep_running()) {
+    shcore::Buffered_input input;
+    std::string buffer;
+    size_t documents = 0;
+
+    input.open(path, use_mmap);
+
+    while (!shcore::span_one_maybe_json(&input, &buffer).empty()) ++documents;
+
+    state->set_items_per_iteration(documents);
+    state->keep(documents);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Buffered_input, span_mapped) {
+  const auto documents = synthetic_documents(20000);
+  Temporary_file file(k_documents_file, documents);
+
+  state->set_bytes_per_iteration(documents.size());
+  span_documents(file.path(), true, state);
+}
+
+BENCHMARK(Buffered_input, span_buffered) {
+  const auto documents = synthetic_documents(20000);
+  Temporary_file file(k_documents_file, documents);
+
+  state->set_bytes_per_iteration(documents.size());
+  span_documents(file.path(), false, state);
+}
+
+BENCHMARK(Buffered_input, span_copy) {
+  const auto text = synthetic_documents(20000);
+  Temporary_file file(k_documents_file, text);
+
+  state->set_bytes_per_iteration(text.size());
+
+  while (state->keep_running()) {
+    shcore::Buffered_input input(file.path());
+    size_t documents = 0;
+
+    while (!shcore::span_one_maybe_json(&input).empty()) ++documents;
+
+    state->set_items_per_iteration(documents);
+    state->keep(documents);
+  }
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
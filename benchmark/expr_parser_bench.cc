@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/libs/db/mysqlx/expr_cache.h"
+#include "mysqlshdk/libs/db/mysqlx/expr_parser.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+// Filters typical for the DevAPI find(), modify() and remove() operations
+const std::vector<std::string> k_document_filters = {
+    "_id = :id",
+    "name like :name and age > 18",
+    "address.city in ('Kraków', 'Oslo', 'Zürich') and not deleted",
+    "tags[0] = 'new' or $.ratings[*].stars > 4.5",
+    "json_contains(roles, '\"admin\"') && created >= '2018-01-01'",
+    "(price * quantity) - discount between 10 and 100.5",
+    "cast(`document`->'$.count' as signed) % 2 = 0",
+    "date_add(updated, interval 1 day) < now() and status is not null"};
+
+const std::vector<std::string> k_table_filters = {
+    "id = :id",
+    "`first name` like 'J%' and age > 18",
+    "city in ('Kraków', 'Oslo') and population > 100000",
+    "price * quantity - discount between 10 and 100.5",
+    "created >= '2018-01-01' and deleted is null",
+    "doc->'$.address.city' = 'Oslo' or doc->>'$.zip' like '9%'"};
+
+size_t total_size(const std::vector<std::string> &expressions) {
+  size_t size = 0;
+  for (const auto &expression : expressions) size += expression.size();
+  return size;
+}
+
+void parse(const std::vector<std::string> &expressions, bool document_mode,
+           State *state) {
+  state->set_bytes_per_iteration(total_size(expressions));
+  state->set_items_per_iteration(expressions.size());
+
+  while (state->keep_running()) {
+    for (const auto &expression : expressions) {
+      ::mysqlx::Expr_parser parser(expression, document_mode);
+      state->keep(parser.expr()->ByteSize());
+    }
+  }
+}
+
+void parse_cached(const std::vector<std::string> &expressions,
+                  bool document_mode, State *state) {
+  ::mysqlx::Expr_cache cache;
+
+  state->set_bytes_per_iteration(total_size(expressions));
+  state->set_items_per_iteration(expressions.size());
+
+  while (state->keep_running()) {
+    for (const auto &expression : expressions) {
+      std::vector<std::string> placeholders;
+      state->keep(
+          cache.filter(expression, document_mode, &placeholders)->ByteSize());
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Expr_parser, document_filters) {
+  parse(k_document_filters, true, state);
+}
+
+BENCHMARK(Expr_parser, table_filters) { parse(k_table_filters, false, state); }
+
+BENCHMARK(Expr_parser, document_filters_cached) {
+  parse_cached(k_document_filters, true, state);
+}
+
+BENCHMARK(Expr_parser, table_filters_cached) {
+  parse_cached(k_table_filters, false, state);
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/bench_data.h"
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+/**
+ * Wraps the documents into a JSON array, so they can be parsed as a single
+ * value.
+ */
+std::string to_array(const std::string &documents) {
+  std::string array = "[";
+
+  for (size_t begin = 0, end = 0; begin < documents.size(); begin = end + 1) {
+    end = documents.find('\n', begin);
+    if (end == std::string::npos) end = documents.size();
+    if (end == begin) continue;
+
+    if (array.size() > 1) array += ",";
+    array.append(documents, begin, end - begin);
+  }
+
+  return array + "]";
+}
+
+std::string sample_documents(State *state) {
+  const auto path = data_file("import/sample.json");
+
+  if (path.empty()) {
+    state->skip("import/sample.json not found in the test data");
+    return {};
+  }
+
+  return to_array(shcore::get_text_file(path));
+}
+
+void parse(const std::string &text, State *state) {
+  state->set_bytes_per_iteration(text.size());
+
+  while (state->keep_running())
+    state->keep(shcore::Value::parse(text).as_array()->size());
+}
+
+void parse_json(const std::string &text, State *state) {
+  state->set_bytes_per_iteration(text.size());
+
+  while (state->keep_running())
+    state->keep(shcore::Value::parse_json(text).as_array()->size());
+}
+
+void dump(const shcore::Value &value, bool pprint, State *state) {
+  while (state->keep_running()) {
+    shcore::JSON_dumper dumper(pprint);
+    dumper.append_value(value);
+    state->keep(dumper.str().size());
+  }
+}
+
+constexpr int k_maps = 1000;
+constexpr int k_keys = 16;
+
+std::vector<std::string> map_keys() {
+  std::vector<std::string> keys;
+
+  for (int i = 0; i < k_keys; ++i)
+    keys.emplace_back("field_" + std::to_string(i));
+
+  return keys;
+}
+
+/**
+ * Keys arrive in random order, as in JSON documents.
+ */
+std::vector<std::vector<std::string>> insert_orders(
+    const std::vector<std::string> &keys) {
+  std::mt19937 random(1);
+  std::vector<std::vector<std::string>> orders(64, keys);
+
+  for (auto &order : orders) std::shuffle(order.begin(), order.end(), random);
+
+  return orders;
+}
+
+/**
+ * Inserts, looks up and iterates over the members of k_maps maps.
+ */
+template <typename Map>
+void insert_lookup_iterate(State *state) {
+  const auto keys = map_keys();
+  const auto orders = insert_orders(keys);
+
+  state->set_items_per_iteration(k_maps);
+
+  while (state->keep_running()) {
+    size_t found = 0;
+
+    for (int m = 0; m < k_maps; ++m) {
+      Map map;
+
+      for (const auto &key : orders[m % orders.size()])
+        map[key] = shcore::Value(m);
+
+      for (const auto &key : keys) found += map.count(key);
+
+      for (const auto &member : map)
+        found += member.second.type == shcore::Integer;
+    }
+
+    state->keep(found);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Value, parse_synthetic) {
+  parse(to_array(synthetic_documents(500)), state);
+}
+
+BENCHMARK(Value, parse_sample) {
+  const auto text = sample_documents(state);
+  if (!state->skipped()) parse(text, state);
+}
+
+BENCHMARK(Value, parse_json_synthetic) {
+  parse_json(to_array(synthetic_documents(500)), state);
+}
+
+BENCHMARK(Value, parse_json_sample) {
+  const auto text = sample_documents(state);
+  if (!state->skipped()) parse_json(text, state);
+}
+
+BENCHMARK(JSON_dumper, compact) {
+  dump(shcore::Value::parse_json(to_array(synthetic_documents(500))), false,
+       state);
+}
+
+BENCHMARK(JSON_dumper, pretty) {
+  dump(shcore::Value::parse_json(to_array(synthetic_documents(500))), true,
+       state);
+}
+
+// std::map is what Map_type used to be based on
+BENCHMARK(Map_type, std_map) {
+  insert_lookup_iterate<std::map<std::string, shcore::Value>>(state);
+}
+
+BENCHMARK(Map_type, insert_lookup_iterate) {
+  insert_lookup_iterate<shcore::Value::Map_type>(state);
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace {
+
+void print_usage(const char *program) {
+  std::cout
+      << "Usage: " << program << " [options]\n\n"
+      << "Runs the micro-benchmarks of the shell, no server is needed.\n\n"
+      << "  --filter=<glob>      Run only the matching benchmarks, i.e. "
+         "Splitter.*\n"
+      << "  --min-time=<sec>     Minimum time of each run, 0 runs every "
+         "benchmark once\n"
+      << "  --repetitions=<n>    Number of runs, the fastest one is reported\n"
+      << "  --output=<file>      Write the results to a JSON file\n"
+      << "  --baseline=<file>    Compare with the results of a previous run\n"
+      << "  --threshold=<pct>    Slowdown reported as a regression (default "
+         "10)\n"
+      << "  --data=<dir>         Unit test data folder\n"
+      << "  --traces=<dir>       Folder with the recorded replay traces "
+         "(default: benchmark/traces)\n\n"
+      << "Exits with 1 if any benchmark regressed.\n";
+}
+
+bool get_option(const char *arg, const char *name, std::string *value) {
+  const size_t length = strlen(name);
+
+  if (strncmp(arg, name, length) != 0 || arg[length] != '=') return false;
+
+  *value = arg + length + 1;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  mysqlsh::bench::Options options;
+  const std::string test_home =
+      shcore::path::join_path(MYSQLX_SOURCE_HOME, "unittest");
+
+  options.data_path = shcore::path::join_path(test_home, "data");
+  options.traces_path =
+      shcore::path::join_path(MYSQLX_SOURCE_HOME, "benchmark", "traces");
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      std::string value;
+
+      if (strcmp(argv[i], "--help") == 0) {
+        print_usage(argv[0]);
+        return 0;
+      } else if (get_option(argv[i], "--filter", &value)) {
+        options.filter = value;
+      } else if (get_option(argv[i], "--min-time", &value)) {
+        options.min_time = std::stod(value);
+      } else if (get_option(argv[i], "--repetitions", &value)) {
+        options.repetitions = std::stoi(value);
+      } else if (get_option(argv[i], "--output", &value)) {
+        options.output = value;
+      } else if (get_option(argv[i], "--baseline", &value)) {
+        options.baseline = value;
+      } else if (get_option(argv[i], "--threshold", &value)) {
+        options.threshold = std::stod(value);
+      } else if (get_option(argv[i], "--data", &value)) {
+        options.data_path = value;
+      } else if (get_option(argv[i], "--traces", &value)) {
+        options.traces_path = value;
+      } else {
+        std::cerr << "Unknown option: " << argv[i] << "\n";
+        print_usage(argv[0]);
+        return 2;
+      }
+    }
+
+    return mysqlsh::bench::run_benchmarks(options) > 0 ? 1 : 0;
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 2;
+  }
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "benchmark/bench_data.h"
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/shellcore/shell_console.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+void utf8_sizes(const std::string &text, State *state) {
+  const Print_flags flags(Print_flag::PRINT_0_AS_SPC);
+
+  state->set_bytes_per_iteration(text.size());
+
+  while (state->keep_running())
+    state->keep(std::get<0>(get_utf8_sizes(text.data(), text.size(), flags)));
+}
+
+/**
+ * Result which returns the given rows from fetchOne() and fetchAll(), rows are
+ * converted when they are fetched, as the shell does.
+ */
+class Bench_result : public mysqlsh::ShellBaseResult {
+ public:
+  explicit Bench_result(const Result_data *data)
+      : m_data(data),
+        m_fields(std::make_shared<mysqlsh::Row_fields>()),
+        m_columns(shcore::make_array()) {
+    for (const auto &column : data->columns) {
+      m_fields->add(column.get_column_label());
+      m_columns->push_back(shcore::Value(
+          std::static_pointer_cast<shcore::Object_bridge>(make_column(column))));
+    }
+  }
+
+  std::string class_name() const override { return "Bench_result"; }
+
+  shcore::Value get_member(const std::string &prop) const override {
+    if (prop == "columns") return shcore::Value(m_columns);
+    return ShellBaseResult::get_member(prop);
+  }
+
+  shcore::Value call(const std::string &name,
+                     const shcore::Argument_list &args) override {
+    if (name == "fetchOne") {
+      if (m_next == m_data->rows.size()) return shcore::Value::Null();
+      return next_row();
+    } else if (name == "fetchAll") {
+      auto rows = shcore::make_array();
+      while (m_next < m_data->rows.size()) rows->push_back(next_row());
+      return shcore::Value(rows);
+    }
+
+    return ShellBaseResult::call(name, args);
+  }
+
+  void reset() { m_next = 0; }
+
+ private:
+  shcore::Value next_row() {
+    return shcore::Value(std::static_pointer_cast<shcore::Object_bridge>(
+        std::make_shared<mysqlsh::Row>(m_fields, m_data->rows[m_next++])));
+  }
+
+  const Result_data *m_data;
+  std::shared_ptr<mysqlsh::Row_fields> m_fields;
+  shcore::Value::Array_type_ref m_columns;
+  size_t m_next = 0;
+};
+
+class Bench_dumper : public mysqlsh::ResultsetDumper {
+ public:
+  Bench_dumper(std::shared_ptr<mysqlsh::ShellBaseResult> target,
+               bool buffer_data)
+      : ResultsetDumper(target, buffer_data) {}
+
+  void dump_records() {
+    std::string stats;
+    ResultsetDumper::dump_records(stats);
+  }
+};
+
+/**
+ * Counts the printed bytes instead of writing them to the terminal.
+ */
+class Output_counter {
+ public:
+  Output_counter()
+      : m_deleg(this, &Output_counter::print, nullptr, nullptr,
+                &Output_counter::print),
+        m_console(std::make_shared<mysqlsh::Shell_console>(&m_deleg)) {}
+
+  size_t bytes() const { return m_bytes; }
+
+ private:
+  static void print(void *user_data, const char *text) {
+    static_cast<Output_counter *>(user_data)->m_bytes += strlen(text);
+  }
+
+  size_t m_bytes = 0;
+  shcore::Interpreter_delegate m_deleg;
+  mysqlsh::Scoped_console m_console;
+};
+
+/**
+ * Prints the results in the TABLE format, either buffering all the rows
+ * first or streaming them.
+ */
+void dump_table(const std::vector<const Result_data *> &data, bool streaming,
+                State *state) {
+  auto shell_options = std::make_shared<mysqlsh::Shell_options>(0, nullptr);
+  shell_options->set(SHCORE_OUTPUT_FORMAT, shcore::Value("table"));
+  mysqlsh::Scoped_shell_options scoped_options(shell_options);
+  Output_counter output;
+
+  std::vector<std::shared_ptr<Bench_result>> results;
+  size_t rows = 0;
+
+  for (const auto result : data) {
+    results.emplace_back(std::make_shared<Bench_result>(result));
+    rows += result->rows.size();
+  }
+
+  state->set_items_per_iteration(rows);
+
+  while (state->keep_running()) {
+    // every result is printed separately, as it happens in the shell
+    for (const auto &result : results) {
+      result->reset();
+      Bench_dumper(result, !streaming).dump_records();
+    }
+  }
+
+  state->keep(output.bytes());
+}
+
+std::vector<const Result_data *> trace_results(State *state) {
+  std::vector<const Result_data *> results;
+
+  for (const auto &result : traces().results) results.push_back(&result);
+
+  if (results.empty()) state->skip("no results in the replay traces");
+
+  return results;
+}
+
+}  // namespace
+
+BENCHMARK(Utf8_sizes, ascii) {
+  std::string text;
+  while (text.size() < 64 * 1024)
+    text += "The quick brown fox jumps over the lazy dog 0123456789. ";
+
+  utf8_sizes(text, state);
+}
+
+BENCHMARK(Utf8_sizes, multibyte) {
+  std::string text;
+  while (text.size() < 64 * 1024)
+    text += "Zażółć gęślą jaźń, 東京都, Ελληνικά, ASCII\ttab\x01 ctrl ";
+
+  utf8_sizes(text, state);
+}
+
+BENCHMARK(ResultsetDumper, table_synthetic) {
+  const auto result = synthetic_result(1000);
+  dump_table({&result}, false, state);
+}
+
+BENCHMARK(ResultsetDumper, table_streaming_synthetic) {
+  const auto result = synthetic_result(1000);
+  dump_table({&result}, true, state);
+}
+
+BENCHMARK(ResultsetDumper, table_traces) {
+  const auto results = trace_results(state);
+  if (!state->skipped()) dump_table(results, false, state);
+}
+
+BENCHMARK(ResultsetDumper, table_streaming_traces) {
+  const auto results = trace_results(state);
+  if (!state->skipped()) dump_table(results, true, state);
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
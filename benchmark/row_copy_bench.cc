@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <vector>
+
+#include "benchmark/bench_data.h"
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+using mysqlshdk::db::Row_copy;
+
+void copy_rows(const std::vector<const Result_data *> &results, State *state) {
+  size_t rows = 0;
+  for (const auto result : results) rows += result->rows.size();
+
+  state->set_items_per_iteration(rows);
+
+  while (state->keep_running()) {
+    for (const auto result : results) {
+      for (const auto &row : result->rows) {
+        Row_copy copy(row);
+        state->keep(copy.num_fields());
+      }
+    }
+  }
+}
+
+/**
+ * Copies the rows the way a buffered result does it, the copies share the field
+ * types with the copy of the first row.
+ */
+void copy_rows_shared_layout(const std::vector<const Result_data *> &results,
+                             State *state) {
+  size_t rows = 0;
+  for (const auto result : results) rows += result->rows.size();
+
+  state->set_items_per_iteration(rows);
+
+  while (state->keep_running()) {
+    for (const auto result : results) {
+      if (result->rows.empty()) continue;
+
+      const Row_copy layout(result->rows.front());
+
+      for (const auto &row : result->rows) {
+        Row_copy copy(row, layout);
+        state->keep(copy.num_fields());
+      }
+    }
+  }
+}
+
+std::vector<const Result_data *> trace_results(State *state) {
+  std::vector<const Result_data *> results;
+
+  for (const auto &result : traces().results) results.push_back(&result);
+
+  if (results.empty()) state->skip("no results in the replay traces");
+
+  return results;
+}
+
+}  // namespace
+
+BENCHMARK(Row_copy, synthetic) {
+  const auto result = synthetic_result(10000);
+  copy_rows({&result}, state);
+}
+
+BENCHMARK(Row_copy, synthetic_shared_layout) {
+  const auto result = synthetic_result(10000);
+  copy_rows_shared_layout({&result}, state);
+}
+
+BENCHMARK(Row_copy, traces) {
+  const auto results = trace_results(state);
+  if (!state->skipped()) copy_rows(results, state);
+}
+
+BENCHMARK(Row_copy, traces_shared_layout) {
+  const auto results = trace_results(state);
+  if (!state->skipped()) copy_rows_shared_layout(results, state);
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stack>
+#include <string>
+
+#include "benchmark/bench_data.h"
+#include "benchmark/benchmark.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+
+namespace mysqlsh {
+namespace bench {
+
+namespace {
+
+void split(const std::string &sql, State *state) {
+  using shcore::mysql::splitter::Delimiters;
+  using shcore::mysql::splitter::determineStatementRanges;
+
+  state->set_bytes_per_iteration(sql.size());
+
+  while (state->keep_running()) {
+    Delimiters delimiters({";"});
+    std::stack<std::string> input_context_stack;
+
+    const auto ranges =
+        determineStatementRanges(sql.data(), sql.size(), delimiters, "\n",
+                                 input_context_stack);
+
+    state->set_items_per_iteration(ranges.size());
+    state->keep(ranges.size());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Splitter, synthetic) { split(synthetic_sql(2000), state); }
+
+BENCHMARK(Splitter, test_scripts) {
+  std::string sql;
+
+  for (const auto name : {"sql/fieldtypes_all.sql", "sql/simple_schema.sql",
+                          "sql/sql_ok.sql"}) {
+    const auto path = data_file(name);
+    if (!path.empty()) sql += shcore::get_text_file(path) + "\n";
+  }
+
+  if (sql.empty()) {
+    state->skip("SQL scripts not found in the test data");
+    return;
+  }
+
+  split(sql, state);
+}
+
+BENCHMARK(Splitter, traces) {
+  const auto &sql = traces().sql;
+
+  if (sql.empty()) {
+    state->skip("no queries in the replay traces");
+    return;
+  }
+
+  split(sql, state);
+}
+
+}  // namespace bench
+}  // namespace mysqlsh
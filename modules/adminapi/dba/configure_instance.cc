@@ -529,6 +529,13 @@ void Configure_instance::prepare() {
   // Ensure the user has privs to do all these checks
   ensure_user_privileges(*m_target_instance);
 
+  // read the variables checked below in a single query, super_read_only is
+  // changed by execute() so the snapshot does not outlive the checks
+  m_target_instance->snapshot_sysvars({"innodb_page_size", "super_read_only"},
+                                      mysqlshdk::mysql::Var_qualifier::GLOBAL);
+  shcore::on_leave_scope clear_snapshot(
+      [this]() { m_target_instance->clear_sysvar_snapshot(); });
+
   ensure_instance_address_usable();
 
   // Validate the admin_account privileges:
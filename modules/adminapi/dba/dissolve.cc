@@ -107,11 +107,9 @@ void Dissolve::ensure_instance_reachable(
   // Try to connect to instance and add it to list of available instances to
   // remove from the cluster.
   log_debug("Connecting to instance '%s'", instance_address.c_str());
-  std::shared_ptr<mysqlshdk::db::ISession> session;
   try {
-    session = mysqlshdk::db::mysql::Session::create();
-    session->connect(instance_cnx_opts);
-    m_available_instances.emplace_back(new mysqlshdk::mysql::Instance(session));
+    m_available_instances.emplace_back(
+        mysqlshdk::mysql::Instance::connect_pooled(instance_cnx_opts));
     log_debug("Successfully connected to instance");
   } catch (const std::exception &err) {
     log_debug("Failed to connect to instance: %s", err.what());
@@ -503,12 +501,9 @@ void Dissolve::rollback() {
 }
 
 void Dissolve::finish() {
-  // Close all sessions to available instances.
-  for (const auto &instance : m_available_instances) {
-    instance->close_session();
-  }
-
-  // Reset all auxiliary (temporary) data used for the operation execution.
+  // Reset all auxiliary (temporary) data used for the operation execution,
+  // the sessions to the available instances are handed back to the session
+  // pool.
   m_available_instances.clear();
   m_skipped_instances.clear();
   m_sync_error_instances.clear();
@@ -214,11 +214,10 @@ void Remove_instance::prepare() {
   // NOTE: Connection required to perform some last validations if the target
   //       instance is available.
   log_debug("Connecting to instance '%s'", m_instance_address.c_str());
-  std::shared_ptr<mysqlshdk::db::ISession> session;
   try {
-    session = mysqlshdk::db::mysql::Session::create();
-    session->connect(m_instance_cnx_opts);
-    m_target_instance = new mysqlshdk::mysql::Instance(session);
+    m_target_instance =
+        mysqlshdk::mysql::Instance::connect_pooled(m_instance_cnx_opts)
+            .release();
     log_debug("Successfully connected to instance");
   } catch (std::exception &err) {
     log_debug("Failed to connect to instance: %s", err.what());
@@ -363,10 +362,9 @@ void Remove_instance::rollback() {
 }
 
 void Remove_instance::finish() {
-  // Close the instance session at the end if available.
-  if (m_target_instance) {
-    m_target_instance->close_session();
-  }
+  // Hand the instance session back to the session pool, if available.
+  delete m_target_instance;
+  m_target_instance = nullptr;
 }
 
 }  // namespace dba
@@ -1164,7 +1164,9 @@ REGISTER_HELP(
     CLUSTER_STATUS_DETAIL17,
     "@li readReplicas: a list of read replica Instances of the instance.");
 REGISTER_HELP(CLUSTER_STATUS_DETAIL18, "@li role: the instance role");
-REGISTER_HELP(CLUSTER_STATUS_DETAIL19, "@li status: the instance status");
+REGISTER_HELP(CLUSTER_STATUS_DETAIL19,
+              "@li status: the instance status, as reported by the instance "
+              "itself, UNREACHABLE if the instance did not respond in time");
 
 /**
  * $(CLUSTER_STATUS_BRIEF)
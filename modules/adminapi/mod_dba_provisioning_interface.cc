@@ -385,7 +385,11 @@ int ProvisioningInterface::check(
 
   {
     auto map = get_connection_map(connection_options);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) {
+      // copy first, inserting "passwd" invalidates references into the map
+      const auto password = map->at("password");
+      (*map)["passwd"] = password;
+    }
     kwargs["server"] = shcore::Value(map);
   }
   if (!cnfpath.empty()) {
@@ -692,7 +696,10 @@ int ProvisioningInterface::start_replicaset(
 
   {
     auto map = get_connection_map(instance);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) {
+      const auto password = map->at("password");
+      (*map)["passwd"] = password;
+    }
     args.push_back(shcore::Value(map));
   }
 
@@ -746,12 +753,18 @@ int ProvisioningInterface::join_replicaset(
 
   {
     auto map = get_connection_map(instance);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) {
+      const auto password = map->at("password");
+      (*map)["passwd"] = password;
+    }
     args.push_back(shcore::Value(map));
   }
   {
     auto map = get_connection_map(peer);
-    if (map->has_key("password")) (*map)["passwd"] = (*map)["password"];
+    if (map->has_key("password")) {
+      const auto password = map->at("password");
+      (*map)["passwd"] = password;
+    }
     args.push_back(shcore::Value(map));
   }
 
@@ -23,12 +23,15 @@
 #include "modules/adminapi/mod_dba_replicaset.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -43,8 +46,11 @@
 #include "modules/mod_shell.h"
 #include "modules/mysqlxtest_utils.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
 #include "mysqlshdk/libs/mysql/instance.h"
+#include "mysqlshdk/shellcore/credential_manager.h"
 #include "shellcore/base_session.h"
 #include "utils/utils_general.h"
 #include "utils/utils_net.h"
@@ -101,6 +107,100 @@ std::string &ReplicaSet::append_descr(std::string &s_out, int UNUSED(indent),
   return s_out;
 }
 
+namespace mysqlsh {
+namespace dba {
+
+std::map<std::string, std::string> probe_members(
+    const std::vector<Instance_definition> &instances,
+    const mysqlshdk::db::Connection_options &cnx_opt,
+    const std::string &skip_endpoint, int timeout_ms) {
+  std::vector<std::string> endpoints;
+  std::vector<mysqlshdk::db::Connection_options> targets;
+
+  for (const auto &instance : instances) {
+    if (instance.state != "ONLINE" && instance.state != "RECOVERING") continue;
+    if (instance.endpoint == skip_endpoint) continue;
+
+    auto target_coptions =
+        shcore::get_connection_options(instance.endpoint, false);
+    target_coptions.set_login_options_from(cnx_opt);
+    target_coptions.set_default_connection_data();
+    // credentials are resolved here, the probes do not use the shell globals
+    if (!target_coptions.has_password()) {
+      shcore::Credential_manager::get().get_password(&target_coptions);
+    }
+    target_coptions.set(mysqlshdk::db::kConnectTimeout,
+                        {std::to_string(timeout_ms)});
+
+    endpoints.emplace_back(instance.endpoint);
+    targets.emplace_back(std::move(target_coptions));
+  }
+
+  const auto read_timeout =
+      static_cast<unsigned int>(std::ceil(timeout_ms / 1000.0));
+  std::vector<std::string> states(targets.size());
+  std::vector<std::string> errors(targets.size());
+  std::vector<std::thread> probes;
+  probes.reserve(targets.size());
+
+  const auto join_probes = [&probes]() {
+    for (auto &probe : probes) {
+      probe.join();
+    }
+  };
+
+  try {
+    for (size_t i = 0; i < targets.size(); ++i) {
+      probes.emplace_back([&targets, &states, &errors, read_timeout, i]() {
+        mysqlsh::thread_init();
+
+        try {
+          // a dedicated session, status() is not meant to leave connections
+          // to all of the members behind
+          auto session = mysqlshdk::db::mysql::Session::create();
+          session->set_read_timeout(read_timeout);
+          session->connect(targets[i]);
+
+          auto result = session->query(
+              "SELECT MEMBER_STATE"
+              " FROM performance_schema.replication_group_members"
+              " WHERE MEMBER_ID = @@server_uuid");
+          auto row = result->fetch_one();
+          if (row && !row->is_null(0)) states[i] = row->get_string(0);
+
+          session->close();
+        } catch (const std::exception &e) {
+          errors[i] = e.what();
+        }
+
+        mysqlsh::thread_end();
+      });
+    }
+  } catch (...) {
+    join_probes();
+    throw;
+  }
+
+  join_probes();
+
+  std::map<std::string, std::string> member_states;
+
+  for (size_t i = 0; i < targets.size(); ++i) {
+    if (!errors[i].empty()) {
+      log_warning("Could not get the state of '%s' from the instance: %s",
+                  endpoints[i].c_str(), errors[i].c_str());
+      member_states[endpoints[i]] = "UNREACHABLE";
+    } else if (!states[i].empty()) {
+      member_states[endpoints[i]] = states[i];
+    }
+  }
+
+  return member_states;
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
+
 static void append_member_status(const shcore::Value::Map_type_ref &node,
                                  const Instance_definition &instance,
                                  bool read_write,
@@ -249,6 +349,10 @@ static void update_group_replication_group_seeds(
       session->get_connection_options().as_uri(only_transport());
   // create an instance object for the provided session
   auto instance = mysqlshdk::mysql::Instance(session);
+  // read all the variables needed below in a single query
+  instance.snapshot_sysvars(
+      {"group_replication_group_seeds", "persisted_globals_load"},
+      mysqlshdk::mysql::Var_qualifier::GLOBAL);
   auto gr_group_seeds = instance.get_sysvar_string(
       "group_replication_group_seeds", mysqlshdk::mysql::Var_qualifier::GLOBAL);
   auto gr_group_seeds_vector = shcore::split_string(*gr_group_seeds, ",");
@@ -899,8 +1003,8 @@ std::string ReplicaSet::get_cluster_group_seeds(
           "Connecting to instance '%s' to get its value for the "
           "group_replication_local_address variable.",
           instance_address.c_str());
-      session = establish_mysql_session(target_coptions,
-                                        current_shell_options()->get().wizards);
+      session = establish_pooled_mysql_session(
+          target_coptions, current_shell_options()->get().wizards);
     } catch (std::exception &e) {
       // Do not issue an error if we are unable to connect to the instance,
       // it might have failed in the meantime, just skip the use of its GR
@@ -922,7 +1026,6 @@ std::string ReplicaSet::get_cluster_group_seeds(
       // avoiding duplicates.
       gr_group_seeds_list.push_back(local_address);
     }
-    session->close();
   }
   return shcore::str_join(gr_group_seeds_list, ",");
 }
@@ -1577,8 +1680,9 @@ void ReplicaSet::add_instance_metadata(
     std::shared_ptr<mysqlshdk::db::ISession> classic;
     std::string joiner_user;
     try {
-      classic = establish_mysql_session(instance_definition,
-                                        current_shell_options()->get().wizards);
+      // members are added in a row when a group is adopted or by rescan()
+      classic = establish_pooled_mysql_session(
+          instance_definition, current_shell_options()->get().wizards);
 
       auto options = classic->get_connection_options();
       port = options.get_port();
@@ -2072,6 +2176,11 @@ shcore::Value ReplicaSet::get_status(
   if (single_primary_mode && master_found)
     (*status)["primary"] = shcore::Value(master.endpoint);
 
+  // Each member reports its own state, all of them are asked at once rather
+  // than one after the other. The member of the cluster session already did.
+  const auto member_states =
+      probe_members(instances, options, active_session_address);
+
   // Creates the topology node
   (*status)["topology"] = shcore::Value::new_map();
   auto instance_owner_node = status->get_map("topology");
@@ -2089,13 +2198,19 @@ shcore::Value ReplicaSet::get_status(
     if (active_session_address == value.endpoint)
       active_session_instance = true;
 
+    auto member = value;
+    const auto member_state = member_states.find(value.endpoint);
+    if (member_state != member_states.end())
+      member.state = member_state->second;
+
     // We compare the server's uuid to match instances, which means that
     // if uuid for an instances changes, the status will look off.
     // re-syncing uuid should be done in a separate step
     if (value.uuid == master.uuid && single_primary_mode)
-      append_member_status(instance_node, value, true, active_session_instance);
+      append_member_status(instance_node, member, true,
+                           active_session_instance);
     else
-      append_member_status(instance_node, value,
+      append_member_status(instance_node, member,
                            single_primary_mode ? false : true,
                            active_session_instance);
 
@@ -2258,18 +2373,25 @@ void ReplicaSet::execute_in_members(
     target_coptions.set_login_options_from(cnx_opt);
     try {
       log_debug(
-          "Opening a new session to instance '%s' while iterating "
+          "Opening a session to instance '%s' while iterating "
           "cluster members",
           instance_address.c_str());
-      instance_session = establish_mysql_session(
+      instance_session = establish_pooled_mysql_session(
           target_coptions, current_shell_options()->get().wizards);
     } catch (std::exception &e) {
       log_error("Could not open connection to '%s': %s",
                 instance_address.c_str(), e.what());
       throw;
     }
-    functor(instance_session);
-    instance_session->close();
+    try {
+      functor(instance_session);
+    } catch (...) {
+      // session state is unknown, it must not be reused
+      instance_session->close();
+      throw;
+    }
+    // hands the session back to the pool, to be reused by the next operation
+    instance_session.reset();
   }
 }
 
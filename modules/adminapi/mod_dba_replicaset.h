@@ -29,6 +29,7 @@
 #define JSON_TOPOLOGY_OUTPUT 2
 #define JSON_RESCAN_OUTPUT 3
 
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -45,6 +46,25 @@ namespace dba {
 class MetadataStorage;
 class Cluster;
 
+// Time given to each member to connect and to answer while getting the
+// cluster status
+constexpr const int kStatusProbeTimeoutMs = 5000;
+
+/**
+ * Gets the state of the ONLINE and RECOVERING members but skip_endpoint, as
+ * seen by each member. Members are queried concurrently and each of them is
+ * given timeout_ms to connect and as much to answer, so the total time is
+ * bound by the slowest member rather than by the sum of all of them.
+ *
+ * @return map of the member states by endpoint, members which could not be
+ * reached in time are UNREACHABLE.
+ */
+std::map<std::string, std::string> probe_members(
+    const std::vector<Instance_definition> &instances,
+    const mysqlshdk::db::Connection_options &cnx_opt,
+    const std::string &skip_endpoint,
+    int timeout_ms = kStatusProbeTimeoutMs);
+
 #if DOXYGEN_CPP
 /**
  * Represents a ReplicaSet
@@ -38,6 +38,47 @@
 using namespace mysqlsh;
 using namespace shcore;
 
+namespace {
+Value get_field_value(const mysqlshdk::db::IRow &row, uint32_t index) {
+  if (row.is_null(index)) return Value::Null();
+
+  switch (row.get_type(index)) {
+    case mysqlshdk::db::Type::Null:
+      return Value::Null();
+    case mysqlshdk::db::Type::String:
+      return Value(row.get_string(index));
+    case mysqlshdk::db::Type::Integer:
+      return Value(row.get_int(index));
+    case mysqlshdk::db::Type::UInteger:
+      return Value(row.get_uint(index));
+    case mysqlshdk::db::Type::Float:
+      return Value(row.get_float(index));
+    case mysqlshdk::db::Type::Double:
+      return Value(row.get_double(index));
+    case mysqlshdk::db::Type::Decimal:
+      return Value(row.get_as_string(index));
+    case mysqlshdk::db::Type::Bytes:
+      return Value(row.get_string(index));
+    case mysqlshdk::db::Type::Geometry:
+    case mysqlshdk::db::Type::Json:
+      return Value(row.get_string(index));
+    case mysqlshdk::db::Type::Time:
+      return Value(row.get_string(index));
+    case mysqlshdk::db::Type::Date:
+      return Value(shcore::Date::unrepr(row.get_string(index)));
+    case mysqlshdk::db::Type::DateTime:
+      return Value(shcore::Date::unrepr(row.get_string(index)));
+    case mysqlshdk::db::Type::Bit:
+      return Value(row.get_bit(index));
+    case mysqlshdk::db::Type::Enum:
+    case mysqlshdk::db::Type::Set:
+      return Value(row.get_string(index));
+  }
+
+  return Value::Null();
+}
+}  // namespace
+
 REGISTER_HELP_CLASS(Column, shellapi);
 REGISTER_HELP(COLUMN_BRIEF,
               "Represents the metadata for a column in a result.");
@@ -45,6 +86,19 @@ bool ShellBaseResult::operator==(const Object_bridge &other) const {
   return this == &other;
 }
 
+void ShellBaseResult::append_json_rows(shcore::JSON_dumper &dumper,
+                                       const std::string &key) const {
+  dumper.append_string(key);
+  dumper.start_array();
+
+  while (!(_json_rows_interrupted && _json_rows_interrupted()) &&
+         append_json_row(dumper)) {
+    dumper.flush();
+  }
+
+  dumper.end_array();
+}
+
 Column::Column(const std::string &schema, const std::string &table_name,
                const std::string &table_label, const std::string &column_name,
                const std::string &column_label, shcore::Value type,
@@ -218,94 +272,100 @@ REGISTER_HELP(ROW_DETAIL3,
               "retrieved through "
               "<b>@<Row@>.<<<getField>>>(@<fieldName@>)</b>.");
 
-Row::Row() {
+Row_fields::Row_fields(const std::vector<std::string> &names) {
+  for (const auto &name : names) add(name);
+}
+
+void Row_fields::add(const std::string &name) {
+  // Values would be available as properties if they are valid identifier,
+  // on this case the values would be available as row.property, a field
+  // named as a previous one is only available through index
+  if (shcore::is_valid_identifier(name) && find(name) == std::string::npos)
+    m_properties.emplace_back(m_names.size(), shcore::Cpp_property_name(name));
+
+  m_names.push_back(name);
+}
+
+size_t Row_fields::find(const std::string &name) const {
+  const auto it = std::find(m_names.begin(), m_names.end(), name);
+  return it == m_names.end() ? std::string::npos : it - m_names.begin();
+}
+
+size_t Row_fields::find_property(const std::string &name,
+                                 shcore::NamingStyle style) const {
+  for (const auto &property : m_properties) {
+    if (property.second.name(style) == name) return property.first;
+  }
+
+  return std::string::npos;
+}
+
+Row::Row() : m_fields(std::make_shared<Row_fields>()) {
   add_property("length", "getLength");
   add_method("getField", std::bind(&Row::get_field, this, _1), "field",
              shcore::String);
-  names.reset(new std::vector<std::string>());
 }
 
-Row::Row(std::shared_ptr<std::vector<std::string>> names_,
-         const mysqlshdk::db::IRow &row)
-    : names(names_) {
+Row::Row(std::shared_ptr<Row_fields> fields, const mysqlshdk::db::IRow &row)
+    : m_fields(fields) {
   add_property("length", "getLength");
   add_method("getField", std::bind(&Row::get_field, this, _1), "field",
              shcore::String);
 
-  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
-    const std::string &key = (*names_)[i];
-    // Values would be available as properties if they are valid identifier
-    // and not base members like length and getField
-    // O on this case the values would be available as
-    // row.property
-    if (shcore::is_valid_identifier(key) && !has_member(key)) add_property(key);
-
-    if (row.is_null(i)) {
-      value_array.push_back(Value::Null());
-    } else {
-      switch (row.get_type(i)) {
-        case mysqlshdk::db::Type::Null:
-          value_array.push_back(Value::Null());
-          break;
-        case mysqlshdk::db::Type::String:
-          value_array.push_back(Value(row.get_string(i)));
-          break;
-        case mysqlshdk::db::Type::Integer:
-          value_array.push_back(Value(row.get_int(i)));
-          break;
-        case mysqlshdk::db::Type::UInteger:
-          value_array.push_back(Value(row.get_uint(i)));
-          break;
-        case mysqlshdk::db::Type::Float:
-          value_array.push_back(Value(row.get_float(i)));
-          break;
-        case mysqlshdk::db::Type::Double:
-          value_array.push_back(Value(row.get_double(i)));
-          break;
-        case mysqlshdk::db::Type::Decimal:
-          value_array.push_back(Value(row.get_as_string(i)));
-          break;
-        case mysqlshdk::db::Type::Bytes:
-          value_array.push_back(Value(row.get_string(i)));
-          break;
-        case mysqlshdk::db::Type::Geometry:
-        case mysqlshdk::db::Type::Json:
-          value_array.push_back(Value(row.get_string(i)));
-          break;
-        case mysqlshdk::db::Type::Time:
-          value_array.push_back(Value(row.get_string(i)));
-          break;
-        case mysqlshdk::db::Type::Date:
-          value_array.push_back(Value(shcore::Date::unrepr(row.get_string(i))));
-          break;
-        case mysqlshdk::db::Type::DateTime:
-          value_array.push_back(Value(shcore::Date::unrepr(row.get_string(i))));
-          break;
-        case mysqlshdk::db::Type::Bit:
-          value_array.push_back(Value(row.get_bit(i)));
-          break;
-        case mysqlshdk::db::Type::Enum:
-        case mysqlshdk::db::Type::Set:
-          value_array.push_back(Value(row.get_string(i)));
-          break;
-      }
-    }
+  m_values.reserve(row.num_fields());
+
+  for (uint32_t i = 0, c = row.num_fields(); i < c; i++)
+    m_values.push_back(get_field_value(row, i));
+}
+
+Row::Row(std::shared_ptr<Row_fields> fields,
+         std::shared_ptr<const mysqlshdk::db::Row_buffer> buffer, size_t index)
+    : m_fields(fields),
+      m_values(fields->size()),
+      m_buffer(buffer),
+      m_buffer_index(index) {
+  add_property("length", "getLength");
+  add_method("getField", std::bind(&Row::get_field, this, _1), "field",
+             shcore::String);
+}
+
+const shcore::Value &Row::field(size_t index) const {
+  auto &value = m_values[index];
+
+  if (value.type == shcore::Undefined && m_buffer) {
+    // values read from the buffer are never Undefined
+    value = get_field_value(m_buffer->row(m_buffer_index),
+                            static_cast<uint32_t>(index));
   }
+
+  return value;
+}
+
+size_t Row::find_property(const std::string &prop,
+                          shcore::NamingStyle style) const {
+  const auto index = m_fields->find_property(prop, style);
+
+  // Fields with the same name as the base members like length and getField
+  // are not available as properties
+  if (index != std::string::npos &&
+      Cpp_object_bridge::has_member((*m_fields).names()[index]))
+    return std::string::npos;
+
+  return index;
 }
 
 std::string &Row::append_descr(std::string &s_out, int indent,
                                int UNUSED(quote_strings)) const {
   std::string nl = (indent >= 0) ? "\n" : "";
   s_out += "[";
-  for (size_t index = 0; index < value_array.size(); index++) {
+  for (size_t index = 0; index < m_values.size(); index++) {
     if (index > 0) s_out += ",";
 
     s_out += nl;
 
     if (indent >= 0) s_out.append((indent + 1) * 4, ' ');
 
-    value_array[index].append_descr(s_out, indent < 0 ? indent : indent + 1,
-                                    '"');
+    field(index).append_descr(s_out, indent < 0 ? indent : indent + 1, '"');
   }
 
   s_out += nl;
@@ -319,8 +379,19 @@ std::string &Row::append_descr(std::string &s_out, int indent,
 void Row::append_json(shcore::JSON_dumper &dumper) const {
   dumper.start_object();
 
-  for (size_t index = 0; index < value_array.size(); index++)
-    dumper.append_value(names->at(index), value_array[index]);
+  for (size_t index = 0; index < m_values.size(); index++)
+    dumper.append_value(m_fields->names().at(index), field(index));
+
+  dumper.end_object();
+}
+
+void Row::append_json(shcore::JSON_dumper &dumper,
+                      const std::vector<std::string> &names,
+                      const mysqlshdk::db::IRow &row) {
+  dumper.start_object();
+
+  for (uint32_t index = 0, count = row.num_fields(); index < count; index++)
+    dumper.append_value(names.at(index), get_field_value(row, index));
 
   dumper.end_object();
 }
@@ -358,9 +429,9 @@ shcore::Value Row::get_field(const shcore::Argument_list &args) {
 }
 
 shcore::Value Row::get_field_(const std::string &field) const {
-  auto iter = std::find(names->begin(), names->end(), field);
-  if (iter != names->end())
-    return value_array[iter - names->begin()];
+  const auto index = m_fields->find(field);
+  if (index != std::string::npos)
+    return this->field(index);
   else
     throw shcore::Exception::argument_error("Row.getField: Field " + field +
                                             " does not exist");
@@ -380,10 +451,10 @@ int Row::get_length() {}
 #endif
 shcore::Value Row::get_member(const std::string &prop) const {
   if (prop == "length") {
-    return shcore::Value((int)value_array.size());
+    return shcore::Value((int)m_values.size());
   } else {
-    auto it = std::find(names->begin(), names->end(), prop);
-    if (it != names->end()) return value_array[it - names->begin()];
+    const auto index = m_fields->find(prop);
+    if (index != std::string::npos) return field(index);
   }
 
   return shcore::Cpp_object_bridge::get_member(prop);
@@ -395,20 +466,51 @@ shcore::Value Row::get_member(const std::string &prop) const {
  */
 #endif
 shcore::Value Row::get_member(size_t index) const {
-  if (index < value_array.size())
-    return value_array[index];
+  if (index < m_values.size())
+    return field(index);
   else
     return shcore::Value();
 }
 
+std::vector<std::string> Row::get_members() const {
+  std::vector<std::string> members = Cpp_object_bridge::get_members();
+
+  // The fields are listed after the base properties, before the functions
+  auto position = members.begin() + _properties.size();
+
+  for (const auto &property : m_fields->properties()) {
+    if (!Cpp_object_bridge::has_member(property.second.base_name())) {
+      position = members.insert(position, property.second.name(naming_style));
+      ++position;
+    }
+  }
+
+  return members;
+}
+
+bool Row::has_member(const std::string &prop) const {
+  return Cpp_object_bridge::has_member(prop) ||
+         find_property(prop, shcore::LowerCamelCase) != std::string::npos;
+}
+
+bool Row::has_member_advanced(const std::string &prop,
+                              const shcore::NamingStyle &style) const {
+  return Cpp_object_bridge::has_member_advanced(prop, style) ||
+         find_property(prop, style) != std::string::npos;
+}
+
+shcore::Value Row::get_member_advanced(const std::string &prop,
+                                       const shcore::NamingStyle &style) const {
+  if (!Cpp_object_bridge::has_member_advanced(prop, style)) {
+    const auto index = find_property(prop, style);
+    if (index != std::string::npos) return field(index);
+  }
+
+  return Cpp_object_bridge::get_member_advanced(prop, style);
+}
+
 void Row::add_item(const std::string &key, shcore::Value value) {
   // All the values are available through index
-  value_array.push_back(value);
-  names->push_back(key);
-
-  // Values would be available as properties if they are valid identifier
-  // and not base members like lenght and getField
-  // O on this case the values would be available as
-  // row.property
-  if (shcore::is_valid_identifier(key) && !has_member(key)) add_property(key);
+  m_values.push_back(value);
+  m_fields->add(key);
 }
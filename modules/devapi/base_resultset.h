@@ -27,12 +27,15 @@
 #ifndef MODULES_DEVAPI_BASE_RESULTSET_H_
 #define MODULES_DEVAPI_BASE_RESULTSET_H_
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include "db/column.h"
 #include "db/row.h"
+#include "db/row_buffer.h"
 #include "modules/mod_common.h"
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
@@ -46,6 +49,28 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
   // Doing nothing by default to avoid impacting the classic result
   virtual void buffer() {}
   virtual bool rewind() { return false; }
+
+  // Appends the next unread row as a JSON value, returns false if there are
+  // no more rows
+  virtual bool append_json_row(shcore::JSON_dumper &dumper) const {
+    (void)dumper;
+    return false;
+  }
+
+  // Appending of the rows as JSON stops once the callback returns true, the
+  // rows which were not appended remain unread
+  void set_json_rows_interrupted(const std::function<bool()> &interrupted) {
+    _json_rows_interrupted = interrupted;
+  }
+
+ protected:
+  // Appends the unread rows as an array, flushing the dumper after each of
+  // them, so the rows are never held in memory as JSON text
+  void append_json_rows(shcore::JSON_dumper &dumper,
+                        const std::string &key) const;
+
+ private:
+  std::function<bool()> _json_rows_interrupted;
 };
 
 /**
@@ -271,6 +296,48 @@ class SHCORE_PUBLIC Column : public shcore::Cpp_object_bridge {
  * function.
  */
 
+/**
+ * Names of the fields of a Row, shared by all the rows of a result.
+ *
+ * Fields with a valid identifier as name are exposed as properties of the
+ * rows, their names on each naming style are computed once here instead of
+ * registering the properties on every row.
+ */
+class SHCORE_PUBLIC Row_fields {
+ public:
+  Row_fields() {}
+  explicit Row_fields(const std::vector<std::string> &names);
+
+  void add(const std::string &name);
+
+  const std::vector<std::string> &names() const { return m_names; }
+  size_t size() const { return m_names.size(); }
+
+  /**
+   * Returns the position of the field with the given name, or npos.
+   */
+  size_t find(const std::string &name) const;
+
+  /**
+   * Returns the position of the field exposed as the given property on the
+   * given naming style, or npos.
+   */
+  size_t find_property(const std::string &name,
+                       shcore::NamingStyle style) const;
+
+  /**
+   * Positions and names of the fields exposed as properties.
+   */
+  const std::vector<std::pair<size_t, shcore::Cpp_property_name>> &properties()
+      const {
+    return m_properties;
+  }
+
+ private:
+  std::vector<std::string> m_names;
+  std::vector<std::pair<size_t, shcore::Cpp_property_name>> m_properties;
+};
+
 class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
  public:
 #if DOXYGEN_JS
@@ -286,19 +353,27 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
 #endif
 
   Row();
-  Row(std::shared_ptr<std::vector<std::string>> names,
-      const mysqlshdk::db::IRow &row);
+  Row(std::shared_ptr<Row_fields> fields, const mysqlshdk::db::IRow &row);
 
-  virtual std::string class_name() const { return "Row"; }
+  /**
+   * Creates a row which refers to the row at the given position of the buffer,
+   * its fields are only converted into Values when they are accessed.
+   */
+  Row(std::shared_ptr<Row_fields> fields,
+      std::shared_ptr<const mysqlshdk::db::Row_buffer> buffer, size_t index);
 
-  std::shared_ptr<std::vector<std::string>> names;
-  std::vector<shcore::Value> value_array;
+  virtual std::string class_name() const { return "Row"; }
 
   virtual std::string &append_descr(std::string &s_out, int indent = -1,
                                     int quote_strings = 0) const;
   virtual std::string &append_repr(std::string &s_out) const;
   virtual void append_json(shcore::JSON_dumper &dumper) const;
 
+  // Same output as append_json() of a Row created from the given row
+  static void append_json(shcore::JSON_dumper &dumper,
+                          const std::vector<std::string> &names,
+                          const mysqlshdk::db::IRow &row);
+
   shcore::Value get_field(const shcore::Argument_list &args);
   shcore::Value get_field_(const std::string &field) const;
 
@@ -307,10 +382,28 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
   virtual shcore::Value get_member(const std::string &prop) const;
   shcore::Value get_member(size_t index) const;
 
-  size_t get_length() { return value_array.size(); }
+  virtual std::vector<std::string> get_members() const;
+  virtual bool has_member(const std::string &prop) const;
+  virtual bool has_member_advanced(const std::string &prop,
+                                   const shcore::NamingStyle &style) const;
+  virtual shcore::Value get_member_advanced(
+      const std::string &prop, const shcore::NamingStyle &style) const;
+
+  size_t get_length() const { return m_fields->size(); }
   virtual bool is_indexed() const { return true; }
 
   void add_item(const std::string &key, shcore::Value value);
+
+ private:
+  const shcore::Value &field(size_t index) const;
+  size_t find_property(const std::string &prop,
+                       shcore::NamingStyle style) const;
+
+  std::shared_ptr<Row_fields> m_fields;
+  // Undefined until converted when the row refers to a buffer
+  mutable std::vector<shcore::Value> m_values;
+  std::shared_ptr<const mysqlshdk::db::Row_buffer> m_buffer;
+  size_t m_buffer_index = 0;
 };
 }  // namespace mysqlsh
 
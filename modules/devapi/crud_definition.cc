@@ -57,6 +57,40 @@ Crud_definition::Crud_definition(std::shared_ptr<DatabaseObject> owner)
   }
 }
 
+Crud_definition::~Crud_definition() { reset_prepared_stmt(); }
+
+bool Crud_definition::should_prepare_stmt(
+    const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session,
+    std::string &&stmt) {
+  const auto connection_id = session->get_connection_id();
+
+  if (stmt != _stmt || connection_id != _stmt_connection_id) {
+    // the statement was modified or the session was reconnected
+    reset_prepared_stmt();
+    _stmt = std::move(stmt);
+    _stmt_connection_id = connection_id;
+  }
+
+  // the statement is prepared when it's executed for the second time
+  return ++_execution_count == 2 && session->supports_prepared_statements();
+}
+
+void Crud_definition::reset_prepared_stmt() {
+  if (_prep_stmt_id) {
+    const auto session = _prep_session.lock();
+
+    // statements are released by the server when the connection is closed
+    if (session && session->is_open() &&
+        session->get_connection_id() == _stmt_connection_id)
+      session->deallocate_stmt(_prep_stmt_id);
+
+    _prep_stmt_id = 0;
+    _prep_session.reset();
+  }
+
+  _execution_count = 0;
+}
+
 void Crud_definition::parse_string_list(const shcore::Argument_list &args,
                                         std::vector<std::string> &data) {
   // When there is 1 argument, it must be either an array of strings or a string
@@ -54,6 +54,7 @@ namespace mysqlx {
 class Crud_definition : public Dynamic_object {
  public:
   explicit Crud_definition(std::shared_ptr<DatabaseObject> owner);
+  ~Crud_definition() override;
 
   // The last step on CRUD operations
   virtual shcore::Value execute(const shcore::Argument_list &args) = 0;
@@ -65,6 +66,14 @@ class Crud_definition : public Dynamic_object {
   std::shared_ptr<Session> session();
   std::shared_ptr<DatabaseObject> _owner;
 
+  /**
+   * Executes the CRUD message. If the same statement is executed again and
+   * only the bound values changed, it is prepared on the server, following
+   * executions send just the values.
+   */
+  template <typename Message>
+  std::shared_ptr<mysqlshdk::db::IResult> execute_crud(Message *message);
+
   void parse_string_list(const shcore::Argument_list &args,
                          std::vector<std::string> &data);
 
@@ -89,7 +98,49 @@ class Crud_definition : public Dynamic_object {
           *target);
   void init_bound_values();
   void validate_bind_placeholder(const std::string &name);
+
+ private:
+  bool should_prepare_stmt(
+      const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session,
+      std::string &&stmt);
+  void reset_prepared_stmt();
+
+  // Serialized message (without bound values) of the last execution
+  std::string _stmt;
+  uint64_t _stmt_connection_id = 0;
+  uint64_t _execution_count = 0;
+  uint32_t _prep_stmt_id = 0;
+  std::weak_ptr<mysqlshdk::db::mysqlx::Session> _prep_session;
 };
+
+template <typename Message>
+std::shared_ptr<mysqlshdk::db::IResult> Crud_definition::execute_crud(
+    Message *message) {
+  const auto xsession =
+      std::static_pointer_cast<mysqlshdk::db::mysqlx::Session>(
+          session()->get_core_session());
+
+  // bound values are not part of the statement
+  ::google::protobuf::RepeatedPtrField<::Mysqlx::Datatypes::Scalar> args;
+  args.Swap(message->mutable_args());
+  const bool prepare =
+      should_prepare_stmt(xsession, message->SerializeAsString());
+  args.Swap(message->mutable_args());
+
+  if (prepare) {
+    const auto stmt_id = xsession->new_stmt_id();
+
+    if (xsession->prepare_stmt(stmt_id, *message)) {
+      _prep_stmt_id = stmt_id;
+      _prep_session = xsession;
+    }
+  }
+
+  if (_prep_stmt_id)
+    return xsession->execute_prep_stmt(_prep_stmt_id, message->args());
+  else
+    return xsession->execute_crud(*message);
+}
 }  // namespace mysqlx
 }  // namespace mysqlsh
 
@@ -243,12 +243,26 @@ REGISTER_HELP(COLLECTIONADD_EXECUTE_BRIEF,
               "Executes the add operation, the documents are added to the "
               "target collection.");
 REGISTER_HELP(COLLECTIONADD_EXECUTE_RETURNS, "@returns A Result object.");
+REGISTER_HELP(COLLECTIONADD_EXECUTE_DETAIL,
+              "If the documents do not fit into a single message of "
+              "<b>mysqlx_max_allowed_packet</b> bytes, they are sent in "
+              "several batches, without waiting for the previous ones to "
+              "complete. The returned Result reports the affected items and "
+              "generated IDs of all the batches.");
+REGISTER_HELP(COLLECTIONADD_EXECUTE_DETAIL1,
+              "If one of the batches fails, the following ones are not "
+              "executed, the documents added by the previous ones are kept "
+              "unless the operation is executed in a transaction.");
 
 /**
  * $(COLLECTIONADD_EXECUTE_BRIEF)
  *
  * $(COLLECTIONADD_EXECUTE_RETURNS)
  *
+ * $(COLLECTIONADD_EXECUTE_DETAIL)
+ *
+ * $(COLLECTIONADD_EXECUTE_DETAIL1)
+ *
  * #### Method Chaining
  *
  * This function can be invoked once after:
@@ -1355,8 +1355,8 @@ std::unique_ptr<DocResult> CollectionFind::execute() {
   mysqlshdk::utils::Profile_timer timer;
   insert_bound_values(message_.mutable_args());
   timer.stage_begin("CollectionFind::execute");
-  result.reset(new DocResult(safe_exec(
-      [this]() { return session()->session()->execute_crud(message_); })));
+  result.reset(new DocResult(
+      safe_exec([this]() { return execute_crud(&message_); })));
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_ellapsed());
 
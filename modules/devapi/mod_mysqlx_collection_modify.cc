@@ -1260,8 +1260,8 @@ shcore::Value CollectionModify::execute() {
   mysqlshdk::utils::Profile_timer timer;
   insert_bound_values(message_.mutable_args());
   timer.stage_begin("CollectionModify::execute");
-  result.reset(new mysqlx::Result(safe_exec(
-      [this]() { return session()->session()->execute_crud(message_); })));
+  result.reset(new mysqlx::Result(
+      safe_exec([this]() { return execute_crud(&message_); })));
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_ellapsed());
 
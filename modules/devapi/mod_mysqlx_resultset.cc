@@ -66,7 +66,7 @@ void BaseResult::buffer() {
     _result->stop_pre_fetch();
     return false;
   });
-  _result->pre_fetch_rows(true);
+  _result->pre_fetch_rows();
 }
 
 bool BaseResult::rewind() {
@@ -552,7 +552,7 @@ shcore::Value DocResult::fetch_one(const shcore::Argument_list &args) const {
   try {
     if (_result) {
       if (const mysqlshdk::db::IRow *r = _result->fetch_one()) {
-        ret_val = Value::parse(r->get_string(0));
+        ret_val = Value::parse_json(r->get_string(0));
       }
     }
   }
@@ -620,13 +620,21 @@ shcore::Value DocResult::get_metadata() const {
 void DocResult::append_json(shcore::JSON_dumper &dumper) const {
   dumper.start_object();
 
-  dumper.append_value("documents", fetch_all(shcore::Argument_list()));
+  append_json_rows(dumper, "documents");
 
   BaseResult::append_json(dumper);
 
   dumper.end_object();
 }
 
+bool DocResult::append_json_row(shcore::JSON_dumper &dumper) const {
+  const mysqlshdk::db::IRow *row = _result ? _result->fetch_one() : nullptr;
+  if (!row) return false;
+
+  dumper.append_value(Value::parse_json(row->get_string(0)));
+  return true;
+}
+
 // -----------------------------------------------------------------------
 
 // Documentation of RowResult class
@@ -644,9 +652,9 @@ RowResult::RowResult(std::shared_ptr<mysqlshdk::db::mysqlx::Result> result)
   add_method("fetchOne", std::bind(&RowResult::fetch_one, this, _1));
   add_method("fetchAll", std::bind(&RowResult::fetch_all, this, _1));
 
-  _column_names.reset(new std::vector<std::string>());
+  _column_names.reset(new Row_fields());
   for (auto &cmd : _result->get_metadata())
-    _column_names->push_back(cmd.get_column_label());
+    _column_names->add(cmd.get_column_label());
 }
 
 shcore::Value RowResult::get_member(const std::string &prop) const {
@@ -712,7 +720,7 @@ List RowResult::getColumnNames() {}
 list RowResult::get_column_names() {}
 #endif
 std::vector<std::string> RowResult::get_column_names() const {
-  return *_column_names;
+  return _column_names->names();
 }
 
 // Documentation of getColumns function
@@ -879,12 +887,20 @@ shcore::Value RowResult::fetch_all(const shcore::Argument_list &args) const {
 
   args.ensure_count(0, get_function_name("fetchAll").c_str());
 
-  // Gets the next row
-  Value record = fetch_one(args);
-  while (record) {
-    array->push_back(record);
-    record = fetch_one(args);
+  try {
+    if (_result) {
+      // The rows refer to the buffer of the result, fields are only
+      // converted when accessed
+      const auto rows = _result->fetch_all_buffered();
+      const auto &buffer = rows.first;
+
+      array->reserve(buffer->size() - rows.second);
+
+      for (size_t index = rows.second; index < buffer->size(); ++index)
+        array->push_back(Value::wrap(new Row(_column_names, buffer, index)));
+    }
   }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("fetchAll"));
 
   return Value(array);
 }
@@ -896,11 +912,19 @@ void RowResult::append_json(shcore::JSON_dumper &dumper) const {
 
   BaseResult::append_json(dumper);
 
-  dumper.append_value("rows", fetch_all(shcore::Argument_list()));
+  append_json_rows(dumper, "rows");
 
   if (create_object) dumper.end_object();
 }
 
+bool RowResult::append_json_row(shcore::JSON_dumper &dumper) const {
+  const mysqlshdk::db::IRow *row = _result ? _result->fetch_one() : nullptr;
+  if (!row) return false;
+
+  mysqlsh::Row::append_json(dumper, _column_names->names(), *row);
+  return true;
+}
+
 // Documentation of SqlResult class
 REGISTER_HELP_SUB_CLASS(SqlResult, mysqlx, RowResult);
 REGISTER_HELP(SQLRESULT_BRIEF,
@@ -176,6 +176,7 @@ class SHCORE_PUBLIC DocResult : public BaseResult {
 
   virtual std::string class_name() const { return "DocResult"; }
   virtual void append_json(shcore::JSON_dumper &dumper) const;
+  bool append_json_row(shcore::JSON_dumper &dumper) const override;
 
   shcore::Value get_metadata() const;
 
@@ -206,6 +207,7 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
 
   virtual std::string class_name() const { return "RowResult"; }
   virtual void append_json(shcore::JSON_dumper &dumper) const;
+  bool append_json_row(shcore::JSON_dumper &dumper) const override;
 
   // C++ Interface
   int64_t get_column_count() const;
@@ -237,7 +239,7 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
 #endif
 
  private:
-  std::shared_ptr<std::vector<std::string>> _column_names;
+  std::shared_ptr<Row_fields> _column_names;
   mutable shcore::Value::Array_type_ref _columns;
 };
 
@@ -345,11 +345,25 @@ REGISTER_HELP(TABLEINSERT_EXECUTE_BRIEF, "Executes the insert operation.");
 REGISTER_HELP(TABLEINSERT_EXECUTE_RETURNS,
               "@returns A <b>Result</b> object that can be used to retrieve "
               "the results ofoperation.");
+REGISTER_HELP(TABLEINSERT_EXECUTE_DETAIL,
+              "If the rows do not fit into a single message of "
+              "<b>mysqlx_max_allowed_packet</b> bytes, they are sent in "
+              "several batches, without waiting for the previous ones to "
+              "complete. The returned Result reports the affected items of "
+              "all the batches.");
+REGISTER_HELP(TABLEINSERT_EXECUTE_DETAIL1,
+              "If one of the batches fails, the following ones are not "
+              "executed, the rows inserted by the previous ones are kept "
+              "unless the operation is executed in a transaction.");
 /**
  * $(TABLEINSERT_EXECUTE_BRIEF)
  *
  * $(TABLEINSERT_EXECUTE_RETURNS)
  *
+ * $(TABLEINSERT_EXECUTE_DETAIL)
+ *
+ * $(TABLEINSERT_EXECUTE_DETAIL1)
+ *
  * #### Method Chaining
  *
  * This function can be invoked after:
@@ -74,9 +74,9 @@ ClassicResult::ClassicResult(
   add_method("nextResult", std::bind(&ClassicResult::next_result, this, _1));
   add_method("hasData", std::bind(&ClassicResult::has_data, this, _1));
 
-  _column_names.reset(new std::vector<std::string>());
+  _column_names.reset(new Row_fields());
   for (auto &cmd : _result->get_metadata())
-    _column_names->push_back(cmd.get_column_label());
+    _column_names->add(cmd.get_column_label());
 }
 
 // Documentation of the hasData function
@@ -247,12 +247,24 @@ shcore::Value ClassicResult::fetch_all(
   std::shared_ptr<shcore::Value::Array_type> array(
       new shcore::Value::Array_type);
 
-  shcore::Value record = fetch_one(args);
+  try {
+    if (_result) {
+      // The rows refer to a buffer shared by all of them, fields are only
+      // converted when accessed
+      auto buffer = std::make_shared<mysqlshdk::db::Row_buffer>();
+
+      while (const mysqlshdk::db::IRow *row = _result->fetch_one())
+        buffer->append(*row);
 
-  while (record) {
-    array->push_back(record);
-    record = fetch_one(args);
+      array->reserve(buffer->size());
+
+      for (size_t index = 0; index < buffer->size(); ++index) {
+        array->push_back(shcore::Value::wrap(
+            new mysqlsh::Row(_column_names, buffer, index)));
+      }
+    }
   }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("fetchAll"));
 
   return shcore::Value(array);
 }
@@ -897,7 +909,7 @@ void ClassicResult::append_json(shcore::JSON_dumper &dumper) const {
   dumper.append_value("executionTime", get_member("executionTime"));
 
   dumper.append_value("info", get_member("info"));
-  dumper.append_value("rows", fetch_all(shcore::Argument_list()));
+  append_json_rows(dumper, "rows");
 
   if (mysqlsh::current_shell_options()->get().show_warnings) {
     dumper.append_value("warningCount", get_member("warningsCount"));
@@ -912,3 +924,11 @@ void ClassicResult::append_json(shcore::JSON_dumper &dumper) const {
 
   dumper.end_object();
 }
+
+bool ClassicResult::append_json_row(shcore::JSON_dumper &dumper) const {
+  const mysqlshdk::db::IRow *row = _result ? _result->fetch_one() : nullptr;
+  if (!row) return false;
+
+  mysqlsh::Row::append_json(dumper, _column_names->names(), *row);
+  return true;
+}
@@ -141,6 +141,7 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   virtual std::string class_name() const { return "ClassicResult"; }
   virtual shcore::Value get_member(const std::string &prop) const;
   virtual void append_json(shcore::JSON_dumper &dumper) const;
+  bool append_json_row(shcore::JSON_dumper &dumper) const override;
 
   shcore::Value has_data(const shcore::Argument_list &args) const;
   virtual shcore::Value fetch_one(const shcore::Argument_list &args) const;
@@ -157,7 +158,7 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
  private:
   std::shared_ptr<mysqlshdk::db::mysql::Result> _result;
   double _execution_time;
-  std::shared_ptr<std::vector<std::string>> _column_names;
+  std::shared_ptr<Row_fields> _column_names;
   mutable shcore::Value::Array_type_ref _columns;
 };
 }  // namespace mysql
@@ -32,6 +32,7 @@
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/db/session_pool.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/shellcore/credential_manager.h"
@@ -443,4 +444,20 @@ std::shared_ptr<mysqlshdk::db::ISession> establish_mysql_session(
   return establish_session(copy, prompt_for_password, prompt_in_loop);
 }
 
+std::shared_ptr<mysqlshdk::db::ISession> establish_pooled_mysql_session(
+    const Connection_options &options, bool prompt_for_password) {
+  Connection_options copy = options;
+
+  if (copy.has_scheme()) {
+    copy.clear_scheme();
+  }
+
+  copy.set_scheme("mysql");
+
+  return mysqlshdk::db::Session_pool::get()->acquire(
+      copy, [prompt_for_password](const Connection_options &opts) {
+        return establish_session(opts, prompt_for_password);
+      });
+}
+
 }  // namespace mysqlsh
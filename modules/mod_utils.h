@@ -159,6 +159,23 @@ std::shared_ptr<mysqlshdk::db::ISession> SHCORE_PUBLIC
 establish_mysql_session(const Connection_options &options,
                         bool prompt_for_password, bool prompt_in_loop = false);
 
+/**
+ * Same as establish_mysql_session(), but the session is borrowed from the
+ * shared mysqlshdk::db::Session_pool. The session is returned to the pool
+ * once the last reference to it is released, it should not be closed by the
+ * caller.
+ *
+ * @param options Connection options used to establish a session.
+ * @param prompt_for_password If true and password is missing will prompt the
+ *        user for password.
+ *
+ * @return A session object connected to the server specified by connection
+ *         options.
+ */
+std::shared_ptr<mysqlshdk::db::ISession> SHCORE_PUBLIC
+establish_pooled_mysql_session(const Connection_options &options,
+                               bool prompt_for_password);
+
 }  // namespace mysqlsh
 
 #endif  // MODULES_MOD_UTILS_H_
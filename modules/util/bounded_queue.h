@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_BOUNDED_QUEUE_H_
+#define MODULES_UTIL_BOUNDED_QUEUE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace mysqlsh {
+
+/**
+ * Bounded blocking queue of chunks shared by the reader and import workers.
+ */
+template <class Chunk>
+class Bounded_queue {
+ public:
+  explicit Bounded_queue(size_t capacity) : m_capacity(capacity) {}
+
+  /**
+   * Add chunk to the queue, blocks while queue is full.
+   *
+   * @return false if queue was shut down and chunk was discarded.
+   */
+  bool push(Chunk &&chunk) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_not_full.wait(
+        lock, [this]() { return m_shutdown || m_chunks.size() < m_capacity; });
+    if (m_shutdown) return false;
+    m_chunks.emplace_back(std::move(chunk));
+    m_not_empty.notify_one();
+    return true;
+  }
+
+  /**
+   * Take chunk from the queue, blocks while queue is empty.
+   *
+   * @return false if queue was shut down.
+   */
+  bool pop(Chunk *out_chunk) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_not_empty.wait(lock,
+                     [this]() { return m_shutdown || !m_chunks.empty(); });
+    if (m_shutdown) return false;
+    *out_chunk = std::move(m_chunks.front());
+    m_chunks.pop_front();
+    m_not_full.notify_one();
+    return true;
+  }
+
+  /**
+   * Wake up all waiting threads, used to abort import on error.
+   */
+  void shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+    m_not_full.notify_all();
+    m_not_empty.notify_all();
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_not_full;
+  std::condition_variable m_not_empty;
+  std::deque<Chunk> m_chunks;
+  const size_t m_capacity;
+  bool m_shutdown = false;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_BOUNDED_QUEUE_H_
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include "modules/util/compare_table.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "modules/util/table_chunks.h"
+#include "modules/util/worker_threads.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/utils/diff.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "shellcore/interrupt_handler.h"
+
+namespace mysqlsh {
+
+/*
+ * Only this many different rows are printed, the remaining ones are counted.
+ */
+static constexpr const size_t k_max_reported_rows = 100;
+
+namespace {
+
+using table_chunks::is_ordered_as_number;
+using table_chunks::quote;
+
+bool is_character_string_type(const std::string &data_type) {
+  return data_type == "char" || data_type == "varchar" ||
+         data_type == "tinytext" || data_type == "text" ||
+         data_type == "mediumtext" || data_type == "longtext";
+}
+
+}  // namespace
+
+std::string checksum_expression(const std::vector<std::string> &columns) {
+  std::vector<std::string> values;
+  std::vector<std::string> nulls;
+
+  for (const auto &column : columns) {
+    const auto quoted = quote(column);
+    values.emplace_back("CHAR_LENGTH(" + quoted + ")");
+    values.emplace_back(quoted);
+    nulls.emplace_back("ISNULL(" + quoted + ")");
+  }
+
+  // CONCAT_WS() skips NULL values, their positions are appended separately
+  return "BIT_XOR(CAST(CRC32(CONCAT_WS('#', " + shcore::str_join(values, ", ") +
+         ", CONCAT(" + shcore::str_join(nulls, ", ") + "))) AS UNSIGNED))";
+}
+
+std::string key_order_expression(const std::string &column,
+                                 const std::string &data_type) {
+  if (is_character_string_type(data_type)) {
+    return "WEIGHT_STRING(" + quote(column) + ")";
+  }
+  if (is_ordered_as_number(data_type)) return quote(column) + " + 0";
+  return quote(column);
+}
+
+Compare_table::Compare_table(
+    const std::vector<mysqlshdk::db::Connection_options> &instances,
+    const std::string &schema, const std::string &table)
+    : m_instances(instances), m_schema(schema), m_table(table) {
+  if (m_instances.size() < 2) {
+    throw std::invalid_argument(
+        "At least two instances are required to compare a table.");
+  }
+}
+
+void Compare_table::set_threads(int threads) {
+  validate_threads(threads);
+  m_threads = threads;
+}
+
+void Compare_table::set_rows_per_chunk(uint64_t rows) {
+  if (rows < 1) {
+    throw std::invalid_argument(
+        "Number of rows per chunk must be a positive integer value.");
+  }
+  m_rows_per_chunk = rows;
+}
+
+void Compare_table::set_print_callback(
+    const std::function<void(const std::string &)> &callback) {
+  m_print = callback;
+}
+
+void Compare_table::print_stats() {
+  using mysqlshdk::utils::format_seconds;
+  using mysqlshdk::utils::format_throughput_items;
+
+  m_stats.timer.stage_end();
+  double compare_time_seconds = m_stats.timer.total_seconds_ellapsed();
+
+  if (m_print) {
+    std::string msg =
+        "\nCompared " + std::to_string(m_stats.rows_checked) +
+        (m_stats.rows_checked == 1 ? " row" : " rows") + " in " +
+        std::to_string(m_chunks.size()) +
+        (m_chunks.size() == 1 ? " chunk" : " chunks") + " on " +
+        std::to_string(m_instances.size()) + " instances in " +
+        format_seconds(compare_time_seconds) + " (" +
+        format_throughput_items("row", "rows", m_stats.rows_checked,
+                                compare_time_seconds) +
+        ")\n";
+
+    if (m_stats.chunks_mismatched == 0) {
+      msg += "Table `" + m_schema + "`.`" + m_table +
+             "` is identical on all instances.\n";
+    } else {
+      msg += std::to_string(m_stats.chunks_mismatched) +
+             (m_stats.chunks_mismatched == 1 ? " chunk" : " chunks") +
+             " with a different checksum, " +
+             std::to_string(m_stats.rows_different) + " different " +
+             (m_stats.rows_different == 1 ? "row" : "rows") + " found.\n";
+    }
+
+    m_print(msg);
+  }
+}
+
+std::string Compare_table::instance_name(size_t instance) const {
+  return m_instances[instance].as_uri(
+      mysqlshdk::db::uri::formats::only_transport());
+}
+
+Compare_table::Session_ptr Compare_table::connect_session(
+    size_t instance) const {
+  auto session = mysqlshdk::db::mysql::Session::create();
+  session->connect(m_instances[instance]);
+  // values are converted to strings the same way on all instances
+  session->execute("SET NAMES 'utf8mb4'");
+  session->execute("SET TIME_ZONE = '+00:00'");
+  return session;
+}
+
+std::string Compare_table::chunk_query(const std::string &select_list,
+                                       size_t chunk) const {
+  std::string query = shcore::sqlstring("SELECT " + select_list + " FROM !.!",
+                                        0)
+                      << m_schema << m_table;
+  if (!m_chunks[chunk].empty()) query += " WHERE " + m_chunks[chunk];
+  return query;
+}
+
+bool Compare_table::run() {
+  m_stats.timer.stage_begin("comparing");
+
+  shcore::Interrupt_handler intr_handler([this]() -> bool {
+    m_interrupted = true;
+    return false;
+  });
+
+  std::vector<std::vector<Session_ptr>> workers(1);
+  for (size_t i = 0; i < m_instances.size(); ++i) {
+    workers[0].emplace_back(connect_session(i));
+  }
+
+  read_table(workers[0]);
+  create_chunks(workers[0]);
+
+  const size_t tasks = m_chunks.size() * m_instances.size();
+  while (workers.size() < std::min<size_t>(m_threads, tasks)) {
+    std::vector<Session_ptr> sessions;
+    for (size_t i = 0; i < m_instances.size(); ++i) {
+      sessions.emplace_back(connect_session(i));
+    }
+    workers.emplace_back(std::move(sessions));
+  }
+
+  if (m_print) {
+    m_print("Computing checksums of " + std::to_string(m_chunks.size()) +
+            (m_chunks.size() == 1 ? " chunk" : " chunks") + " using " +
+            std::to_string(workers.size()) +
+            (workers.size() == 1 ? " thread" : " threads") + "...\n");
+  }
+
+  compute_checksums(workers);
+
+  const size_t instances = m_instances.size();
+
+  for (size_t c = 0; c < m_chunks.size(); ++c) {
+    bool mismatched = false;
+
+    for (size_t i = 1; i < instances; ++i) {
+      if (m_checksums[c * instances + i] == m_checksums[c * instances]) {
+        continue;
+      }
+
+      mismatched = true;
+      compare_chunk(workers[0], c, i);
+
+      if (m_interrupted) throw shcore::cancelled("Comparison cancelled.");
+    }
+
+    if (mismatched) ++m_stats.chunks_mismatched;
+  }
+
+  if (m_stats.rows_different > m_stats.rows_reported && m_print) {
+    m_print("... and " +
+            std::to_string(m_stats.rows_different - m_stats.rows_reported) +
+            " more different rows\n");
+  }
+
+  return 0 == m_stats.rows_different;
+}
+
+void Compare_table::read_table(const std::vector<Session_ptr> &sessions) {
+  const auto full_name = "`" + m_schema + "`.`" + m_table + "`";
+  std::string reference_definition;
+  std::vector<std::string> data_types;
+
+  for (size_t i = 0; i < sessions.size(); ++i) {
+    auto result = sessions[i]->query(
+        shcore::sqlstring("SELECT COLUMN_NAME, COLUMN_TYPE, DATA_TYPE "
+                          "FROM information_schema.columns WHERE "
+                          "TABLE_SCHEMA = ? AND TABLE_NAME = ? "
+                          "ORDER BY ORDINAL_POSITION",
+                          0)
+        << m_schema << m_table);
+
+    std::string definition;
+    while (const auto row = result->fetch_one()) {
+      definition += row->get_string(0) + " " + row->get_string(1) + "\n";
+
+      if (0 == i) {
+        m_columns.emplace_back(row->get_string(0));
+        data_types.emplace_back(shcore::str_lower(row->get_string(2)));
+      }
+    }
+
+    if (definition.empty()) {
+      throw shcore::Exception::runtime_error("Table " + full_name +
+                                             " does not exist on " +
+                                             instance_name(i) + ".");
+    }
+
+    if (0 == i) {
+      reference_definition = std::move(definition);
+    } else if (definition != reference_definition) {
+      throw shcore::Exception::runtime_error(
+          "Columns of table " + full_name + " on " + instance_name(i) +
+          " differ from the ones on " + instance_name(0) + ".");
+    }
+  }
+
+  auto result = sessions[0]->query(
+      shcore::sqlstring("SELECT COLUMN_NAME FROM information_schema.statistics "
+                        "WHERE TABLE_SCHEMA = ? AND TABLE_NAME = ? AND "
+                        "INDEX_NAME = 'PRIMARY' ORDER BY SEQ_IN_INDEX",
+                        0)
+      << m_schema << m_table);
+
+  std::vector<std::string> order_by;
+
+  while (const auto row = result->fetch_one()) {
+    const auto column = row->get_string(0);
+    const auto position =
+        std::find(m_columns.begin(), m_columns.end(), column) -
+        m_columns.begin();
+
+    m_key_fields.emplace_back(static_cast<uint32_t>(m_key.size()));
+    m_key_value_fields.emplace_back(static_cast<uint32_t>(position));
+    m_key.emplace_back(column);
+    m_key_types.emplace_back(data_types[position]);
+    order_by.emplace_back(quote(column));
+  }
+
+  if (m_key.empty()) {
+    throw shcore::Exception::runtime_error(
+        "Table " + full_name +
+        " has no primary key, it is required to compare the rows.");
+  }
+
+  // key columns are fetched first, followed by the values of all the columns
+  for (auto &field : m_key_value_fields) {
+    field += static_cast<uint32_t>(m_key.size());
+  }
+
+  m_compared_columns = m_key;
+  m_compared_columns.insert(m_compared_columns.end(), m_columns.begin(),
+                            m_columns.end());
+  m_order_by = shcore::str_join(order_by, ", ");
+}
+
+void Compare_table::create_chunks(const std::vector<Session_ptr> &sessions) {
+  // the key is walked on the first instance, the first and the last chunk are
+  // open ended, so that they cover the rows of all instances
+  const auto boundaries =
+      table_chunks::walk_key(sessions[0].get(), m_schema, m_table, m_key,
+                             m_key_types, m_rows_per_chunk, m_interrupted);
+
+  if (m_interrupted) throw shcore::cancelled("Comparison cancelled.");
+
+  m_chunks = table_chunks::split_on_boundaries(m_key, boundaries);
+}
+
+void Compare_table::compute_checksums(
+    const std::vector<std::vector<Session_ptr>> &workers) {
+  const size_t instances = m_instances.size();
+  const size_t tasks = m_chunks.size() * instances;
+  const auto select_list = "COUNT(*), " + checksum_expression(m_columns);
+  std::atomic<size_t> next{0};
+
+  m_checksums.assign(tasks, Checksum());
+
+  Worker_threads threads(&m_interrupted);
+  for (size_t w = 0; w < workers.size(); ++w) {
+    threads.start([&, w]() {
+      size_t i;
+      while (!m_interrupted && (i = next++) < tasks) {
+        const auto result = workers[w][i % instances]->query(
+            chunk_query(select_list, i / instances));
+        if (const auto row = result->fetch_one()) {
+          m_checksums[i].rows = row->get_uint(0);
+          m_checksums[i].value = row->get_as_string(1);
+        }
+      }
+    });
+  }
+
+  threads.wait();
+
+  if (m_interrupted) throw shcore::cancelled("Comparison cancelled.");
+
+  for (size_t c = 0; c < m_chunks.size(); ++c) {
+    m_stats.rows_checked += m_checksums[c * instances].rows;
+  }
+}
+
+void Compare_table::compare_chunk(const std::vector<Session_ptr> &sessions,
+                                  size_t chunk, size_t instance) {
+  using mysqlshdk::db::IRow;
+  using mysqlshdk::db::Row_difference;
+
+  std::vector<std::string> select_list;
+  for (size_t k = 0; k < m_key.size(); ++k) {
+    select_list.emplace_back(key_order_expression(m_key[k], m_key_types[k]));
+  }
+  for (const auto &column : m_columns) {
+    select_list.emplace_back(quote(column));
+  }
+
+  const auto query = chunk_query(shcore::str_join(select_list, ", "), chunk) +
+                     " ORDER BY " + m_order_by;
+  const auto name = instance_name(instance);
+  const size_t rows_different = m_stats.rows_different;
+
+  // rows of both instances are streamed and merged by the primary key
+  const auto left = sessions[0]->query(query);
+  const auto right = sessions[instance]->query(query);
+
+  const auto key = [this](const IRow &row) {
+    std::vector<std::string> values;
+    for (const auto field : m_key_value_fields) {
+      values.emplace_back(m_compared_columns[field] + "=" +
+                          row.get_as_string(field));
+    }
+    return "Row (" + shcore::str_join(values, ", ") + ")";
+  };
+
+  try {
+    mysqlshdk::db::find_different_rows_with_key_indexes(
+        left.get(), right.get(), m_key_fields,
+        [&](const IRow *lrow, const IRow *rrow, Row_difference difference) {
+          ++m_stats.rows_different;
+
+          switch (difference) {
+            case Row_difference::Row_missing:
+              report_difference(key(*lrow) + " is missing on " + name);
+              break;
+
+            case Row_difference::Row_added:
+              report_difference(key(*rrow) + " exists only on " + name);
+              break;
+
+            case Row_difference::Fields_differ: {
+              std::vector<std::string> columns;
+              mysqlshdk::db::find_different_row_fields(
+                  *lrow, *rrow, [&columns, this](int field) {
+                    columns.emplace_back(m_compared_columns[field]);
+                    return true;
+                  });
+              report_difference(key(*lrow) + " differs on " + name + " (" +
+                                shcore::str_join(columns, ", ") + ")");
+              break;
+            }
+
+            case Row_difference::Identical:
+              break;
+          }
+
+          return !m_interrupted;
+        });
+  } catch (const std::invalid_argument &e) {
+    throw shcore::Exception::runtime_error(
+        "Failed to compare rows of table `" + m_schema + "`.`" + m_table +
+        "` on " + name + ": " + e.what());
+  }
+
+  if (rows_different == m_stats.rows_different && m_print) {
+    // checksums and rows are read at different times
+    m_print("Chunk " + std::to_string(chunk) + " had a different checksum on " +
+            name + ", but its rows are the same, it was modified during the "
+            "comparison\n");
+  }
+}
+
+void Compare_table::report_difference(const std::string &message) {
+  if (m_stats.rows_reported < k_max_reported_rows && m_print) {
+    ++m_stats.rows_reported;
+    m_print(message + "\n");
+  }
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef MODULES_UTIL_COMPARE_TABLE_H_
+#define MODULES_UTIL_COMPARE_TABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/utils/profiling.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+class Session;
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
+
+namespace mysqlsh {
+
+/**
+ * Builds an expression which computes checksum of the rows matching the
+ * query: XOR of CRC32 of the values of all columns and their NULL flags.
+ * Each value is preceded by its length, so that values containing the
+ * separator do not produce the same checksum as the ones split differently.
+ */
+std::string checksum_expression(const std::vector<std::string> &columns);
+
+/**
+ * Returns an expression which is fetched to merge the rows on the given
+ * primary key column. Its values have to be compared by the client in the
+ * same order as the one in which the server sorts the column: character
+ * strings are compared using weights of their collation, ENUM, SET and BIT
+ * values using their numeric values.
+ */
+std::string key_order_expression(const std::string &column,
+                                 const std::string &data_type);
+
+/**
+ * Compares contents of a table on multiple instances.
+ *
+ * Table is split into chunks on the ranges of its primary key, boundaries of
+ * the chunks are found by walking the key on the first instance. Checksum of
+ * each chunk is computed by the server, on all instances in parallel, rows
+ * are fetched and compared only for the chunks which have a different
+ * checksum than the one on the first instance.
+ */
+class Compare_table {
+ public:
+  Compare_table(
+      const std::vector<mysqlshdk::db::Connection_options> &instances,
+      const std::string &schema, const std::string &table);
+  ~Compare_table() {}
+
+  /**
+   * Set number of parallel workers, each one has a session to every instance.
+   *
+   * @param threads Number of worker threads, must be greater than 0.
+   */
+  void set_threads(int threads);
+
+  /**
+   * Set number of rows in a chunk, as found on the first instance.
+   */
+  void set_rows_per_chunk(uint64_t rows);
+
+  void set_print_callback(
+      const std::function<void(const std::string &)> &callback);
+
+  /**
+   * Compares the table, returns true if it is the same on all instances.
+   */
+  bool run();
+
+  void print_stats();
+
+ private:
+  struct Checksum {
+    uint64_t rows = 0;
+    std::string value;
+
+    bool operator==(const Checksum &other) const {
+      return rows == other.rows && value == other.value;
+    }
+  };
+
+  using Session_ptr = std::shared_ptr<mysqlshdk::db::mysql::Session>;
+
+  Session_ptr connect_session(size_t instance) const;
+  void read_table(const std::vector<Session_ptr> &sessions);
+  void create_chunks(const std::vector<Session_ptr> &sessions);
+  void compute_checksums(const std::vector<std::vector<Session_ptr>> &workers);
+  void compare_chunk(const std::vector<Session_ptr> &sessions, size_t chunk,
+                     size_t instance);
+  void report_difference(const std::string &message);
+
+  std::string instance_name(size_t instance) const;
+  std::string chunk_query(const std::string &select_list, size_t chunk) const;
+
+  std::function<void(const std::string &)> m_print = nullptr;
+
+  std::vector<mysqlshdk::db::Connection_options> m_instances;
+  std::string m_schema;
+  std::string m_table;
+  int m_threads = 4;
+  uint64_t m_rows_per_chunk = 100000;
+  std::atomic<bool> m_interrupted{false};
+
+  std::vector<std::string> m_columns;
+  /// Primary key columns, in the order of the key.
+  std::vector<std::string> m_key;
+  /// DATA_TYPE of each of the primary key columns.
+  std::vector<std::string> m_key_types;
+  /// Names of the fields fetched to compare the rows: key_order_expression()
+  /// of each primary key column, followed by all the columns.
+  std::vector<std::string> m_compared_columns;
+  /// Positions of the key_order_expression() fields, rows are merged on them.
+  std::vector<uint32_t> m_key_fields;
+  /// Positions of the values of the primary key columns.
+  std::vector<uint32_t> m_key_value_fields;
+  /// Primary key columns, rows are sorted on them using the index.
+  std::string m_order_by;
+
+  /// Range of each chunk, empty if table is compared as a single chunk.
+  std::vector<std::string> m_chunks;
+  /// Checksums of chunks, m_instances.size() per chunk.
+  std::vector<Checksum> m_checksums;
+
+  struct {
+    uint64_t rows_checked = 0;
+    size_t chunks_mismatched = 0;
+    size_t rows_different = 0;
+    size_t rows_reported = 0;
+    mysqlshdk::utils::Profile_timer timer;
+  } m_stats;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_TABLE_H_
@@ -0,0 +1,698 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump_schemas.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#include "modules/util/table_chunks.h"
+#include "modules/util/worker_threads.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "shellcore/interrupt_handler.h"
+
+namespace mysqlsh {
+
+/*
+ * Rows are escaped to this buffer, which is written to the file once it
+ * reaches this size.
+ */
+static constexpr const size_t k_write_buffer_bytes = 1024 * 1024;
+
+#ifdef HAVE_ZLIB
+static constexpr const Dump_schemas::Compression k_default_compression =
+    Dump_schemas::Compression::GZIP;
+#else
+static constexpr const Dump_schemas::Compression k_default_compression =
+    Dump_schemas::Compression::NONE;
+#endif
+
+namespace {
+
+/**
+ * Data file of a single chunk, optionally gzip compressed.
+ */
+class Output_file {
+ public:
+  Output_file(const std::string &path, Dump_schemas::Compression compression)
+      : m_path(path) {
+#ifdef HAVE_ZLIB
+    if (Dump_schemas::Compression::GZIP == compression) {
+      // best speed, dump is usually limited by compression
+      m_gz_file = gzopen(path.c_str(), "wb1");
+      if (!m_gz_file) throw_error("open");
+      gzbuffer(m_gz_file, k_write_buffer_bytes);
+      return;
+    }
+#endif
+    m_file = fopen(path.c_str(), "wb");
+    if (!m_file) throw_error("open");
+  }
+
+  Output_file(const Output_file &) = delete;
+  Output_file &operator=(const Output_file &) = delete;
+
+  ~Output_file() {
+    try {
+      close();
+    } catch (...) {
+    }
+  }
+
+  void write(const std::string &data) {
+    if (data.empty()) return;
+#ifdef HAVE_ZLIB
+    if (m_gz_file) {
+      if (gzwrite(m_gz_file, data.data(), data.size()) !=
+          static_cast<int>(data.size())) {
+        throw_error("write to");
+      }
+      return;
+    }
+#endif
+    if (fwrite(data.data(), 1, data.size(), m_file) != data.size()) {
+      throw_error("write to");
+    }
+  }
+
+  void close() {
+#ifdef HAVE_ZLIB
+    if (m_gz_file) {
+      const auto result = gzclose(m_gz_file);
+      m_gz_file = nullptr;
+      if (Z_OK != result) throw_error("close");
+    }
+#endif
+    if (m_file) {
+      const auto result = fclose(m_file);
+      m_file = nullptr;
+      if (0 != result) throw_error("close");
+    }
+  }
+
+ private:
+  void throw_error(const char *operation) const {
+    throw std::runtime_error("Failed to " + std::string(operation) +
+                             " file \"" + m_path +
+                             "\": " + shcore::errno_to_string(errno));
+  }
+
+  std::string m_path;
+  FILE *m_file = nullptr;
+#ifdef HAVE_ZLIB
+  gzFile m_gz_file = nullptr;
+#endif
+};
+
+using table_chunks::quote;
+
+}  // namespace
+
+void append_escaped_field(const char *data, size_t length, std::string *out) {
+  const char *const end = data + length;
+  const char *run = data;
+
+  for (const char *p = data; p < end; ++p) {
+    char escaped;
+
+    switch (*p) {
+      case '\0':
+        escaped = '0';
+        break;
+      case '\n':
+        escaped = 'n';
+        break;
+      case '\r':
+        escaped = 'r';
+        break;
+      case '\t':
+        escaped = 't';
+        break;
+      case '\032':
+        escaped = 'Z';
+        break;
+      case '\\':
+        escaped = '\\';
+        break;
+      default:
+        continue;
+    }
+
+    out->append(run, p - run);
+    out->push_back('\\');
+    out->push_back(escaped);
+    run = p + 1;
+  }
+
+  out->append(run, end - run);
+}
+
+std::string encode_file_name(const std::string &name) {
+  static constexpr const char k_hex[] = "0123456789ABCDEF";
+  std::string encoded;
+  encoded.reserve(name.length());
+
+  for (const char c : name) {
+    const auto u = static_cast<unsigned char>(c);
+
+    if ((u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') ||
+        (u >= '0' && u <= '9') || u == '_' || u == '-') {
+      encoded.push_back(c);
+    } else {
+      encoded.push_back('%');
+      encoded.push_back(k_hex[u >> 4]);
+      encoded.push_back(k_hex[u & 0xF]);
+    }
+  }
+
+  return encoded;
+}
+
+bool is_generated_column(const std::string &extra) {
+  const auto lower = shcore::str_lower(extra);
+  // DEFAULT_GENERATED marks columns with an expression default, i.e.
+  // DEFAULT CURRENT_TIMESTAMP, their values are stored and are dumped
+  return lower.find("virtual generated") != std::string::npos ||
+         lower.find("stored generated") != std::string::npos;
+}
+
+Dump_schemas::Dump_schemas(
+    const mysqlshdk::db::Connection_options &connection_options)
+    : m_connection_options(connection_options),
+      m_compression(k_default_compression) {}
+
+Dump_schemas::Compression Dump_schemas::compression_from_name(
+    const std::string &name) {
+  if (name == "none") return Compression::NONE;
+
+  if (name == "gzip") {
+#ifdef HAVE_ZLIB
+    return Compression::GZIP;
+#else
+    throw std::invalid_argument(
+        "The gzip compression is not supported by this build.");
+#endif
+  }
+
+  throw std::invalid_argument("Unknown compression: " + name);
+}
+
+void Dump_schemas::set_threads(int threads) {
+  validate_threads(threads);
+  m_threads = threads;
+}
+
+void Dump_schemas::set_rows_per_chunk(uint64_t rows) {
+  if (rows < 1) {
+    throw std::invalid_argument(
+        "Number of rows per chunk must be a positive integer value.");
+  }
+  m_rows_per_chunk = rows;
+}
+
+void Dump_schemas::set_print_callback(
+    const std::function<void(const std::string &)> &callback) {
+  m_print = callback;
+}
+
+void Dump_schemas::print_stats() {
+  using mysqlshdk::utils::format_bytes;
+  using mysqlshdk::utils::format_seconds;
+  using mysqlshdk::utils::format_throughput_bytes;
+  using mysqlshdk::utils::format_throughput_items;
+
+  m_stats.timer.stage_end();
+  double dump_time_seconds = m_stats.timer.total_seconds_ellapsed();
+
+  if (m_print) {
+    const std::string msg =
+        "\nDumped " + std::to_string(m_stats.rows_written) +
+        (m_stats.rows_written == 1 ? " row" : " rows") + " (" +
+        format_bytes(m_stats.bytes_written) + ") from " +
+        std::to_string(m_table_infos.size()) +
+        (m_table_infos.size() == 1 ? " table" : " tables") + " in " +
+        std::to_string(m_chunks.size()) +
+        (m_chunks.size() == 1 ? " chunk" : " chunks") + " in " +
+        format_seconds(dump_time_seconds) + " (" +
+        format_throughput_items("row", "rows", m_stats.rows_written,
+                                dump_time_seconds) +
+        ", " +
+        format_throughput_bytes(m_stats.bytes_written, dump_time_seconds) +
+        ")\n";
+    m_print(msg);
+  }
+}
+
+Dump_schemas::Session_ptr Dump_schemas::connect_session() const {
+  auto session = mysqlshdk::db::mysql::Session::create();
+  session->connect(m_connection_options);
+  // data is written in UTF-8, TIMESTAMP values in UTC
+  session->execute("SET NAMES 'utf8mb4'");
+  session->execute("SET TIME_ZONE = '+00:00'");
+  return session;
+}
+
+std::string Dump_schemas::file_path(const std::string &name) const {
+  return shcore::path::join_path(m_output_dir, name);
+}
+
+std::string Dump_schemas::data_file_extension() const {
+  return Compression::GZIP == m_compression ? ".tsv.gz" : ".tsv";
+}
+
+void Dump_schemas::validate_output_directory() const {
+  if (m_output_dir.empty()) {
+    throw std::invalid_argument("The output directory cannot be empty.");
+  }
+
+  if (shcore::file_exists(m_output_dir)) {
+    if (!shcore::is_folder(m_output_dir)) {
+      throw shcore::Exception::logic_error(
+          "Path \"" + m_output_dir + "\" is not a directory.");
+    }
+
+    if (!shcore::listdir(m_output_dir).empty()) {
+      throw shcore::Exception::logic_error(
+          "Directory \"" + m_output_dir + "\" is not empty.");
+    }
+  }
+}
+
+void Dump_schemas::run() {
+  if (m_schemas.empty()) {
+    throw std::invalid_argument("At least one schema must be given.");
+  }
+
+  if (!m_tables.empty() && m_schemas.size() != 1) {
+    throw std::invalid_argument(
+        "Tables can only be selected when dumping a single schema.");
+  }
+
+  validate_output_directory();
+
+  m_stats.timer.stage_begin("Dumping schemas");
+  m_begin_time = shcore::fmttime("%Y-%m-%d %H:%M:%S");
+
+  const auto session = connect_session();
+
+  std::vector<Session_ptr> workers;
+  for (int i = 0; i < m_threads; ++i) {
+    workers.emplace_back(connect_session());
+  }
+
+  // the global read lock blocks DDL and writes, the list of tables and their
+  // definitions are read while it is held, so that they match the snapshot
+  if (m_consistent) session->execute("FLUSH TABLES WITH READ LOCK");
+
+  read_tables(session);
+  const auto ddl = read_ddl(session);
+
+  start_transactions(workers);
+
+  if (m_consistent) {
+    const auto result = session->query("SELECT @@GLOBAL.gtid_executed");
+    const auto row = result->fetch_one();
+    if (row && !row->is_null(0)) m_gtid_executed = row->get_string(0);
+    session->execute("UNLOCK TABLES");
+  }
+
+  shcore::create_directory(m_output_dir);
+  write_ddl(ddl);
+
+  // boundaries are read in the snapshot, rows added later are still in range
+  create_chunks(workers[0]);
+  dump_chunks(workers);
+
+  write_metadata();
+}
+
+void Dump_schemas::read_tables(const Session_ptr &session) {
+  for (const auto &schema : m_schemas) {
+    auto result = session->query(
+        shcore::sqlstring("SELECT SCHEMA_NAME FROM information_schema.schemata "
+                          "WHERE SCHEMA_NAME = ?",
+                          0)
+        << schema);
+    if (!result->fetch_one()) {
+      throw shcore::Exception::runtime_error("Schema `" + schema +
+                                             "` does not exist.");
+    }
+
+    result = session->query(
+        shcore::sqlstring("SELECT TABLE_NAME, TABLE_ROWS "
+                          "FROM information_schema.tables WHERE "
+                          "TABLE_SCHEMA = ? AND TABLE_TYPE = 'BASE TABLE' "
+                          "ORDER BY TABLE_NAME",
+                          0)
+        << schema);
+
+    std::vector<Table_info> tables;
+    while (const auto row = result->fetch_one()) {
+      Table_info table;
+      table.schema = schema;
+      table.name = row->get_string(0);
+      table.row_estimate = row->is_null(1) ? 0 : row->get_uint(1);
+
+      if (m_tables.empty() || std::find(m_tables.begin(), m_tables.end(),
+                                        table.name) != m_tables.end()) {
+        tables.emplace_back(std::move(table));
+      }
+    }
+
+    for (const auto &name : m_tables) {
+      if (std::find_if(tables.begin(), tables.end(),
+                       [&name](const Table_info &t) {
+                         return t.name == name;
+                       }) == tables.end()) {
+        throw shcore::Exception::runtime_error(
+            "Table `" + schema + "`.`" + name + "` does not exist.");
+      }
+    }
+
+    // primary keys of all the tables of the schema, columns in the key order
+    std::map<std::string, std::vector<std::string>> keys;
+    result = session->query(
+        shcore::sqlstring("SELECT TABLE_NAME, COLUMN_NAME "
+                          "FROM information_schema.statistics WHERE "
+                          "TABLE_SCHEMA = ? AND INDEX_NAME = 'PRIMARY' "
+                          "ORDER BY TABLE_NAME, SEQ_IN_INDEX",
+                          0)
+        << schema);
+    while (const auto row = result->fetch_one()) {
+      keys[row->get_string(0)].emplace_back(row->get_string(1));
+    }
+
+    for (auto &table : tables) {
+      result = session->query(
+          shcore::sqlstring("SELECT COLUMN_NAME, DATA_TYPE, EXTRA "
+                            "FROM information_schema.columns WHERE "
+                            "TABLE_SCHEMA = ? AND TABLE_NAME = ? "
+                            "ORDER BY ORDINAL_POSITION",
+                            0)
+          << table.schema << table.name);
+
+      std::vector<std::string> select_list;
+      std::map<std::string, std::string> data_types;
+
+      while (const auto row = result->fetch_one()) {
+        const auto column = row->get_string(0);
+        const auto data_type = shcore::str_lower(row->get_string(1));
+
+        data_types[column] = data_type;
+
+        // generated values cannot be loaded
+        if (is_generated_column(row->get_string(2))) continue;
+
+        table.columns.emplace_back(column);
+
+        const auto quoted = quote(column);
+        select_list.emplace_back(data_type == "bit"
+                                     ? "CAST(" + quoted + " AS BINARY)"
+                                     : quoted);
+      }
+
+      table.select_list = shcore::str_join(select_list, ", ");
+
+      const auto key = keys.find(table.name);
+      if (key != keys.end()) {
+        table.key = key->second;
+        for (const auto &column : table.key) {
+          table.key_types.emplace_back(data_types[column]);
+        }
+      }
+    }
+
+    std::move(tables.begin(), tables.end(), std::back_inserter(m_table_infos));
+  }
+}
+
+void Dump_schemas::start_transactions(
+    const std::vector<Session_ptr> &sessions) {
+  for (const auto &session : sessions) {
+    session->execute("SET SESSION TRANSACTION ISOLATION LEVEL REPEATABLE READ");
+    session->execute("START TRANSACTION WITH CONSISTENT SNAPSHOT");
+  }
+}
+
+std::vector<std::string> Dump_schemas::read_ddl(
+    const Session_ptr &session) const {
+  std::vector<std::string> schemas_ddl;
+
+  for (const auto &schema : m_schemas) {
+    std::string ddl = "-- Schema `" + schema + "` dumped by MySQL Shell\n\n";
+
+    auto result = session->query(
+        shcore::sqlstring("SHOW CREATE DATABASE IF NOT EXISTS !", 0) << schema);
+    if (const auto row = result->fetch_one()) {
+      ddl += row->get_string(1) + ";\n\n";
+    }
+    ddl += shcore::sqlstring("USE !;\n", 0) << schema;
+
+    for (const auto &table : m_table_infos) {
+      if (table.schema != schema) continue;
+
+      result = session->query(
+          shcore::sqlstring("SHOW CREATE TABLE !.!", 0) << schema
+                                                         << table.name);
+      if (const auto row = result->fetch_one()) {
+        ddl += "\n" + row->get_string(1) + ";\n";
+      }
+    }
+
+    schemas_ddl.emplace_back(std::move(ddl));
+  }
+
+  return schemas_ddl;
+}
+
+void Dump_schemas::write_ddl(const std::vector<std::string> &ddl) const {
+  for (size_t i = 0; i < m_schemas.size(); ++i) {
+    const auto path = file_path(encode_file_name(m_schemas[i]) + ".sql");
+    if (!shcore::create_file(path, ddl[i])) {
+      throw std::runtime_error("Failed to write file \"" + path + "\"");
+    }
+  }
+}
+
+void Dump_schemas::create_chunks(const Session_ptr &session) {
+  std::atomic<bool> interrupted{false};
+
+  shcore::Interrupt_handler intr_handler([&interrupted]() -> bool {
+    interrupted = true;
+    return false;
+  });
+
+  for (size_t t = 0; t < m_table_infos.size() && !interrupted; ++t) {
+    auto &table = m_table_infos[t];
+    std::vector<std::vector<std::string>> boundaries;
+
+    // tables are walked on their primary key, tables without one are dumped
+    // as a single chunk
+    if (!table.key.empty()) {
+      boundaries = table_chunks::walk_key(session.get(), table.schema,
+                                          table.name, table.key,
+                                          table.key_types, m_rows_per_chunk,
+                                          interrupted);
+    }
+
+    const auto ranges =
+        table_chunks::split_on_boundaries(table.key, boundaries);
+    table.chunks = ranges.size();
+
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      m_chunks.emplace_back(Chunk_task{t, i, ranges[i]});
+    }
+  }
+
+  if (interrupted) throw shcore::cancelled("Dump cancelled.");
+
+  // largest tables first, so the last chunks do not keep a single worker busy
+  std::stable_sort(m_chunks.begin(), m_chunks.end(),
+                   [this](const Chunk_task &a, const Chunk_task &b) {
+                     return m_table_infos[a.table].row_estimate /
+                                m_table_infos[a.table].chunks >
+                            m_table_infos[b.table].row_estimate /
+                                m_table_infos[b.table].chunks;
+                   });
+}
+
+void Dump_schemas::dump_chunk(const Session_ptr &session,
+                              const Chunk_task &task,
+                              const std::atomic<bool> &interrupted,
+                              uint64_t *out_rows, uint64_t *out_bytes) const {
+  const auto &table = m_table_infos[task.table];
+  std::string query = shcore::sqlstring("SELECT " + table.select_list +
+                                            " FROM !.!",
+                                        0)
+                      << table.schema << table.name;
+  if (!task.where.empty()) query += " WHERE " + task.where;
+
+  Output_file file(file_path(encode_file_name(table.schema) + "@" +
+                             encode_file_name(table.name) + "@" +
+                             std::to_string(task.index) +
+                             data_file_extension()),
+                   m_compression);
+
+  // rows are streamed from the server, fields are read in place
+  const auto result = session->query(query);
+  const auto &metadata = result->get_metadata();
+  std::vector<bool> is_string;
+  for (const auto &column : metadata) {
+    is_string.push_back(mysqlshdk::db::is_string_type(column.get_type()));
+  }
+
+  std::string buffer;
+  buffer.reserve(k_write_buffer_bytes + 64 * 1024);
+
+  while (const auto row = result->fetch_one()) {
+    if (interrupted) return;
+
+    for (uint32_t i = 0; i < is_string.size(); ++i) {
+      if (i > 0) buffer.push_back('\t');
+
+      if (row->is_null(i)) {
+        buffer.append("\\N");
+      } else if (is_string[i]) {
+        const auto data = row->get_string_data(i);
+        append_escaped_field(data.first, data.second, &buffer);
+      } else {
+        // numbers do not need to be escaped
+        buffer.append(row->get_as_string(i));
+      }
+    }
+
+    buffer.push_back('\n');
+    ++*out_rows;
+
+    if (buffer.size() >= k_write_buffer_bytes) {
+      file.write(buffer);
+      *out_bytes += buffer.size();
+      buffer.clear();
+    }
+  }
+
+  file.write(buffer);
+  *out_bytes += buffer.size();
+  file.close();
+}
+
+void Dump_schemas::dump_chunks(const std::vector<Session_ptr> &sessions) {
+  std::atomic<size_t> next{0};
+  std::atomic<bool> interrupted{false};
+  std::vector<uint64_t> rows(sessions.size(), 0);
+  std::vector<uint64_t> bytes(sessions.size(), 0);
+
+  Worker_threads threads(&interrupted);
+  for (size_t w = 0; w < sessions.size(); ++w) {
+    threads.start([&, w]() {
+      size_t i;
+      while (!interrupted && (i = next++) < m_chunks.size()) {
+        dump_chunk(sessions[w], m_chunks[i], interrupted, &rows[w], &bytes[w]);
+      }
+    });
+  }
+
+  threads.join();
+
+  for (size_t w = 0; w < sessions.size(); ++w) {
+    m_stats.rows_written += rows[w];
+    m_stats.bytes_written += bytes[w];
+  }
+
+  threads.wait();
+
+  if (interrupted) throw shcore::cancelled("Dump cancelled.");
+}
+
+void Dump_schemas::write_metadata() const {
+  const std::string compression =
+      Compression::GZIP == m_compression ? "gzip" : "none";
+
+  for (const auto &table : m_table_infos) {
+    auto metadata = shcore::make_dict();
+    auto columns = shcore::make_array();
+    for (const auto &column : table.columns) {
+      columns->emplace_back(column);
+    }
+
+    (*metadata)["schema"] = shcore::Value(table.schema);
+    (*metadata)["table"] = shcore::Value(table.name);
+    (*metadata)["columns"] = shcore::Value(columns);
+    if (table.key.empty()) {
+      (*metadata)["primaryKey"] = shcore::Value::Null();
+    } else {
+      auto key = shcore::make_array();
+      for (const auto &column : table.key) {
+        key->emplace_back(column);
+      }
+      (*metadata)["primaryKey"] = shcore::Value(key);
+    }
+    (*metadata)["chunks"] = shcore::Value(static_cast<uint64_t>(table.chunks));
+    (*metadata)["extension"] = shcore::Value(data_file_extension());
+    (*metadata)["compression"] = shcore::Value(compression);
+    (*metadata)["characterSet"] = shcore::Value("utf8mb4");
+    (*metadata)["timeZone"] = shcore::Value("+00:00");
+    (*metadata)["fieldsTerminatedBy"] = shcore::Value("\t");
+    (*metadata)["fieldsEscapedBy"] = shcore::Value("\\");
+    (*metadata)["linesTerminatedBy"] = shcore::Value("\n");
+
+    const auto path = file_path(encode_file_name(table.schema) + "@" +
+                                encode_file_name(table.name) + ".json");
+    if (!shcore::create_file(path, shcore::Value(metadata).json(true))) {
+      throw std::runtime_error("Failed to write file \"" + path + "\"");
+    }
+  }
+
+  auto schemas = shcore::make_array();
+  for (const auto &schema : m_schemas) {
+    schemas->emplace_back(schema);
+  }
+
+  auto metadata = shcore::make_dict();
+  (*metadata)["dumper"] = shcore::Value("mysqlsh");
+  (*metadata)["schemas"] = shcore::Value(schemas);
+  (*metadata)["consistent"] = shcore::Value(m_consistent);
+  (*metadata)["gtidExecuted"] = shcore::Value(m_gtid_executed);
+  (*metadata)["begin"] = shcore::Value(m_begin_time);
+  (*metadata)["end"] = shcore::Value(shcore::fmttime("%Y-%m-%d %H:%M:%S"));
+
+  const auto path = file_path("@.json");
+  if (!shcore::create_file(path, shcore::Value(metadata).json(true))) {
+    throw std::runtime_error("Failed to write file \"" + path + "\"");
+  }
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_SCHEMAS_H_
+#define MODULES_UTIL_DUMP_SCHEMAS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/utils/profiling.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace mysql {
+class Session;
+}  // namespace mysql
+}  // namespace db
+}  // namespace mysqlshdk
+
+namespace mysqlsh {
+
+/**
+ * Appends field to the row written in the default format of the LOAD DATA
+ * statement: fields terminated by tab, escaped by backslash, lines terminated
+ * by newline.
+ */
+void append_escaped_field(const char *data, size_t length, std::string *out);
+
+/**
+ * Encodes name of a schema or a table to be used as a part of a file name,
+ * characters other than ASCII letters, digits, '_' and '-' are written as %XX.
+ */
+std::string encode_file_name(const std::string &name);
+
+/**
+ * Checks if the EXTRA column of information_schema.columns describes a virtual
+ * or a stored generated column, values of which cannot be loaded.
+ */
+bool is_generated_column(const std::string &extra);
+
+/**
+ * Dumps schemas to a directory, data of each table is split into chunks on
+ * the ranges of its primary key, which are read in parallel.
+ *
+ * Directory contains:
+ *  - <schema>.sql - DDL of the schema and its tables
+ *  - <schema>@<table>.json - metadata of the table
+ *  - <schema>@<table>@<chunk>.tsv[.gz] - data of the chunk
+ *  - \@.json - metadata of the dump, written once dump is complete
+ */
+class Dump_schemas {
+ public:
+  enum class Compression { NONE, GZIP };
+
+  explicit Dump_schemas(
+      const mysqlshdk::db::Connection_options &connection_options);
+  ~Dump_schemas() {}
+
+  /**
+   * Converts "none" or "gzip" to compression type, throws
+   * std::invalid_argument if compression is unknown or not supported.
+   */
+  static Compression compression_from_name(const std::string &name);
+
+  void set_schemas(const std::vector<std::string> &schemas) {
+    m_schemas = schemas;
+  }
+
+  /**
+   * Dumps only these tables, requires a single schema.
+   */
+  void set_tables(const std::vector<std::string> &tables) {
+    m_tables = tables;
+  }
+
+  void set_output_directory(const std::string &path) { m_output_dir = path; }
+
+  /**
+   * Set number of classic protocol sessions used to read data.
+   *
+   * @param threads Number of worker threads, must be greater than 0.
+   */
+  void set_threads(int threads);
+
+  /**
+   * Set approximate number of rows in a chunk, tables without a single column
+   * integer primary key are always dumped as one chunk.
+   */
+  void set_rows_per_chunk(uint64_t rows);
+
+  void set_compression(Compression compression) {
+    m_compression = compression;
+  }
+
+  /**
+   * Whether all workers use the same consistent snapshot, requires a global
+   * read lock to be held while the table definitions are read and the
+   * workers start transactions.
+   */
+  void set_consistent(bool consistent) { m_consistent = consistent; }
+
+  void set_print_callback(
+      const std::function<void(const std::string &)> &callback);
+
+  void run();
+
+  void print_stats();
+
+ private:
+  struct Table_info {
+    std::string schema;
+    std::string name;
+    /// Columns which are dumped, generated columns are skipped.
+    std::vector<std::string> columns;
+    /// Select list, BIT columns are read as binary strings.
+    std::string select_list;
+    /// Primary key columns, empty if table cannot be split.
+    std::vector<std::string> key;
+    /// DATA_TYPE of each of the key columns.
+    std::vector<std::string> key_types;
+    uint64_t row_estimate = 0;
+    size_t chunks = 0;
+  };
+
+  struct Chunk_task {
+    size_t table;
+    size_t index;
+    /// Range of the chunk, empty if table is dumped as a single chunk.
+    std::string where;
+  };
+
+  using Session_ptr = std::shared_ptr<mysqlshdk::db::mysql::Session>;
+
+  Session_ptr connect_session() const;
+  void validate_output_directory() const;
+  void start_transactions(const std::vector<Session_ptr> &sessions);
+  void read_tables(const Session_ptr &session);
+  /// DDL of each of the schemas, in the order of m_schemas.
+  std::vector<std::string> read_ddl(const Session_ptr &session) const;
+  void write_ddl(const std::vector<std::string> &ddl) const;
+  void create_chunks(const Session_ptr &session);
+  void dump_chunks(const std::vector<Session_ptr> &sessions);
+  void dump_chunk(const Session_ptr &session, const Chunk_task &task,
+                  const std::atomic<bool> &interrupted, uint64_t *out_rows,
+                  uint64_t *out_bytes) const;
+  void write_metadata() const;
+
+  std::string file_path(const std::string &name) const;
+  std::string data_file_extension() const;
+
+  std::function<void(const std::string &)> m_print = nullptr;
+
+  mysqlshdk::db::Connection_options m_connection_options;
+  std::vector<std::string> m_schemas;
+  std::vector<std::string> m_tables;
+  std::string m_output_dir;
+  int m_threads = 4;
+  uint64_t m_rows_per_chunk = 250000;
+  Compression m_compression;
+  bool m_consistent = true;
+
+  std::vector<Table_info> m_table_infos;
+  std::vector<Chunk_task> m_chunks;
+  std::string m_gtid_executed;
+  std::string m_begin_time;
+
+  struct {
+    uint64_t rows_written = 0;
+    uint64_t bytes_written = 0;
+    mysqlshdk::utils::Profile_timer timer;
+  } m_stats;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_SCHEMAS_H_
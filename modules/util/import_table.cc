@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table.h"
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "modules/util/bounded_queue.h"
+#include "modules/util/worker_threads.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "scripting/shexcept.h"
+
+namespace mysqlsh {
+
+Import_table_dialect Import_table_dialect::from_name(const std::string &name) {
+  Import_table_dialect dialect;
+
+  if (name == "default") {
+    return dialect;
+  } else if (name == "csv") {
+    dialect.fields_terminated_by = ",";
+    dialect.fields_enclosed_by = "\"";
+    dialect.fields_optionally_enclosed = true;
+    dialect.lines_terminated_by = "\r\n";
+  } else if (name == "tsv") {
+    dialect.fields_enclosed_by = "\"";
+    dialect.fields_optionally_enclosed = true;
+    dialect.lines_terminated_by = "\r\n";
+  } else if (name == "csv-unix") {
+    dialect.fields_terminated_by = ",";
+    dialect.fields_enclosed_by = "\"";
+  } else {
+    throw std::invalid_argument("Unknown dialect: " + name);
+  }
+
+  return dialect;
+}
+
+void Import_table_dialect::validate() const {
+  if (fields_terminated_by.empty()) {
+    throw std::invalid_argument("Field terminator cannot be empty.");
+  }
+
+  if (lines_terminated_by.empty()) {
+    throw std::invalid_argument("Line terminator cannot be empty.");
+  }
+
+  if (fields_enclosed_by.size() > 1) {
+    throw std::invalid_argument(
+        "Field enclosure must be empty or a single character.");
+  }
+
+  if (fields_escaped_by.size() > 1) {
+    throw std::invalid_argument(
+        "Field escape must be empty or a single character.");
+  }
+}
+
+Row_end_scanner::Row_end_scanner(const Import_table_dialect &dialect)
+    : m_field_terminator(dialect.fields_terminated_by),
+      m_line_terminator(dialect.lines_terminated_by),
+      m_enclosure(dialect.fields_enclosed_by.empty()
+                      ? -1
+                      : static_cast<unsigned char>(
+                            dialect.fields_enclosed_by[0])),
+      m_escape(dialect.fields_escaped_by.empty()
+                   ? -1
+                   : static_cast<unsigned char>(dialect.fields_escaped_by[0])) {
+  // all other bytes are skipped without checking the terminators
+  m_special.set(static_cast<unsigned char>(m_field_terminator[0]));
+  m_special.set(static_cast<unsigned char>(m_line_terminator[0]));
+  if (m_enclosure >= 0) m_special.set(m_enclosure);
+  if (m_escape >= 0) m_special.set(m_escape);
+}
+
+Row_end_scanner::Match Row_end_scanner::match(const char *data, size_t size,
+                                              const std::string &str) const {
+  const auto length = std::min(size, str.length());
+
+  if (0 != memcmp(data, str.data(), length)) return Match::NO;
+
+  return length == str.length() ? Match::YES : Match::INCOMPLETE;
+}
+
+size_t Row_end_scanner::next_row_end(const char *data, size_t size,
+                                     size_t min_offset) {
+  while (m_offset < size) {
+    const auto c = static_cast<unsigned char>(data[m_offset]);
+
+    if (!m_special[c]) {
+      m_field_start = false;
+      ++m_offset;
+      continue;
+    }
+
+    if (c == m_escape) {
+      // escaped character is taken literally
+      if (m_offset + 1 >= size) break;
+      m_field_start = false;
+      m_offset += 2;
+      continue;
+    }
+
+    if (m_enclosed) {
+      if (c == m_enclosure) {
+        // doubled enclosure character is taken literally
+        if (m_offset + 1 >= size) break;
+        if (static_cast<unsigned char>(data[m_offset + 1]) == m_enclosure) {
+          ++m_offset;
+        } else {
+          m_enclosed = false;
+        }
+      }
+      ++m_offset;
+      continue;
+    }
+
+    if (c == m_enclosure && m_field_start) {
+      m_enclosed = true;
+      m_field_start = false;
+      ++m_offset;
+      continue;
+    }
+
+    auto m = match(data + m_offset, size - m_offset, m_line_terminator);
+
+    if (Match::INCOMPLETE == m) break;
+
+    if (Match::YES == m) {
+      m_offset += m_line_terminator.length();
+      m_field_start = true;
+      if (m_offset >= min_offset) return m_offset;
+      continue;
+    }
+
+    m = match(data + m_offset, size - m_offset, m_field_terminator);
+
+    if (Match::INCOMPLETE == m) break;
+
+    if (Match::YES == m) {
+      m_offset += m_field_terminator.length();
+      m_field_start = true;
+      continue;
+    }
+
+    m_field_start = false;
+    ++m_offset;
+  }
+
+  return std::string::npos;
+}
+
+void Row_end_scanner::consume(size_t offset) {
+  m_offset -= offset;
+  m_field_start = true;
+  m_enclosed = false;
+}
+
+/*
+ * Chunk of rows handed by reader to load workers. An empty chunk marks end of
+ * input for a single worker.
+ */
+struct Import_table::Chunk {
+  /// References memory mapped input, empty if chunk owns its data.
+  shcore::Input_span mapped;
+  std::string storage;
+
+  shcore::Input_span data() const {
+    return mapped.empty() ? shcore::Input_span(storage.data(), storage.size())
+                          : mapped;
+  }
+
+  bool empty() const { return mapped.empty() && storage.empty(); }
+};
+
+namespace {
+
+struct Load_worker {
+  std::shared_ptr<mysqlshdk::db::mysql::Session> session;
+  /// Data of the current chunk which was not sent to the server yet.
+  shcore::Input_span pending;
+
+  uint64_t bytes = 0;
+  uint64_t chunks = 0;
+  uint64_t records = 0;
+  uint64_t deleted = 0;
+  uint64_t skipped = 0;
+  uint64_t warnings = 0;
+
+  void update_statistics(const mysqlshdk::db::IResult &result) {
+    // "Records: 1  Deleted: 0  Skipped: 0  Warnings: 0"
+    uint64_t r = 0, d = 0, s = 0;
+    if (3 == sscanf(result.get_info().c_str(),
+                    "Records: %" SCNu64 " Deleted: %" SCNu64
+                    " Skipped: %" SCNu64,
+                    &r, &d, &s)) {
+      records += r;
+      deleted += d;
+      skipped += s;
+    }
+    warnings += result.get_warning_count();
+  }
+};
+
+}  // namespace
+
+Import_table::Import_table(
+    const mysqlshdk::db::Connection_options &connection_options)
+    : m_connection_options(connection_options) {}
+
+void Import_table::set_target_table(const std::string &schema,
+                                    const std::string &table) {
+  m_schema = schema;
+  m_table = table;
+}
+
+void Import_table::set_dialect(const Import_table_dialect &dialect) {
+  dialect.validate();
+  m_dialect = dialect;
+}
+
+void Import_table::set_threads(int threads) {
+  validate_threads(threads);
+  m_threads = threads;
+}
+
+void Import_table::set_bytes_per_chunk(size_t bytes) {
+  if (bytes < 1) {
+    throw std::invalid_argument(
+        "Size of the chunk must be a positive integer value.");
+  }
+  m_bytes_per_chunk = bytes;
+}
+
+void Import_table::set_print_callback(
+    const std::function<void(const std::string &)> &callback) {
+  m_print = callback;
+}
+
+void Import_table::print_stats() {
+  using mysqlshdk::utils::format_bytes;
+  using mysqlshdk::utils::format_seconds;
+  using mysqlshdk::utils::format_throughput_bytes;
+  using mysqlshdk::utils::format_throughput_items;
+
+  m_stats.timer.stage_end();
+  double import_time_seconds = m_stats.timer.total_seconds_ellapsed();
+
+  if (m_print) {
+    const std::string msg =
+        "\nProcessed " + format_bytes(m_stats.bytes_processed) + " in " +
+        std::to_string(m_stats.chunks_processed) +
+        (m_stats.chunks_processed == 1 ? " chunk" : " chunks") + " in " +
+        format_seconds(import_time_seconds) + " (" +
+        format_throughput_bytes(m_stats.bytes_processed, import_time_seconds) +
+        ")" + "\nTotal rows affected " + std::to_string(m_stats.records) +
+        " (" +
+        format_throughput_items("row", "rows", m_stats.records,
+                                import_time_seconds) +
+        ")\nRecords: " + std::to_string(m_stats.records) +
+        "  Deleted: " + std::to_string(m_stats.deleted) +
+        "  Skipped: " + std::to_string(m_stats.skipped) +
+        "  Warnings: " + std::to_string(m_stats.warnings) + "\n";
+    m_print(msg);
+  }
+}
+
+void Import_table::load() {
+  shcore::Buffered_input input{};
+  m_stats.timer.stage_begin("Importing rows");
+
+  if (!m_file_path.empty()) {
+    auto full_path = shcore::path::expand_user(m_file_path);
+    input.open(full_path);
+  }
+
+  load_from(&input);
+}
+
+std::string Import_table::load_data_statement() const {
+  // data comes from the reader, file name is only used in messages
+  shcore::sqlstring sql(
+      "LOAD DATA LOCAL INFILE ? " +
+          std::string(m_replace_duplicates ? "REPLACE" : "IGNORE") +
+          " INTO TABLE !.! FIELDS TERMINATED BY ? " +
+          std::string(m_dialect.fields_optionally_enclosed ? "OPTIONALLY "
+                                                           : "") +
+          "ENCLOSED BY ? ESCAPED BY ? LINES TERMINATED BY ?",
+      0);
+  sql << (m_file_path.empty() ? "-stdin-" : m_file_path) << m_schema
+      << m_table << m_dialect.fields_terminated_by
+      << m_dialect.fields_enclosed_by << m_dialect.fields_escaped_by
+      << m_dialect.lines_terminated_by;
+
+  std::string statement = sql.str();
+
+  if (!m_columns.empty()) {
+    std::vector<std::string> columns;
+    for (const auto &c : m_columns) {
+      columns.emplace_back(
+          shcore::quote_identifier(shcore::escape_backticks(c), '`'));
+    }
+    statement += " (" + shcore::str_join(columns, ", ") + ")";
+  }
+
+  return statement;
+}
+
+void Import_table::load_from(shcore::Buffered_input *input) {
+  std::atomic<bool> cancel{false};
+  std::atomic<uint64_t> loaded{0};
+  std::vector<std::unique_ptr<Load_worker>> workers;
+
+  // Each worker owns classic protocol session to the same target, LOCAL INFILE
+  // data is read from the chunk which is being loaded.
+  for (int i = 0; i < m_threads; ++i) {
+    std::unique_ptr<Load_worker> worker(new Load_worker());
+    Load_worker *w = worker.get();
+
+    w->session = mysqlshdk::db::mysql::Session::create();
+    w->session->set_local_infile_reader(
+        [w, &cancel](char *buffer, unsigned int size) -> int {
+          if (cancel) return -1;
+          const auto bytes = std::min<size_t>(size, w->pending.size);
+          memcpy(buffer, w->pending.data, bytes);
+          w->pending.data += bytes;
+          w->pending.size -= bytes;
+          return static_cast<int>(bytes);
+        });
+    w->session->connect(m_connection_options);
+
+    workers.emplace_back(std::move(worker));
+  }
+
+  const std::string statement = load_data_statement();
+  Bounded_queue<Chunk> queue(2 * m_threads);
+  Worker_threads threads(&cancel);
+  threads.set_on_error([&queue]() { queue.shutdown(); });
+
+  for (auto &w : workers) {
+    Load_worker *worker = w.get();
+    threads.start([worker, &statement, &queue, &loaded]() {
+      Chunk chunk;
+      while (queue.pop(&chunk) && !chunk.empty()) {
+        worker->pending = chunk.data();
+        const auto bytes = worker->pending.size;
+        worker->update_statistics(*worker->session->query(statement));
+        worker->bytes += bytes;
+        ++worker->chunks;
+        loaded += bytes;
+      }
+    });
+  }
+
+  uint64_t reported = 0;
+  const auto report = [this, &loaded, &reported]() {
+    if (m_print && loaded != reported) {
+      reported = loaded;
+      m_print(".. " + mysqlshdk::utils::format_bytes(reported));
+    }
+  };
+
+  try {
+    Row_end_scanner scanner(m_dialect);
+    uint64_t rows_to_skip = m_skip_rows;
+    bool queue_open = true;
+
+    if (input->is_mapped()) {
+      // whole file is available, chunks reference the mapping
+      const char *data = input->data();
+      size_t size = input->available();
+
+      while (size > 0 && !cancel && queue_open) {
+        auto end = scanner.next_row_end(data, size,
+                                        rows_to_skip ? 1 : m_bytes_per_chunk);
+        if (std::string::npos == end) end = size;
+        scanner.consume(end);
+
+        if (rows_to_skip) {
+          --rows_to_skip;
+        } else {
+          Chunk chunk;
+          chunk.mapped = shcore::Input_span(data, end);
+          queue_open = queue.push(std::move(chunk));
+          report();
+        }
+
+        data += end;
+        size -= end;
+      }
+    } else {
+      std::string buffer;
+
+      while (!cancel && queue_open) {
+        const bool eof = input->eof();
+
+        if (!eof) {
+          const char *data = input->data();
+          const auto size = input->available();
+          buffer.append(data, size);
+          input->skip(size);
+        }
+
+        while (!buffer.empty() && !cancel && queue_open) {
+          auto end =
+              scanner.next_row_end(buffer.data(), buffer.size(),
+                                   rows_to_skip ? 1 : m_bytes_per_chunk);
+          if (std::string::npos == end) {
+            if (!eof) break;
+            end = buffer.size();
+          }
+          scanner.consume(end);
+
+          std::string rest(buffer, end);
+          buffer.resize(end);
+
+          if (rows_to_skip) {
+            --rows_to_skip;
+          } else {
+            Chunk chunk;
+            chunk.storage = std::move(buffer);
+            queue_open = queue.push(std::move(chunk));
+            report();
+          }
+
+          buffer = std::move(rest);
+        }
+
+        if (eof) break;
+      }
+    }
+  } catch (...) {
+    queue.shutdown();
+    threads.join();
+    throw;
+  }
+
+  // one end of input marker per worker
+  for (int i = 0; i < m_threads; ++i) {
+    if (!queue.push(Chunk{})) break;
+  }
+
+  threads.join();
+
+  for (const auto &worker : workers) {
+    m_stats.bytes_processed += worker->bytes;
+    m_stats.chunks_processed += worker->chunks;
+    m_stats.records += worker->records;
+    m_stats.deleted += worker->deleted;
+    m_stats.skipped += worker->skipped;
+    m_stats.warnings += worker->warnings;
+  }
+
+  report();
+
+  // a failed worker also sets the cancel flag
+  threads.wait();
+
+  if (cancel) throw shcore::cancelled("Table import cancelled.");
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_H_
+#define MODULES_UTIL_IMPORT_TABLE_H_
+
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/utils_buffered_input.h"
+
+namespace mysqlsh {
+
+/**
+ * Format of the delimited file, corresponds to the FIELDS and LINES clauses of
+ * the LOAD DATA statement.
+ */
+struct Import_table_dialect {
+  std::string fields_terminated_by{"\t"};
+  std::string fields_enclosed_by;
+  bool fields_optionally_enclosed = false;
+  std::string fields_escaped_by{"\\"};
+  std::string lines_terminated_by{"\n"};
+
+  /**
+   * Creates one of the predefined dialects: "default" (format of the LOAD DATA
+   * statement), "csv" or "tsv".
+   */
+  static Import_table_dialect from_name(const std::string &name);
+
+  /**
+   * Throws std::invalid_argument if the dialect cannot be used to split input.
+   */
+  void validate() const;
+};
+
+/**
+ * Finds the ends of rows in the delimited input, line terminators which are
+ * escaped or enclosed do not end a row.
+ *
+ * Scanned data has to begin at the start of a row, scan state is kept between
+ * calls, so data can be appended if it ends in the middle of a row.
+ */
+class Row_end_scanner {
+ public:
+  explicit Row_end_scanner(const Import_table_dialect &dialect);
+
+  /**
+   * Finds the first row which ends at or after `min_offset`.
+   *
+   * @param data Data starting at a row, previously scanned bytes cannot change.
+   * @param size Number of bytes available.
+   * @param min_offset Minimum offset of the row end.
+   * @return Offset right after the line terminator, std::string::npos if data
+   *         ends before such row ends.
+   */
+  size_t next_row_end(const char *data, size_t size, size_t min_offset);
+
+  /**
+   * Data up to the `offset`, which has to be a row end, was consumed, next
+   * calls receive data starting right after it.
+   */
+  void consume(size_t offset);
+
+ private:
+  enum class Match { NO, YES, INCOMPLETE };
+
+  Match match(const char *data, size_t size, const std::string &str) const;
+
+  const std::string m_field_terminator;
+  const std::string m_line_terminator;
+  const int m_enclosure;
+  const int m_escape;
+  std::bitset<256> m_special;
+
+  size_t m_offset = 0;
+  bool m_field_start = true;
+  bool m_enclosed = false;
+};
+
+/**
+ * Imports a delimited file to a table using LOAD DATA LOCAL INFILE.
+ *
+ * The calling thread splits input into row-aligned chunks, while each worker
+ * thread loads them through its own classic protocol session, data is served
+ * from memory.
+ */
+class Import_table {
+ public:
+  explicit Import_table(
+      const mysqlshdk::db::Connection_options &connection_options);
+  ~Import_table() {}
+
+  /**
+   * Set path to the delimited file.
+   * @param path Path to the file. Empty path enables read from stdin.
+   */
+  void set_path(const std::string &path) { m_file_path = path; }
+
+  void set_target_table(const std::string &schema, const std::string &table);
+
+  /**
+   * Set columns which receive fields of rows, all columns of the table in
+   * order by default.
+   */
+  void set_columns(const std::vector<std::string> &columns) {
+    m_columns = columns;
+  }
+
+  void set_dialect(const Import_table_dialect &dialect);
+
+  /**
+   * Rows which duplicate an existing row on a unique key replace it, they are
+   * skipped otherwise.
+   */
+  void set_replace_duplicates(bool replace) { m_replace_duplicates = replace; }
+
+  /**
+   * Set number of rows skipped at the beginning of the file.
+   */
+  void set_skip_rows(uint64_t rows) { m_skip_rows = rows; }
+
+  /**
+   * Set number of classic protocol sessions used to load data.
+   *
+   * @param threads Number of worker threads, must be greater than 0.
+   */
+  void set_threads(int threads);
+
+  /**
+   * Set approximate size of the chunk loaded by a single LOAD DATA statement,
+   * chunks end at row boundaries.
+   */
+  void set_bytes_per_chunk(size_t bytes);
+
+  void set_print_callback(
+      const std::function<void(const std::string &)> &callback);
+
+  void load();
+
+  void print_stats();
+
+ private:
+  struct Chunk;
+
+  void load_from(shcore::Buffered_input *input);
+  std::string load_data_statement() const;
+
+  std::function<void(const std::string &)> m_print = nullptr;
+
+  mysqlshdk::db::Connection_options m_connection_options;
+  std::string m_schema;
+  std::string m_table;
+  std::vector<std::string> m_columns;
+  Import_table_dialect m_dialect;
+  bool m_replace_duplicates = false;
+  uint64_t m_skip_rows = 0;
+  int m_threads = 8;
+  size_t m_bytes_per_chunk = 50 * 1024 * 1024;
+
+  struct {
+    uint64_t bytes_processed = 0;
+    uint64_t chunks_processed = 0;
+    uint64_t records = 0;
+    uint64_t deleted = 0;
+    uint64_t skipped = 0;
+    uint64_t warnings = 0;
+    mysqlshdk::utils::Profile_timer timer;
+  } m_stats;
+
+  std::string m_file_path;  //< Path to the delimited file
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_H_
@@ -27,11 +27,21 @@
 #else
 #include <sys/select.h>
 #endif
+#include <atomic>
+#include <condition_variable>
 #include <deque>
+#include <exception>
+#include <functional>
 #include <istream>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
+#include "modules/util/bounded_queue.h"
+#include "modules/util/worker_threads.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/db/mysqlx/util/setter_any.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_buffered_input.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -183,6 +193,50 @@ Json_importer Prepare_json_import::build() {
  */
 static constexpr const int k_inserts_per_transaction = 8;
 
+/*
+ * Size of the document-aligned chunk handed by reader to import worker
+ * threads. Large enough to keep a worker busy for a couple of inserts, small
+ * enough to spread small files among all of workers.
+ */
+static constexpr const size_t k_parallel_chunk_bytes = 4 * 1024 * 1024;
+
+namespace {
+
+/**
+ * Chunk of documents handed by reader to import workers. An empty chunk marks
+ * end of input for a single worker.
+ */
+struct Document_chunk {
+  std::vector<shcore::Input_span> documents;
+  /// Owns documents which do not reference memory mapped input.
+  std::deque<std::string> storage;
+  size_t bytes = 0;
+
+  bool empty() const { return documents.empty(); }
+};
+
+using Chunk_queue = Bounded_queue<Document_chunk>;
+
+/**
+ * Read next document from input, returned span references either the input
+ * mapping or the `buffer`.
+ */
+shcore::Input_span next_document(shcore::Buffered_input *input,
+                                 bool strip_bson_objectid,
+                                 std::string *buffer) {
+  auto doc = span_one_maybe_json(input, buffer);
+
+  if (strip_bson_objectid && !doc.empty()) {
+    if (doc.data != buffer->data()) buffer->assign(doc.data, doc.size);
+    strip_bson_object_id(buffer);
+    doc = shcore::Input_span(buffer->data(), buffer->size());
+  }
+
+  return doc;
+}
+
+}  // namespace
+
 Json_importer::Json_importer(
     const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session)
     : m_session(session) {
@@ -216,6 +270,11 @@ void Json_importer::set_print_callback(
   m_print = callback;
 }
 
+void Json_importer::set_threads(int threads) {
+  validate_threads(threads);
+  m_threads = threads;
+}
+
 void Json_importer::print_stats() {
   using mysqlshdk::utils::format_bytes;
   using mysqlshdk::utils::format_seconds;
@@ -256,8 +315,7 @@ void Json_importer::load_from(bool strip_bson_objectid) {
   load_from(&input, strip_bson_objectid);
 }
 
-void Json_importer::load_from(shcore::Buffered_input *input,
-                              bool strip_bson_objectid) {
+void Json_importer::begin_import() {
   m_stats.items_processed = 0;
   m_stats.bytes_processed = 0;
   m_packet_size_tracker.inserts_in_this_transaction = 0;
@@ -267,6 +325,46 @@ void Json_importer::load_from(shcore::Buffered_input *input,
   m_packet_size_tracker.crud_insert_overhead_bytes = m_batch_insert.ByteSize();
 
   m_session->execute("START TRANSACTION");
+}
+
+void Json_importer::end_import() {
+  flush();
+  commit(true);
+}
+
+void Json_importer::abort_import() {
+  m_batch_insert.mutable_row()->Clear();
+  m_packet_size_tracker.bytes_in_insert = 0;
+  m_packet_size_tracker.rows_in_insert = 0;
+  m_packet_size_tracker.inserts_in_this_transaction = 0;
+
+  // replies to the requests which were already sent have to be read before
+  // the session can be used again, their errors no longer matter
+  while (m_pending_response > 0) {
+    --m_pending_response;
+    xcl::XError error;
+    m_session->get_driver_obj()->get_protocol().recv_resultset(&error);
+    if (error && error.is_fatal()) {
+      m_pending_response = 0;
+      return;
+    }
+  }
+
+  try {
+    m_session->execute("ROLLBACK");
+  } catch (const std::exception &e) {
+    log_warning("Failed to roll back JSON import transaction: %s", e.what());
+  }
+}
+
+void Json_importer::load_from(shcore::Buffered_input *input,
+                              bool strip_bson_objectid) {
+  if (m_threads > 1) {
+    load_parallel_from(input, strip_bson_objectid);
+    return;
+  }
+
+  begin_import();
 
   bool cancel = false;
   shcore::Interrupt_handler intr_handler([&cancel]() -> bool {
@@ -274,28 +372,228 @@ void Json_importer::load_from(shcore::Buffered_input *input,
     return false;
   });
 
-  while (!input->eof() && !cancel) {
-    std::string jd = span_one_maybe_json(input);
+  std::string buffer;
 
-    if (strip_bson_objectid) {
-      strip_bson_object_id(&jd);
-    }
+  try {
+    while (!input->eof() && !cancel) {
+      const auto jd = next_document(input, strip_bson_objectid, &buffer);
 
-    if (!jd.empty()) {
-      // todo(kg): move jd string all the way to protobuf's
-      // Scalar_String::set_value
-      put(std::move(jd));
+      if (!jd.empty()) {
+        put(jd);
+      }
     }
+  } catch (...) {
+    abort_import();
+    throw;
   }
 
-  flush();
-  commit(true);
+  end_import();
 
   if (cancel) throw shcore::cancelled("JSON documents import cancelled.");
 }
 
-void Json_importer::put(const std::string &item) {
-  if (m_packet_size_tracker.will_overflow(item.size())) {
+void Json_importer::load_parallel_from(shcore::Buffered_input *input,
+                                       bool strip_bson_objectid) {
+  /**
+   * Imports the chunks through its own session and transaction.
+   */
+  class Worker : public Document_consumer {
+   public:
+    explicit Worker(std::unique_ptr<Json_importer> importer)
+        : m_importer(std::move(importer)) {}
+
+    void begin() override { m_importer->begin_import(); }
+
+    void consume(const shcore::Input_span &document) override {
+      m_importer->put(document);
+    }
+
+    void end() override { m_importer->end_import(); }
+
+    void abort() override { m_importer->abort_import(); }
+
+    const Json_importer &importer() const { return *m_importer; }
+
+   private:
+    std::unique_ptr<Json_importer> m_importer;
+  };
+
+  std::atomic<uint64_t> imported{0};
+  std::vector<std::unique_ptr<Worker>> workers;
+  std::vector<Document_consumer *> consumers;
+
+  // Each worker owns X Protocol session to the same target, first one reuses
+  // session of this importer.
+  for (int i = 0; i < m_threads; ++i) {
+    std::shared_ptr<mysqlshdk::db::mysqlx::Session> session = m_session;
+    if (i > 0) {
+      session = mysqlshdk::db::mysqlx::Session::create();
+      session->connect(m_session->get_connection_options());
+    }
+    std::unique_ptr<Json_importer> importer(new Json_importer(session));
+    importer->m_batch_insert = m_batch_insert;
+    importer->m_imported_by_workers = &imported;
+    workers.emplace_back(new Worker(std::move(importer)));
+    consumers.emplace_back(workers.back().get());
+  }
+
+  uint64_t reported = 0;
+  const auto report_progress = [this, &imported, &reported]() {
+    if (m_print && imported != reported) {
+      reported = imported;
+      m_print(".. " + std::to_string(reported));
+    }
+  };
+
+  std::exception_ptr error;
+  bool completed = false;
+
+  try {
+    completed = distribute_documents(input, strip_bson_objectid,
+                                     k_parallel_chunk_bytes, consumers,
+                                     report_progress);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  for (const auto &worker : workers) {
+    const auto &stats = worker->importer().m_stats;
+    m_stats.items_processed += stats.items_processed;
+    m_stats.bytes_processed += stats.bytes_processed;
+    m_stats.documents_successfully_imported +=
+        stats.documents_successfully_imported;
+  }
+
+  report_progress();
+
+  if (error) std::rethrow_exception(error);
+
+  if (!completed) throw shcore::cancelled("JSON documents import cancelled.");
+}
+
+bool distribute_documents(shcore::Buffered_input *input,
+                          bool strip_bson_objectid, size_t chunk_bytes,
+                          const std::vector<Document_consumer *> &consumers,
+                          const std::function<void()> &on_chunk) {
+  Chunk_queue queue(2 * consumers.size());
+  std::mutex state_mutex;
+  std::condition_variable all_finished;
+  size_t finished = 0;
+  bool failed = false;
+  std::atomic<bool> cancel{false};
+
+  const auto worker = [&](Document_consumer *consumer) {
+    bool begun = false;
+    bool completed = false;
+    std::exception_ptr error;
+
+    try {
+      consumer->begin();
+      begun = true;
+
+      Document_chunk chunk;
+
+      while (queue.pop(&chunk)) {
+        if (chunk.empty()) {
+          completed = true;
+          break;
+        }
+        for (const auto &doc : chunk.documents) {
+          consumer->consume(doc);
+        }
+      }
+    } catch (...) {
+      // rethrown once all consumers are finished
+      error = std::current_exception();
+      queue.shutdown();
+    }
+
+    // the last transaction of each consumer is committed only if all of them
+    // got to the end of input, batches already committed with COMMIT AND
+    // CHAIN are not undone
+    bool commit = false;
+    {
+      std::unique_lock<std::mutex> lock(state_mutex);
+      if (!completed) failed = true;
+      if (++finished == consumers.size()) {
+        all_finished.notify_all();
+      } else {
+        all_finished.wait(lock, [&finished, &consumers]() {
+          return finished == consumers.size();
+        });
+      }
+      commit = !failed;
+    }
+
+    if (commit) {
+      consumer->end();
+    } else if (begun) {
+      consumer->abort();
+    }
+
+    if (error) std::rethrow_exception(error);
+  };
+
+  Worker_threads threads(&cancel);
+  for (const auto consumer : consumers) {
+    threads.start([&worker, consumer]() { worker(consumer); });
+  }
+
+  try {
+    Document_chunk chunk;
+    std::string buffer;
+    bool queue_open = true;
+
+    while (!input->eof() && !cancel && queue_open) {
+      auto jd = next_document(input, strip_bson_objectid, &buffer);
+
+      if (!jd.empty()) {
+        if (jd.data == buffer.data()) {
+          // document is not backed by input mapping, chunk has to own it
+          chunk.storage.emplace_back(std::move(buffer));
+          buffer = std::string();
+          jd = shcore::Input_span(chunk.storage.back().data(),
+                                  chunk.storage.back().size());
+        }
+        chunk.bytes += jd.size;
+        chunk.documents.emplace_back(jd);
+      }
+
+      if (chunk.bytes >= chunk_bytes) {
+        queue_open = queue.push(std::move(chunk));
+        chunk = Document_chunk();
+
+        if (on_chunk) on_chunk();
+      }
+    }
+
+    if (cancel) {
+      // workers roll back their transactions, error of a failed one is
+      // rethrown
+      queue.shutdown();
+      threads.wait();
+      return false;
+    }
+
+    if (queue_open && !chunk.empty()) queue.push(std::move(chunk));
+  } catch (...) {
+    queue.shutdown();
+    threads.join();
+    throw;
+  }
+
+  // one end of input marker per worker
+  for (size_t i = 0; i < consumers.size(); ++i) {
+    if (!queue.push(Document_chunk{})) break;
+  }
+
+  threads.wait();
+
+  return true;
+}
+
+void Json_importer::put(const shcore::Input_span &item) {
+  if (m_packet_size_tracker.will_overflow(item.size)) {
     flush();
     if (m_packet_size_tracker.inserts_in_this_transaction >=
         k_inserts_per_transaction) {
@@ -303,7 +601,7 @@ void Json_importer::put(const std::string &item) {
     }
   }
 
-  m_stats.bytes_processed += item.size();
+  m_stats.bytes_processed += item.size;
   m_stats.items_processed++;
   add_to_request(item);
 }
@@ -315,6 +613,9 @@ void Json_importer::update_statistics(xcl::XQuery_result *xquery_result) {
   bool ret = xquery_result->try_get_affected_rows(&affected_rows);
   if (ret) {
     m_stats.documents_successfully_imported += affected_rows;
+    if (m_imported_by_workers) {
+      *m_imported_by_workers += affected_rows;
+    }
     if (m_print) {
       m_print(".. " + std::to_string(m_stats.documents_successfully_imported));
     }
@@ -387,11 +688,11 @@ void Json_importer::commit(bool final_commit) {
   m_packet_size_tracker.inserts_in_this_transaction = 0;
 }
 
-void Json_importer::add_to_request(const std::string &doc) {
+void Json_importer::add_to_request(const shcore::Input_span &doc) {
   auto fields = m_batch_insert.mutable_row()->Add()->mutable_field();
-  mysqlshdk::db::mysqlx::util::set_scalar(*fields->Add(), doc);
+  mysqlshdk::db::mysqlx::util::set_scalar(*fields->Add(), doc.data, doc.size);
 
-  m_packet_size_tracker.bytes_in_insert += doc.size();
+  m_packet_size_tracker.bytes_in_insert += doc.size;
   m_packet_size_tracker.rows_in_insert++;
 }
 }  // namespace mysqlsh
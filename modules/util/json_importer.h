@@ -24,8 +24,11 @@
 #ifndef MODULES_UTIL_JSON_IMPORTER_H_
 #define MODULES_UTIL_JSON_IMPORTER_H_
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 #include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/utils/nullable.h"
@@ -182,6 +185,40 @@ class Prepare_json_import {
   bool m_put_to_collection = true;
 };
 
+/**
+ * Receives the documents read by distribute_documents(), each consumer is
+ * used by a single thread.
+ */
+class Document_consumer {
+ public:
+  virtual ~Document_consumer() = default;
+
+  virtual void begin() = 0;
+  virtual void consume(const shcore::Input_span &document) = 0;
+  virtual void end() = 0;
+
+  /**
+   * Called instead of end() if import fails or is cancelled, must not throw.
+   */
+  virtual void abort() = 0;
+};
+
+/**
+ * Reads the documents from the input in the calling thread and hands them in
+ * document-aligned chunks of about `chunk_bytes` to the consumers, each one
+ * running in its own thread.
+ *
+ * First error thrown by a consumer stops the reader and the remaining
+ * consumers, which are aborted, and is rethrown once all threads finish.
+ *
+ * @param on_chunk Called by the reader after each chunk is queued.
+ * @return false if import was cancelled by the user.
+ */
+bool distribute_documents(shcore::Buffered_input *input,
+                          bool strip_bson_objectid, size_t chunk_bytes,
+                          const std::vector<Document_consumer *> &consumers,
+                          const std::function<void()> &on_chunk = {});
+
 class Json_importer {
  public:
   explicit Json_importer(
@@ -200,17 +237,39 @@ class Json_importer {
    * @param path Path to JSON document. Empty path enables read from stdin.
    */
   void set_path(const std::string &path) { m_file_path = path; }
+
+  /**
+   * Set number of X Protocol sessions used to import documents.
+   *
+   * When more than one thread is requested, the calling thread only splits
+   * input into document-aligned chunks, while each worker thread inserts
+   * them through its own session and transaction.
+   *
+   * Every worker commits its transaction after each batch of inserts. If the
+   * import fails or is cancelled, each worker rolls back only its current
+   * transaction, documents from the batches committed before remain imported,
+   * just like when a single thread is used.
+   *
+   * @param threads Number of worker threads, must be greater than 0.
+   */
+  void set_threads(int threads);
+
   void load_from(bool strip_bson_objectid);
 
   void print_stats();
 
  private:
   void load_from(shcore::Buffered_input *input, bool strip_bson_objectid);
-  void put(const std::string &item);
+  void load_parallel_from(shcore::Buffered_input *input,
+                          bool strip_bson_objectid);
+  void begin_import();
+  void end_import();
+  void abort_import();
+  void put(const shcore::Input_span &item);
   void recv_response(bool block = false);
   void flush();
   void commit(bool final_commit = false);
-  void add_to_request(const std::string &doc);
+  void add_to_request(const shcore::Input_span &doc);
   void update_statistics(xcl::XQuery_result *xquery_result);
 
   ::Mysqlx::Crud::Insert m_batch_insert;
@@ -284,8 +343,12 @@ class Json_importer {
   const bool m_proto_interleaved = true;
 #endif
   int m_pending_response = 0;
+  int m_threads = 1;
   std::function<void(const std::string &)> m_print = nullptr;
 
+  /// Documents imported by all workers, only set for parallel import workers.
+  std::atomic<uint64_t> *m_imported_by_workers = nullptr;
+
   struct {
     uint64_t items_processed = 0;
     uint64_t bytes_processed = 0;
@@ -22,20 +22,28 @@
  */
 
 #include "modules/util/mod_util.h"
+#include <atomic>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <vector>
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
+#include "modules/util/compare_table.h"
+#include "modules/util/dump_schemas.h"
+#include "modules/util/import_table.h"
 #include "modules/util/json_importer.h"
 #include "modules/util/upgrade_check.h"
+#include "modules/util/worker_threads.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "rapidjson/document.h"
 #include "rapidjson/error/en.h"
@@ -48,10 +56,12 @@ namespace mysqlsh {
 REGISTER_HELP_OBJECT(util, shellapi);
 REGISTER_HELP(UTIL_GLOBAL_BRIEF,
               "Global object that groups miscellaneous tools like upgrade "
-              "checker and JSON import.");
+              "checker, JSON import, table import, dump and table "
+              "comparison.");
 REGISTER_HELP(UTIL_BRIEF,
               "Global object that groups miscellaneous tools like upgrade "
-              "checker and JSON import.");
+              "checker, JSON import, table import, dump and table "
+              "comparison.");
 
 Util::Util(shcore::IShell_core *owner) : _shell_core(*owner) {
   add_method(
@@ -60,6 +70,14 @@ Util::Util(shcore::IShell_core *owner) : _shell_core(*owner) {
       "data", shcore::Map);
 
   expose("importJson", &Util::import_json, "path", "options");
+
+  expose("importTable", &Util::import_table, "path", "options");
+
+  expose("dumpSchemas", &Util::dump_schemas, "schemas", "outputDir",
+         "?options");
+
+  expose("compareTable", &Util::compare_table, "schema", "table", "instances",
+         "?options");
 }
 
 static std::string format_upgrade_issue(const Upgrade_issue &problem) {
@@ -288,6 +306,78 @@ Upgrade_check_output_formatter::get_formatter(const std::string &format) {
       new Text_upgrade_checker_output());
 }
 
+namespace {
+struct Check_outcome {
+  std::vector<Upgrade_issue> issues;
+  std::string error;
+  bool failed = false;
+};
+
+void run_check(Upgrade_check *check,
+               const std::vector<std::shared_ptr<mysqlshdk::db::ISession>>
+                   &sessions,
+               Check_outcome *outcome) {
+  try {
+    // CHECK TABLE is the most expensive check, it gets all the sessions
+    if (auto table_check = dynamic_cast<Check_table_command *>(check))
+      outcome->issues = table_check->run(sessions);
+    else
+      outcome->issues = check->run(sessions.front());
+  } catch (const std::exception &e) {
+    outcome->failed = true;
+    outcome->error = e.what();
+  }
+}
+
+/**
+ * Runs the checks and returns their outcome in the order of the checklist.
+ *
+ * With more than one session, the SQL based checks are independent from each
+ * other and are distributed among the sessions, Check_table_command is run
+ * afterwards, once all of the sessions are available to it.
+ */
+std::vector<Check_outcome> run_checks(
+    const std::vector<std::unique_ptr<Upgrade_check>> &checklist,
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions) {
+  std::vector<Check_outcome> outcomes(checklist.size());
+
+  if (sessions.size() == 1) {
+    for (size_t i = 0; i < checklist.size(); i++)
+      run_check(checklist[i].get(), sessions, &outcomes[i]);
+    return outcomes;
+  }
+
+  std::vector<size_t> deferred;
+  std::vector<size_t> independent;
+  for (size_t i = 0; i < checklist.size(); i++) {
+    if (dynamic_cast<Check_table_command *>(checklist[i].get()))
+      deferred.push_back(i);
+    else
+      independent.push_back(i);
+  }
+
+  std::atomic<size_t> next{0};
+  Worker_threads workers;
+
+  for (const auto &session : sessions) {
+    workers.start([&, session]() {
+      size_t i;
+      while ((i = next++) < independent.size()) {
+        const size_t index = independent[i];
+        run_check(checklist[index].get(), {session}, &outcomes[index]);
+      }
+    });
+  }
+
+  workers.wait();
+
+  for (const auto index : deferred)
+    run_check(checklist[index].get(), sessions, &outcomes[index]);
+
+  return outcomes;
+}
+}  // namespace
+
 REGISTER_HELP_FUNCTION(checkForServerUpgrade, util);
 REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_BRIEF,
               "Performs series of tests on specified MySQL server to check if "
@@ -314,7 +404,11 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL3,
 REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL4,
               "@li password - password for connection.");
 
-REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL5, "${TOPIC_CONNECTION_DATA}");
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL5,
+              "@li threads - number of sessions used to run the checks in "
+              "parallel (default=1).");
+
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
 
 /**
  * \ingroup util
@@ -374,12 +468,15 @@ shcore::Value Util::check_for_server_upgrade(
 
     std::string output_format("TEXT");
     std::string target_version(MYSH_VERSION);
+    int64_t threads = 1;
     if (args.size() > 0 &&
         args[args.size() - 1].type == shcore::Value_type::Map) {
       auto dict = args.map_at(args.size() - 1);
       output_format = dict->get_string("outputFormat", output_format);
       target_version = dict->get_string("targetVersion", target_version);
       if (target_version == "8.0") target_version.assign(MYSH_VERSION);
+      threads = dict->get_int("threads", threads);
+      validate_threads(threads);
     }
 
     auto print = Upgrade_check_output_formatter::get_formatter(output_format);
@@ -419,26 +516,41 @@ shcore::Value Util::check_for_server_upgrade(
     auto checklist =
         Upgrade_check::create_checklist(current_version, target_version);
 
-    for (size_t i = 0; i < checklist.size(); i++) try {
-        std::vector<Upgrade_issue> issues = checklist[i]->run(session);
-
-        for (const auto &issue : issues) switch (issue.level) {
-            case Upgrade_issue::ERROR:
-              errors++;
-              break;
-            case Upgrade_issue::WARNING:
-              warnings++;
-              break;
-            default:
-              notices++;
-              break;
-          }
-
-        print->check_results(*checklist[i], issues);
-      } catch (const std::exception &e) {
-        print->check_error(*checklist[i], e.what());
+    // Additional sessions for the checks to run in parallel, the credentials
+    // used by the first session are reused (the password may have been
+    // prompted for)
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+    for (int64_t i = 1; i < threads; ++i)
+      sessions.emplace_back(
+          establish_session(session->get_connection_options(), false));
+
+    std::vector<Check_outcome> outcomes = run_checks(checklist, sessions);
+
+    for (size_t i = 0; i < checklist.size(); i++) {
+      if (outcomes[i].failed) {
+        print->check_error(*checklist[i], outcomes[i].error.c_str());
+        continue;
       }
 
+      const std::vector<Upgrade_issue> &issues = outcomes[i].issues;
+
+      for (const auto &issue : issues) switch (issue.level) {
+          case Upgrade_issue::ERROR:
+            errors++;
+            break;
+          case Upgrade_issue::WARNING:
+            warnings++;
+            break;
+          default:
+            notices++;
+            break;
+        }
+
+      print->check_results(*checklist[i], issues);
+    }
+
+    for (size_t i = 1; i < sessions.size(); ++i) sessions[i]->close();
+
     std::string summary;
     if (errors > 0) {
       summary = shcore::str_format(
@@ -498,20 +610,24 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL5,
               "Extended JSON");
 
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL6,
+              "@li threads: int (default: 1) - number of X Protocol sessions "
+              "used to import documents in parallel.");
+
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL7,
               "If the schema is not provided, an active schema on the global "
               "session, if set, will be used.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL7,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL8,
               "The collection and the table options cannot be combined. If "
               "they are not provided, the basename of the file without "
               "extension will be used as target collection name.");
 
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL8,
+    UTIL_IMPORTJSON_DETAIL9,
     "If the target collection or table does not exist, they are created, "
     "otherwise the data is inserted into the existing collection or table.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL9,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
               "The tableColumn imply use of the table and cannot be combined "
               "with the collection.");
 
@@ -556,6 +672,7 @@ REGISTER_HELP(UTIL_IMPORTJSON_THROWS12, "@li JSON document is ill-formed");
  * $(UTIL_IMPORTJSON_DETAIL7)
  * $(UTIL_IMPORTJSON_DETAIL8)
  * $(UTIL_IMPORTJSON_DETAIL9)
+ * $(UTIL_IMPORTJSON_DETAIL10)
  *
  * $(UTIL_IMPORTJSON_THROWS)
  * $(UTIL_IMPORTJSON_THROWS1)
@@ -582,7 +699,8 @@ void Util::import_json(const std::string &file,
     {
       const shcore::Argument_map opts(*options);
       const std::set<std::string> valid_options{
-          "schema", "collection", "table", "tableColumn", "convertBsonOid"};
+          "schema",         "collection", "table", "tableColumn",
+          "convertBsonOid", "threads"};
       opts.ensure_keys({}, valid_options, "the options");
     }
 
@@ -643,6 +761,10 @@ void Util::import_json(const std::string &file,
     // Validate provided parameters and build Json_importer object.
     auto importer = prepare.build();
 
+    if (options->has_key("threads")) {
+      importer.set_threads(options->get_int("threads"));
+    }
+
     auto console = mysqlsh::current_console();
     console->print_info(prepare.to_string() + " in MySQL Server at " +
                         connection_options.as_uri(
@@ -663,4 +785,602 @@ void Util::import_json(const std::string &file,
   }
   CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("importJson"));
 }
+
+REGISTER_HELP_FUNCTION(importTable, util);
+REGISTER_HELP(UTIL_IMPORTTABLE_BRIEF,
+              "Import a delimited file to table in MySQL Server using classic "
+              "protocol sessions in parallel.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_PARAM, "@param file Path to the delimited file");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_PARAM1,
+              "@param options Dictionary with options");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL, "Options dictionary:");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL1,
+              "@li schema: string - name of target schema.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL2,
+              "@li table: string - name of table where the data will be "
+              "imported.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL3,
+              "@li columns: array of strings - columns which receive the "
+              "fields of each row, all columns of the table by default.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL4,
+              "@li dialect: string (default: \"default\") - format of the "
+              "file, one of \"default\", \"csv\", \"tsv\" or "
+              "\"csv-unix\", sets the defaults of the field and line "
+              "options.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL5,
+              "@li fieldsTerminatedBy: string (default: \"\\t\") - string "
+              "which separates the fields.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL6,
+              "@li fieldsEnclosedBy: char (default: '') - character which "
+              "encloses the fields.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL7,
+              "@li fieldsOptionallyEnclosed: bool (default: false) - only "
+              "fields of string types are enclosed.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL8,
+              "@li fieldsEscapedBy: char (default: '\\') - character which "
+              "escapes the special characters.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL9,
+              "@li linesTerminatedBy: string (default: \"\\n\") - string "
+              "which terminates the rows.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL10,
+              "@li replaceDuplicates: bool (default: false) - rows which "
+              "duplicate an existing row on a unique key replace it, they are "
+              "skipped otherwise.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL11,
+              "@li skipRows: int (default: 0) - number of rows skipped at the "
+              "beginning of the file.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL12,
+              "@li threads: int (default: 8) - number of classic protocol "
+              "sessions used to import data in parallel.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL13,
+              "@li bytesPerChunk: int (default: 52428800) - approximate size "
+              "of the data loaded by a single LOAD DATA statement.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL14,
+              "If the schema is not provided, an active schema on the global "
+              "session, if set, will be used. If the table is not provided, "
+              "the basename of the file without extension will be used as "
+              "target table name.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_DETAIL15,
+              "The file is split into chunks which end at row boundaries, each "
+              "chunk is sent using LOAD DATA LOCAL INFILE statement, which "
+              "requires the local_infile server variable to be enabled. The "
+              "target table has to exist.");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS, "Throws ArgumentError when:");
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS1, "@li Option name is invalid");
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS2,
+              "@li Dialect or field and line options are invalid");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS3, "Throws LogicError when:");
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS4,
+              "@li Path to the file does not exists or is not a file");
+
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS5, "Throws RuntimeError when:");
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS6,
+              "@li Shell is not connected to MySQL Server using classic "
+              "protocol");
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS7,
+              "@li Schema is not provided and there is no active schema on the "
+              "global session");
+REGISTER_HELP(UTIL_IMPORTTABLE_THROWS8, "@li MySQL Server returns an error");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_IMPORTTABLE_BRIEF)
+ *
+ * $(UTIL_IMPORTTABLE_PARAM)
+ * $(UTIL_IMPORTTABLE_PARAM1)
+ *
+ * $(UTIL_IMPORTTABLE_DETAIL)
+ * $(UTIL_IMPORTTABLE_DETAIL1)
+ * $(UTIL_IMPORTTABLE_DETAIL2)
+ * $(UTIL_IMPORTTABLE_DETAIL3)
+ * $(UTIL_IMPORTTABLE_DETAIL4)
+ * $(UTIL_IMPORTTABLE_DETAIL5)
+ * $(UTIL_IMPORTTABLE_DETAIL6)
+ * $(UTIL_IMPORTTABLE_DETAIL7)
+ * $(UTIL_IMPORTTABLE_DETAIL8)
+ * $(UTIL_IMPORTTABLE_DETAIL9)
+ * $(UTIL_IMPORTTABLE_DETAIL10)
+ * $(UTIL_IMPORTTABLE_DETAIL11)
+ * $(UTIL_IMPORTTABLE_DETAIL12)
+ * $(UTIL_IMPORTTABLE_DETAIL13)
+ * $(UTIL_IMPORTTABLE_DETAIL14)
+ * $(UTIL_IMPORTTABLE_DETAIL15)
+ *
+ * $(UTIL_IMPORTTABLE_THROWS)
+ * $(UTIL_IMPORTTABLE_THROWS1)
+ * $(UTIL_IMPORTTABLE_THROWS2)
+ * $(UTIL_IMPORTTABLE_THROWS3)
+ * $(UTIL_IMPORTTABLE_THROWS4)
+ * $(UTIL_IMPORTTABLE_THROWS5)
+ * $(UTIL_IMPORTTABLE_THROWS6)
+ * $(UTIL_IMPORTTABLE_THROWS7)
+ * $(UTIL_IMPORTTABLE_THROWS8)
+ */
+#if DOXYGEN_JS
+Undefined Util::importTable(String file, Dictionary options);
+#elif DOXYGEN_PY
+None Util::import_table(str file, dict options);
+#endif
+void Util::import_table(const std::string &file,
+                        const shcore::Dictionary_t &options) {
+  try {
+    {
+      const shcore::Argument_map opts(*options);
+      const std::set<std::string> valid_options{"schema",
+                                                "table",
+                                                "columns",
+                                                "dialect",
+                                                "fieldsTerminatedBy",
+                                                "fieldsEnclosedBy",
+                                                "fieldsOptionallyEnclosed",
+                                                "fieldsEscapedBy",
+                                                "linesTerminatedBy",
+                                                "replaceDuplicates",
+                                                "skipRows",
+                                                "threads",
+                                                "bytesPerChunk"};
+      opts.ensure_keys({}, valid_options, "the options");
+    }
+
+    auto shell_session = _shell_core.get_dev_session();
+
+    if (!shell_session) {
+      throw shcore::Exception::runtime_error(
+          "Please connect the shell to the MySQL server.");
+    }
+
+    if (shell_session->session_type() != SessionType::Classic) {
+      throw shcore::Exception::runtime_error(
+          "A classic protocol session is required for table import.");
+    }
+
+    const auto full_path = shcore::path::expand_user(file);
+
+    if (!shcore::file_exists(full_path)) {
+      throw shcore::Exception::logic_error("Path \"" + full_path +
+                                           "\" does not exist.");
+    }
+
+    if (!shcore::is_file(full_path)) {
+      throw shcore::Exception::logic_error("Path \"" + full_path +
+                                           "\" is not a file.");
+    }
+
+    std::string schema;
+    if (options->has_key("schema")) {
+      schema = options->get_string("schema");
+    } else if (!shell_session->get_current_schema().empty()) {
+      schema = shell_session->get_current_schema();
+    } else {
+      throw std::runtime_error(
+          "There is no active schema on the current session, the target schema "
+          "for the import operation must be provided in the options.");
+    }
+
+    const std::string table =
+        options->has_key("table")
+            ? options->get_string("table")
+            : std::get<0>(shcore::path::split_extension(
+                  shcore::path::basename(full_path)));
+
+    auto dialect = Import_table_dialect::from_name(
+        options->get_string("dialect", "default"));
+
+    if (options->has_key("fieldsTerminatedBy"))
+      dialect.fields_terminated_by = options->get_string("fieldsTerminatedBy");
+    if (options->has_key("fieldsEnclosedBy"))
+      dialect.fields_enclosed_by = options->get_string("fieldsEnclosedBy");
+    if (options->has_key("fieldsOptionallyEnclosed"))
+      dialect.fields_optionally_enclosed =
+          options->get_bool("fieldsOptionallyEnclosed");
+    if (options->has_key("fieldsEscapedBy"))
+      dialect.fields_escaped_by = options->get_string("fieldsEscapedBy");
+    if (options->has_key("linesTerminatedBy"))
+      dialect.lines_terminated_by = options->get_string("linesTerminatedBy");
+
+    const auto &connection_options = shell_session->get_connection_options();
+    Import_table importer{connection_options};
+
+    importer.set_path(full_path);
+    importer.set_target_table(schema, table);
+    importer.set_dialect(dialect);
+
+    if (options->has_key("columns")) {
+      std::vector<std::string> columns;
+      for (const auto &column : *options->get_array("columns")) {
+        columns.emplace_back(column.as_string());
+      }
+      importer.set_columns(columns);
+    }
+
+    importer.set_replace_duplicates(
+        options->get_bool("replaceDuplicates", false));
+    importer.set_skip_rows(options->get_uint("skipRows", 0));
+
+    if (options->has_key("threads")) {
+      importer.set_threads(options->get_int("threads"));
+    }
+
+    if (options->has_key("bytesPerChunk")) {
+      importer.set_bytes_per_chunk(options->get_uint("bytesPerChunk"));
+    }
+
+    auto console = mysqlsh::current_console();
+    console->print_info("Importing from file \"" + full_path +
+                        "\" to table `" + schema + "`.`" + table +
+                        "` in MySQL Server at " +
+                        connection_options.as_uri(
+                            mysqlshdk::db::uri::formats::only_transport()) +
+                        "\n");
+
+    importer.set_print_callback([](const std::string &msg) -> void {
+      mysqlsh::current_console()->print(msg);
+    });
+
+    try {
+      importer.load();
+    } catch (...) {
+      importer.print_stats();
+      throw;
+    }
+    importer.print_stats();
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("importTable"));
+}
+
+REGISTER_HELP_FUNCTION(dumpSchemas, util);
+REGISTER_HELP(UTIL_DUMPSCHEMAS_BRIEF,
+              "Dumps schemas from MySQL Server to a directory, reading table "
+              "data in parallel using classic protocol sessions.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_PARAM,
+              "@param schemas List of schemas to be dumped");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_PARAM1,
+              "@param outputDir Path to the directory where the dump is "
+              "written, it must not exist or be empty");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_PARAM2,
+              "@param options Optional dictionary with options");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL, "Options dictionary:");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL1,
+              "@li tables: array of strings - only these tables are dumped, "
+              "requires a single schema.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL2,
+              "@li threads: int (default: 4) - number of classic protocol "
+              "sessions used to read data in parallel.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL3,
+              "@li rowsPerChunk: int (default: 250000) - approximate number of "
+              "rows in a single data file.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL4,
+              "@li compression: string (default: \"gzip\") - compression of "
+              "the data files, \"gzip\" or \"none\".");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL5,
+              "@li consistent: bool (default: true) - all data is read from "
+              "the same consistent snapshot, a global read lock is held while "
+              "the snapshot is being created.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL6,
+              "Tables which have a primary key are split into chunks on its "
+              "ranges, other tables are dumped to a single file. Views, "
+              "routines, triggers and events are not dumped.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_DETAIL7,
+              "The directory holds a <schema>.sql file with DDL of each schema "
+              "and its tables, a <schema>@<table>.json file with metadata of "
+              "each table and its data in the <schema>@<table>@<chunk>.tsv "
+              "files, which can be loaded using util.importTable() with the "
+              "default dialect. The @.json file is written once the dump is "
+              "complete.");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS, "Throws ArgumentError when:");
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS1, "@li Option name is invalid");
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS2,
+              "@li No schemas are given or tables are given for multiple "
+              "schemas");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS3, "Throws LogicError when:");
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS4,
+              "@li Output path is not a directory or the directory is not "
+              "empty");
+
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS5, "Throws RuntimeError when:");
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS6,
+              "@li Shell is not connected to MySQL Server using classic "
+              "protocol");
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS7,
+              "@li The schema or the table does not exist");
+REGISTER_HELP(UTIL_DUMPSCHEMAS_THROWS8, "@li MySQL Server returns an error");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_DUMPSCHEMAS_BRIEF)
+ *
+ * $(UTIL_DUMPSCHEMAS_PARAM)
+ * $(UTIL_DUMPSCHEMAS_PARAM1)
+ * $(UTIL_DUMPSCHEMAS_PARAM2)
+ *
+ * $(UTIL_DUMPSCHEMAS_DETAIL)
+ * $(UTIL_DUMPSCHEMAS_DETAIL1)
+ * $(UTIL_DUMPSCHEMAS_DETAIL2)
+ * $(UTIL_DUMPSCHEMAS_DETAIL3)
+ * $(UTIL_DUMPSCHEMAS_DETAIL4)
+ * $(UTIL_DUMPSCHEMAS_DETAIL5)
+ * $(UTIL_DUMPSCHEMAS_DETAIL6)
+ * $(UTIL_DUMPSCHEMAS_DETAIL7)
+ *
+ * $(UTIL_DUMPSCHEMAS_THROWS)
+ * $(UTIL_DUMPSCHEMAS_THROWS1)
+ * $(UTIL_DUMPSCHEMAS_THROWS2)
+ * $(UTIL_DUMPSCHEMAS_THROWS3)
+ * $(UTIL_DUMPSCHEMAS_THROWS4)
+ * $(UTIL_DUMPSCHEMAS_THROWS5)
+ * $(UTIL_DUMPSCHEMAS_THROWS6)
+ * $(UTIL_DUMPSCHEMAS_THROWS7)
+ * $(UTIL_DUMPSCHEMAS_THROWS8)
+ */
+#if DOXYGEN_JS
+Undefined Util::dumpSchemas(List schemas, String outputDir,
+                            Dictionary options);
+#elif DOXYGEN_PY
+None Util::dump_schemas(list schemas, str outputDir, dict options);
+#endif
+void Util::dump_schemas(const std::vector<std::string> &schemas,
+                        const std::string &output_dir,
+                        const shcore::Dictionary_t &options) {
+  try {
+    if (options) {
+      const shcore::Argument_map opts(*options);
+      const std::set<std::string> valid_options{
+          "tables", "threads", "rowsPerChunk", "compression", "consistent"};
+      opts.ensure_keys({}, valid_options, "the options");
+    }
+
+    auto shell_session = _shell_core.get_dev_session();
+
+    if (!shell_session) {
+      throw shcore::Exception::runtime_error(
+          "Please connect the shell to the MySQL server.");
+    }
+
+    if (shell_session->session_type() != SessionType::Classic) {
+      throw shcore::Exception::runtime_error(
+          "A classic protocol session is required for dump.");
+    }
+
+    const auto &connection_options = shell_session->get_connection_options();
+    Dump_schemas dumper{connection_options};
+
+    dumper.set_schemas(schemas);
+    dumper.set_output_directory(shcore::path::expand_user(output_dir));
+
+    if (options) {
+      if (options->has_key("tables")) {
+        std::vector<std::string> tables;
+        for (const auto &table : *options->get_array("tables")) {
+          tables.emplace_back(table.as_string());
+        }
+        dumper.set_tables(tables);
+      }
+
+      if (options->has_key("threads")) {
+        dumper.set_threads(options->get_int("threads"));
+      }
+
+      if (options->has_key("rowsPerChunk")) {
+        dumper.set_rows_per_chunk(options->get_uint("rowsPerChunk"));
+      }
+
+      if (options->has_key("compression")) {
+        dumper.set_compression(Dump_schemas::compression_from_name(
+            options->get_string("compression")));
+      }
+
+      dumper.set_consistent(options->get_bool("consistent", true));
+    }
+
+    auto console = mysqlsh::current_console();
+    console->print_info("Dumping schemas " + shcore::str_join(schemas, ", ") +
+                        " from MySQL Server at " +
+                        connection_options.as_uri(
+                            mysqlshdk::db::uri::formats::only_transport()) +
+                        " to \"" + output_dir + "\"\n");
+
+    dumper.set_print_callback([](const std::string &msg) -> void {
+      mysqlsh::current_console()->print(msg);
+    });
+
+    try {
+      dumper.run();
+    } catch (...) {
+      dumper.print_stats();
+      throw;
+    }
+    dumper.print_stats();
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("dumpSchemas"));
+}
+
+REGISTER_HELP_FUNCTION(compareTable, util);
+REGISTER_HELP(UTIL_COMPARETABLE_BRIEF,
+              "Compares contents of a table on multiple instances of MySQL "
+              "Server, computing checksums of its chunks in parallel.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_PARAM,
+              "@param schema Name of the schema of the table");
+
+REGISTER_HELP(UTIL_COMPARETABLE_PARAM1,
+              "@param table Name of the table to be compared");
+
+REGISTER_HELP(UTIL_COMPARETABLE_PARAM2,
+              "@param instances List with connection data of at least two "
+              "instances, the first one is the reference");
+
+REGISTER_HELP(UTIL_COMPARETABLE_PARAM3,
+              "@param options Optional dictionary with options");
+
+REGISTER_HELP(UTIL_COMPARETABLE_RETURNS,
+              "@returns true if the table is the same on all instances.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_DETAIL, "Options dictionary:");
+
+REGISTER_HELP(UTIL_COMPARETABLE_DETAIL1,
+              "@li threads: int (default: 4) - number of parallel workers, "
+              "each one has a classic protocol session to every instance.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_DETAIL2,
+              "@li rowsPerChunk: int (default: 100000) - approximate number of "
+              "rows in a single chunk.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_DETAIL3,
+              "The table is split into chunks on the ranges of its primary "
+              "key. The checksum of each chunk is computed by the server. The "
+              "rows of a chunk are fetched and compared only if its checksum "
+              "differs from the one on the first instance.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_DETAIL4,
+              "If connection data of an instance does not specify the user, "
+              "the credentials of the global session are used.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_DETAIL5,
+              "The instances should not be modified during the comparison, "
+              "concurrent changes may be reported as differences.");
+
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS, "Throws ArgumentError when:");
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS1, "@li Option name is invalid");
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS2,
+              "@li Less than two instances are given");
+
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS3, "Throws RuntimeError when:");
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS4,
+              "@li The table does not exist or has different columns on one of "
+              "the instances");
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS5,
+              "@li The table does not have a primary key");
+REGISTER_HELP(UTIL_COMPARETABLE_THROWS6, "@li MySQL Server returns an error");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COMPARETABLE_BRIEF)
+ *
+ * $(UTIL_COMPARETABLE_PARAM)
+ * $(UTIL_COMPARETABLE_PARAM1)
+ * $(UTIL_COMPARETABLE_PARAM2)
+ * $(UTIL_COMPARETABLE_PARAM3)
+ *
+ * $(UTIL_COMPARETABLE_RETURNS)
+ *
+ * $(UTIL_COMPARETABLE_DETAIL)
+ * $(UTIL_COMPARETABLE_DETAIL1)
+ * $(UTIL_COMPARETABLE_DETAIL2)
+ * $(UTIL_COMPARETABLE_DETAIL3)
+ * $(UTIL_COMPARETABLE_DETAIL4)
+ * $(UTIL_COMPARETABLE_DETAIL5)
+ *
+ * $(UTIL_COMPARETABLE_THROWS)
+ * $(UTIL_COMPARETABLE_THROWS1)
+ * $(UTIL_COMPARETABLE_THROWS2)
+ * $(UTIL_COMPARETABLE_THROWS3)
+ * $(UTIL_COMPARETABLE_THROWS4)
+ * $(UTIL_COMPARETABLE_THROWS5)
+ * $(UTIL_COMPARETABLE_THROWS6)
+ */
+#if DOXYGEN_JS
+Bool Util::compareTable(String schema, String table, List instances,
+                        Dictionary options);
+#elif DOXYGEN_PY
+bool Util::compare_table(str schema, str table, list instances, dict options);
+#endif
+bool Util::compare_table(const std::string &schema, const std::string &table,
+                         const shcore::Array_t &instances,
+                         const shcore::Dictionary_t &options) {
+  try {
+    if (options) {
+      const shcore::Argument_map opts(*options);
+      const std::set<std::string> valid_options{"threads", "rowsPerChunk"};
+      opts.ensure_keys({}, valid_options, "the options");
+    }
+
+    if (!instances) {
+      throw shcore::Exception::argument_error(
+          "At least two instances are required to compare a table.");
+    }
+
+    auto shell_session = _shell_core.get_dev_session();
+    std::vector<mysqlshdk::db::Connection_options> targets;
+
+    for (const auto &instance : *instances) {
+      auto target = mysqlsh::get_connection_options(instance);
+
+      if (!target.has_user() && shell_session) {
+        target.set_login_options_from(shell_session->get_connection_options());
+      }
+
+      targets.emplace_back(std::move(target));
+    }
+
+    Compare_table compare{targets, schema, table};
+
+    if (options) {
+      if (options->has_key("threads")) {
+        compare.set_threads(options->get_int("threads"));
+      }
+
+      if (options->has_key("rowsPerChunk")) {
+        compare.set_rows_per_chunk(options->get_uint("rowsPerChunk"));
+      }
+    }
+
+    auto console = mysqlsh::current_console();
+    console->print_info("Comparing table `" + schema + "`.`" + table +
+                        "` on " + std::to_string(targets.size()) +
+                        " instances\n");
+
+    compare.set_print_callback([](const std::string &msg) -> void {
+      mysqlsh::current_console()->print(msg);
+    });
+
+    bool identical = false;
+
+    try {
+      identical = compare.run();
+    } catch (...) {
+      compare.print_stats();
+      throw;
+    }
+    compare.print_stats();
+
+    return identical;
+  }
+  CATCH_AND_TRANSLATE_FUNCTION_EXCEPTION(get_function_name("compareTable"));
+}
 }  // namespace mysqlsh
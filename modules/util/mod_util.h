@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include "scripting/types_cpp.h"
 
 namespace shcore {
@@ -62,6 +63,33 @@ class SHCORE_PUBLIC Util : public shcore::Cpp_object_bridge,
   void import_json(const std::string &file,
                    const shcore::Dictionary_t &options);
 
+#if DOXYGEN_JS
+  Undefined importTable(String file, Dictionary options);
+#elif DOXYGEN_PY
+  None import_table(str file, dict options);
+#endif
+  void import_table(const std::string &file,
+                    const shcore::Dictionary_t &options);
+
+#if DOXYGEN_JS
+  Undefined dumpSchemas(List schemas, String outputDir, Dictionary options);
+#elif DOXYGEN_PY
+  None dump_schemas(list schemas, str outputDir, dict options);
+#endif
+  void dump_schemas(const std::vector<std::string> &schemas,
+                    const std::string &output_dir,
+                    const shcore::Dictionary_t &options);
+
+#if DOXYGEN_JS
+  Bool compareTable(String schema, String table, List instances,
+                    Dictionary options);
+#elif DOXYGEN_PY
+  bool compare_table(str schema, str table, list instances, dict options);
+#endif
+  bool compare_table(const std::string &schema, const std::string &table,
+                     const shcore::Array_t &instances,
+                     const shcore::Dictionary_t &options);
+
  private:
   shcore::IShell_core &_shell_core;
 };
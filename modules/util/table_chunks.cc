@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include "modules/util/table_chunks.h"
+#include <utility>
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace table_chunks {
+
+namespace {
+
+bool is_numeric_type(const std::string &data_type) {
+  return is_integer_type(data_type) || data_type == "decimal" ||
+         data_type == "float" || data_type == "double" || data_type == "year";
+}
+
+/*
+ * Chunk boundaries are read from the server and used in the WHERE conditions,
+ * binary strings are transferred as hex literals.
+ */
+std::string boundary_expression(const std::string &column,
+                                const std::string &data_type) {
+  if (is_binary_string_type(data_type)) return "HEX(" + quote(column) + ")";
+  if (is_ordered_as_number(data_type)) return quote(column) + " + 0";
+  return quote(column);
+}
+
+std::string boundary_literal(const std::string &value,
+                             const std::string &data_type) {
+  if (is_binary_string_type(data_type)) return "X'" + value + "'";
+  if (is_numeric_type(data_type) || is_ordered_as_number(data_type)) {
+    return value;
+  }
+  return shcore::sqlstring("?", 0) << value;
+}
+
+}  // namespace
+
+std::string quote(const std::string &identifier) {
+  return shcore::quote_identifier(shcore::escape_backticks(identifier), '`');
+}
+
+bool is_integer_type(const std::string &data_type) {
+  return data_type == "tinyint" || data_type == "smallint" ||
+         data_type == "mediumint" || data_type == "int" ||
+         data_type == "bigint";
+}
+
+bool is_binary_string_type(const std::string &data_type) {
+  return data_type == "binary" || data_type == "varbinary" ||
+         data_type == "tinyblob" || data_type == "blob" ||
+         data_type == "mediumblob" || data_type == "longblob";
+}
+
+bool is_ordered_as_number(const std::string &data_type) {
+  return data_type == "enum" || data_type == "set" || data_type == "bit";
+}
+
+std::vector<std::string> split_on_boundaries(
+    const std::vector<std::string> &columns,
+    const std::vector<std::vector<std::string>> &boundaries) {
+  const auto row = [&columns](const std::vector<std::string> &values) {
+    return columns.size() == 1 ? values[0]
+                               : "(" + shcore::str_join(values, ", ") + ")";
+  };
+
+  std::vector<std::string> quoted;
+  for (const auto &column : columns) {
+    quoted.emplace_back(quote(column));
+  }
+
+  const auto key = row(quoted);
+  std::vector<std::string> ranges;
+
+  for (size_t i = 0; i <= boundaries.size(); ++i) {
+    std::string where;
+
+    if (i > 0) where = key + " >= " + row(boundaries[i - 1]);
+    if (i < boundaries.size()) {
+      if (!where.empty()) where += " AND ";
+      where += key + " < " + row(boundaries[i]);
+    }
+
+    ranges.emplace_back(std::move(where));
+  }
+
+  return ranges;
+}
+
+std::vector<std::vector<std::string>> walk_key(
+    mysqlshdk::db::ISession *session, const std::string &schema,
+    const std::string &table, const std::vector<std::string> &key,
+    const std::vector<std::string> &key_types, uint64_t rows_per_chunk,
+    const std::atomic<bool> &interrupted) {
+  std::vector<std::string> select_list;
+  std::vector<std::string> order_by;
+  for (size_t k = 0; k < key.size(); ++k) {
+    select_list.emplace_back(boundary_expression(key[k], key_types[k]));
+    order_by.emplace_back(quote(key[k]));
+  }
+
+  const std::string select =
+      shcore::sqlstring("SELECT " + shcore::str_join(select_list, ", ") +
+                            " FROM !.!",
+                        0)
+      << schema << table;
+  const auto limit = " ORDER BY " + shcore::str_join(order_by, ", ") +
+                     " LIMIT 1 OFFSET " + std::to_string(rows_per_chunk);
+  std::vector<std::vector<std::string>> boundaries;
+
+  // each walk starts from the previous boundary, so that the key index is
+  // scanned only once
+  while (!interrupted) {
+    std::string query = select;
+    if (!boundaries.empty()) {
+      query += " WHERE " + split_on_boundaries(key, {boundaries.back()}).back();
+    }
+
+    const auto result = session->query(query + limit);
+    const auto row = result->fetch_one();
+    if (!row) break;
+
+    std::vector<std::string> boundary;
+    for (uint32_t k = 0; k < key.size(); ++k) {
+      boundary.emplace_back(
+          boundary_literal(row->get_as_string(k), key_types[k]));
+    }
+
+    // approximate values (e.g. FLOAT) could be read back the same
+    if (!boundaries.empty() && boundary == boundaries.back()) break;
+
+    boundaries.emplace_back(std::move(boundary));
+  }
+
+  return boundaries;
+}
+
+}  // namespace table_chunks
+}  // namespace mysqlsh
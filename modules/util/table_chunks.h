@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef MODULES_UTIL_TABLE_CHUNKS_H_
+#define MODULES_UTIL_TABLE_CHUNKS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+
+/**
+ * Helpers shared by the utilities which split tables into chunks on the
+ * ranges of their key columns.
+ */
+namespace table_chunks {
+
+std::string quote(const std::string &identifier);
+
+/**
+ * Whether the DATA_TYPE reported by information_schema is an integer type.
+ */
+bool is_integer_type(const std::string &data_type);
+
+bool is_binary_string_type(const std::string &data_type);
+
+/**
+ * ENUM and SET values are sorted by their positions in the definition, BIT
+ * ones are compared as numbers.
+ */
+bool is_ordered_as_number(const std::string &data_type);
+
+/**
+ * Splits rows on the given boundaries, each one holds values of the columns
+ * formatted as SQL literals, boundaries are in the ascending order. Multiple
+ * columns are compared as a row constructor.
+ *
+ * @return WHERE conditions selecting rows between the consecutive boundaries,
+ * the first and the last one are open ended. A single empty condition if
+ * there are no boundaries.
+ */
+std::vector<std::string> split_on_boundaries(
+    const std::vector<std::string> &columns,
+    const std::vector<std::vector<std::string>> &boundaries);
+
+/**
+ * Reads the chunk boundaries of a table by walking its key in the ascending
+ * order, each boundary is the key of the first row of its chunk. Values are
+ * formatted as SQL literals.
+ *
+ * @param key columns of the key.
+ * @param key_types DATA_TYPE of each of the key columns.
+ * @param interrupted stops the walk, boundaries read so far are returned.
+ *
+ * @return boundaries to be given to split_on_boundaries(), empty if the table
+ * has at most rows_per_chunk rows.
+ */
+std::vector<std::vector<std::string>> walk_key(
+    mysqlshdk::db::ISession *session, const std::string &schema,
+    const std::string &table, const std::vector<std::string> &key,
+    const std::vector<std::string> &key_types, uint64_t rows_per_chunk,
+    const std::atomic<bool> &interrupted);
+
+}  // namespace table_chunks
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_TABLE_CHUNKS_H_
@@ -23,10 +23,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <iterator>
+#include <numeric>
 #include <sstream>
 #include <utility>
 
 #include "modules/util/upgrade_check.h"
+#include "modules/util/worker_threads.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
@@ -839,42 +843,98 @@ Check_table_command::Check_table_command()
 
 std::vector<Upgrade_issue> Check_table_command::run(
     std::shared_ptr<mysqlshdk::db::ISession> session) {
+  return run(std::vector<std::shared_ptr<mysqlshdk::db::ISession>>{session});
+}
+
+namespace {
+std::vector<Upgrade_issue> check_table(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::string &schema, const std::string &table) {
+  std::vector<Upgrade_issue> issues;
+  auto check_result =
+      session->query(shcore::sqlstring("CHECK TABLE !.! FOR UPGRADE;", 0)
+                     << schema << table);
+  const mysqlshdk::db::IRow *row = nullptr;
+  while ((row = check_result->fetch_one()) != nullptr) {
+    if (row->get_string(2) == "status") continue;
+    Upgrade_issue issue;
+    std::string type = row->get_string(2);
+    if (type == "warning")
+      issue.level = Upgrade_issue::WARNING;
+    else if (type == "error")
+      issue.level = Upgrade_issue::ERROR;
+    else
+      issue.level = Upgrade_issue::NOTICE;
+    issue.schema = schema;
+    issue.table = table;
+    issue.description = row->get_string(3);
+    issues.push_back(issue);
+  }
+  return issues;
+}
+}  // namespace
+
+std::vector<Upgrade_issue> Check_table_command::run(
+    const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions) {
+  const auto &session = sessions.front();
+
   // Needed for warnings related to triggers
   session->execute("FLUSH TABLES;");
 
-  std::vector<std::pair<std::string, std::string>> tables;
+  struct Table {
+    std::string schema;
+    std::string name;
+    uint64_t size;
+  };
+
+  std::vector<Table> tables;
   auto result = session->query(
-      "SELECT TABLE_SCHEMA, TABLE_NAME FROM "
+      "SELECT TABLE_SCHEMA, TABLE_NAME, "
+      "IFNULL(DATA_LENGTH, 0) + IFNULL(INDEX_LENGTH, 0) FROM "
       "INFORMATION_SCHEMA.TABLES WHERE TABLE_SCHEMA not in "
       "('information_schema', 'performance_schema', 'sys')");
-  const mysqlshdk::db::IRow *pair = nullptr;
-  while ((pair = result->fetch_one()) != nullptr)
-    tables.push_back(std::pair<std::string, std::string>(pair->get_string(0),
-                                                         pair->get_string(1)));
-
-  std::vector<Upgrade_issue> issues;
-  for (const auto &pair : tables) {
-    auto check_result =
-        session->query(shcore::sqlstring("CHECK TABLE !.! FOR UPGRADE;", 0)
-                       << pair.first << pair.second);
-    const mysqlshdk::db::IRow *row = nullptr;
-    while ((row = check_result->fetch_one()) != nullptr) {
-      if (row->get_string(2) == "status") continue;
-      Upgrade_issue issue;
-      std::string type = row->get_string(2);
-      if (type == "warning")
-        issue.level = Upgrade_issue::WARNING;
-      else if (type == "error")
-        issue.level = Upgrade_issue::ERROR;
-      else
-        issue.level = Upgrade_issue::NOTICE;
-      issue.schema = pair.first;
-      issue.table = pair.second;
-      issue.description = row->get_string(3);
-      issues.push_back(issue);
+  const mysqlshdk::db::IRow *row = nullptr;
+  while ((row = result->fetch_one()) != nullptr)
+    tables.push_back({row->get_string(0), row->get_string(1),
+                      row->is_null(2) ? 0 : row->get_uint(2)});
+
+  std::vector<std::vector<Upgrade_issue>> table_issues(tables.size());
+
+  if (sessions.size() == 1) {
+    for (size_t i = 0; i < tables.size(); ++i)
+      table_issues[i] = check_table(session, tables[i].schema, tables[i].name);
+  } else {
+    // the largest tables are scheduled first, so that they don't end up
+    // being checked alone at the end
+    std::vector<size_t> order(tables.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&tables](size_t a, size_t b) {
+      return tables[a].size > tables[b].size;
+    });
+
+    std::atomic<size_t> next{0};
+    Worker_threads workers;
+    // stops the remaining workers
+    workers.set_on_error([&next, &order]() { next = order.size(); });
+
+    for (const auto &worker_session : sessions) {
+      workers.start([&, worker_session]() {
+        size_t i;
+        while ((i = next++) < order.size()) {
+          const Table &table = tables[order[i]];
+          table_issues[order[i]] =
+              check_table(worker_session, table.schema, table.name);
+        }
+      });
     }
+
+    workers.wait();
   }
 
+  std::vector<Upgrade_issue> issues;
+  for (auto &ti : table_issues)
+    std::move(ti.begin(), ti.end(), std::back_inserter(issues));
+
   return issues;
 }
 
@@ -155,6 +155,14 @@ class Check_table_command : public Upgrade_check {
   std::vector<Upgrade_issue> run(
       std::shared_ptr<mysqlshdk::db::ISession> session) override;
 
+  /**
+   * Spreads the CHECK TABLE statements over all the given sessions, one thread
+   * per session, the largest tables are checked first. Issues are reported in
+   * the same order as when running on a single session.
+   */
+  std::vector<Upgrade_issue> run(
+      const std::vector<std::shared_ptr<mysqlshdk::db::ISession>> &sessions);
+
  protected:
   const char *get_description_internal() const override { return nullptr; }
 
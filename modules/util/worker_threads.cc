@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/worker_threads.h"
+#include <stdexcept>
+#include "mysqlshdk/include/shellcore/shell_init.h"
+
+namespace mysqlsh {
+
+void validate_threads(int64_t threads) {
+  if (threads < 1) {
+    throw std::invalid_argument(
+        "Number of threads must be a positive integer value.");
+  }
+}
+
+Worker_threads::Worker_threads(std::atomic<bool> *interrupted)
+    : m_interrupted(interrupted),
+      m_interrupt_handler(
+          [interrupted]() -> bool {
+            *interrupted = true;
+            return false;
+          },
+          nullptr == interrupted) {}
+
+Worker_threads::~Worker_threads() { join(); }
+
+void Worker_threads::start(const std::function<void()> &worker) {
+  m_threads.emplace_back([this, worker]() {
+    mysqlsh::thread_init();
+
+    try {
+      worker();
+    } catch (...) {
+      on_error(std::current_exception());
+    }
+
+    mysqlsh::thread_end();
+  });
+}
+
+void Worker_threads::join() {
+  for (auto &t : m_threads) {
+    if (t.joinable()) t.join();
+  }
+}
+
+void Worker_threads::wait() {
+  join();
+
+  if (m_error) std::rethrow_exception(m_error);
+}
+
+void Worker_threads::on_error(std::exception_ptr error) {
+  {
+    std::lock_guard<std::mutex> lock(m_error_mutex);
+    if (!m_error) m_error = error;
+  }
+
+  if (m_interrupted) *m_interrupted = true;
+  if (m_on_error) m_on_error();
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_WORKER_THREADS_H_
+#define MODULES_UTIL_WORKER_THREADS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "shellcore/interrupt_handler.h"
+
+namespace mysqlsh {
+
+/**
+ * Validates the number of threads requested by the user.
+ *
+ * @throws std::invalid_argument if the number is not positive.
+ */
+void validate_threads(int64_t threads);
+
+/**
+ * Threads running the workers of a parallel operation.
+ *
+ * Each thread is set up with thread_init() and thread_end(). The first
+ * exception thrown by a worker is kept and rethrown by wait(). If the
+ * interrupted flag is given, it is set on SIGINT while this object exists and
+ * when a worker fails, workers are expected to check it and stop.
+ *
+ * The workers have to be able to finish on their own (i.e. queues they wait
+ * on have to be shut down) before the threads are joined.
+ */
+class Worker_threads {
+ public:
+  explicit Worker_threads(std::atomic<bool> *interrupted = nullptr);
+
+  Worker_threads(const Worker_threads &) = delete;
+  Worker_threads(Worker_threads &&) = delete;
+
+  Worker_threads &operator=(const Worker_threads &) = delete;
+  Worker_threads &operator=(Worker_threads &&) = delete;
+
+  ~Worker_threads();
+
+  /**
+   * Sets the callback called by the failed worker, after its exception is
+   * stored, i.e. to shut down the queue the other workers are reading.
+   */
+  void set_on_error(const std::function<void()> &callback) {
+    m_on_error = callback;
+  }
+
+  /**
+   * Runs the worker in a new thread.
+   */
+  void start(const std::function<void()> &worker);
+
+  /**
+   * Waits for all the threads to finish.
+   */
+  void join();
+
+  /**
+   * Waits for all the threads to finish, rethrows the first exception thrown
+   * by any of the workers.
+   */
+  void wait();
+
+ private:
+  void on_error(std::exception_ptr error);
+
+  std::atomic<bool> *m_interrupted;
+  shcore::Interrupt_handler m_interrupt_handler;
+  std::function<void()> m_on_error;
+  std::vector<std::thread> m_threads;
+  std::mutex m_error_mutex;
+  std::exception_ptr m_error;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_WORKER_THREADS_H_
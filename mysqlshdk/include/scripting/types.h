@@ -26,11 +26,13 @@
 
 #include "types_common.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/utils/nullable.h"
@@ -114,9 +116,17 @@ struct SHCORE_PUBLIC Value {
   typedef std::vector<Value> Array_type;
   typedef std::shared_ptr<Array_type> Array_type_ref;
 
+  /**
+   * Map of Values, members are kept in a vector sorted by key.
+   *
+   * Lookups are binary searches over contiguous memory and the members are
+   * always iterated in key order. Unlike std::map, inserting or erasing a
+   * member invalidates iterators and references to the other members.
+   */
   class SHCORE_PUBLIC Map_type {
    public:
-    typedef std::map<std::string, Value> container_type;
+    typedef std::pair<std::string, Value> value_type;
+    typedef std::vector<value_type> container_type;
     typedef container_type::const_iterator const_iterator;
     typedef container_type::iterator iterator;
 
@@ -148,11 +158,27 @@ struct SHCORE_PUBLIC Value {
       return iter->second.as_object<C>();
     }
 
-    const_iterator find(const std::string &k) const { return _map.find(k); }
-    iterator find(const std::string &k) { return _map.find(k); }
+    const_iterator find(const std::string &k) const {
+      const auto it = lower_bound(k);
+      return (it != end() && it->first == k) ? it : end();
+    }
+    iterator find(const std::string &k) {
+      const auto it = lower_bound(k);
+      return (it != end() && it->first == k) ? it : end();
+    }
 
-    void erase(const std::string &k) { _map.erase(k); }
+    void erase(const std::string &k) {
+      const auto it = find(k);
+      if (it != end()) _map.erase(it);
+    }
     void clear() { _map.clear(); }
+    void reserve(size_t n) { _map.reserve(n); }
+
+    /**
+     * Replaces the contents of the map with the given members, which may be
+     * in any order. If a key is repeated, the last occurrence wins.
+     */
+    void assign(container_type &&members);
 
     const_iterator begin() const { return _map.begin(); }
     iterator begin() { return _map.begin(); }
@@ -160,26 +186,54 @@ struct SHCORE_PUBLIC Value {
     const_iterator end() const { return _map.end(); }
     iterator end() { return _map.end(); }
 
-    void set(const std::string &k, const shcore::Value &v) { _map[k] = v; }
+    // takes a copy, so that v may refer to a member of this map
+    void set(const std::string &k, shcore::Value v) {
+      (*this)[k] = std::move(v);
+    }
 
-    const container_type::mapped_type &at(const std::string &k) const {
-      return _map.at(k);
+    const Value &at(const std::string &k) const {
+      const auto it = find(k);
+      if (it == end()) throw std::out_of_range("Map_type::at");
+      return it->second;
     }
-    container_type::mapped_type &operator[](const std::string &k) {
-      return _map[k];
+    Value &operator[](const std::string &k) {
+      auto it = lower_bound(k);
+      if (it == end() || it->first != k) it = _map.emplace(it, k, Value());
+      return it->second;
     }
     bool operator==(const Map_type &other) const { return _map == other._map; }
 
     bool empty() const { return _map.empty(); }
     size_t size() const { return _map.size(); }
-    size_t count(const std::string &k) const { return _map.count(k); }
+    size_t count(const std::string &k) const {
+      return find(k) != end() ? 1 : 0;
+    }
 
     template <class T>
     std::pair<iterator, bool> emplace(const std::string &key, const T &value) {
-      return _map.emplace(key, Value(value));
+      auto it = lower_bound(key);
+      if (it != end() && it->first == key) return {it, false};
+      return {_map.emplace(it, key, Value(value)), true};
     }
 
    private:
+    static bool key_less(const value_type &member, const std::string &k) {
+      return member.first < k;
+    }
+    static bool key_less_member(const value_type &a, const value_type &b) {
+      return a.first < b.first;
+    }
+
+    const_iterator lower_bound(const std::string &k) const {
+      // members are usually added in key order, check the last one first
+      if (_map.empty() || _map.back().first < k) return end();
+      return std::lower_bound(begin(), end(), k, key_less);
+    }
+    iterator lower_bound(const std::string &k) {
+      if (_map.empty() || _map.back().first < k) return end();
+      return std::lower_bound(begin(), end(), k, key_less);
+    }
+
     container_type _map;
   };
   typedef std::shared_ptr<Map_type> Map_type_ref;
@@ -200,6 +254,7 @@ struct SHCORE_PUBLIC Value {
 
   Value() : type(Undefined) {}
   Value(const Value &copy);
+  Value(Value &&other) noexcept;
 
   explicit Value(const std::string &s);
   explicit Value(const char *);
@@ -255,9 +310,16 @@ struct SHCORE_PUBLIC Value {
   //! parse a string returned by repr() back into a Value
   static Value parse(const std::string &s);
 
+  //! parse a JSON document into a Value
+  static Value parse_json(const std::string &json);
+  //! parse a JSON document into a Value, using the string as the buffer for
+  //! in-situ parsing
+  static Value parse_json(std::string &&json);
+
   ~Value();
 
   Value &operator=(const Value &other);
+  Value &operator=(Value &&other) noexcept;
 
   bool operator==(const Value &other) const;
 
@@ -59,6 +59,8 @@ class IConsole {
   virtual void print_info(const std::string &text) const = 0;
   virtual void print_value(const shcore::Value &value,
                            const std::string &tag) const = 0;
+  // Sends text which is already formatted as JSON to STDOUT, as is
+  virtual void print_json(const std::string &json) const = 0;
 
   // Throws shcore::cancelled() on ^C
   virtual bool prompt(const std::string &prompt,
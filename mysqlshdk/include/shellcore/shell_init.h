@@ -38,6 +38,14 @@ void global_init();
  */
 void global_end();
 
+/*
+ * Call at the start and at the end of any additional thread which uses the
+ * client library, i.e. opens sessions. Both must be called from that thread,
+ * after global_init() and before global_end().
+ */
+void thread_init();
+void thread_end();
+
 }  // namespace mysqlsh
 
 #endif  // MYSQLSHDK_INCLUDE_SHELLCORE_SHELL_INIT_H_
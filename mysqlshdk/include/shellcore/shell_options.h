@@ -29,7 +29,10 @@
 #define SHCORE_OUTPUT_FORMAT "outputFormat"
 #define SHCORE_INTERACTIVE "interactive"
 #define SHCORE_SHOW_WARNINGS "showWarnings"
+#define SHCORE_TABLE_STREAMING_ROWS "tableStreamingRows"
 #define SHCORE_BATCH_CONTINUE_ON_ERROR "batchContinueOnError"
+#define SHCORE_BATCH_PIPELINE_SIZE "batchPipelineSize"
+#define SHCORE_LOG_ASYNC "logAsync"
 #define SHCORE_USE_WIZARDS "useWizards"
 
 #define SHCORE_SANDBOX_DIR "sandboxDir"
@@ -85,6 +88,7 @@ class Shell_options : public shcore::Options {
     mysqlsh::SessionType session_type = mysqlsh::SessionType::Auto;
     bool default_session_type = true;
     bool force = false;
+    int batch_pipeline_size = 0;
     bool interactive = false;
     bool full_interactive = false;
     bool passwords_from_stdin = false;
@@ -92,8 +96,10 @@ class Shell_options : public shcore::Options {
     bool no_password = false;  //< Do not ask for password
     bool recreate_database = false;
     bool show_warnings = true;
+    int table_streaming_rows = 0;
     bool trace_protocol = false;
     bool log_to_stderr = false;
+    bool log_async = false;
     bool devapi_schema_object_handles = true;
     bool db_name_cache = true;
     bool db_name_cache_set = false;
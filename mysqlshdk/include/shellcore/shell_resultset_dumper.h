@@ -68,11 +68,13 @@ class ResultsetDumper {
   std::shared_ptr<mysqlsh::ShellBaseResult> _resultset;
   std::string _format;
   bool _show_warnings;
+  int _table_streaming_rows;
   bool _interactive;
   bool _buffer_data;
   bool _cancelled;
 
   void dump_json();
+  void dump_ndjson();
   void dump_normal();
   void dump_normal(std::shared_ptr<mysqlsh::mysql::ClassicResult> result);
   void dump_normal(std::shared_ptr<mysqlsh::mysqlx::SqlResult> result);
@@ -85,6 +87,7 @@ class ResultsetDumper {
   void dump_records(std::string &output_stats);
   size_t dump_tabbed(shcore::Value::Array_type_ref records);
   size_t dump_table(shcore::Value::Array_type_ref records);
+  size_t dump_table_streaming(size_t sample_size);
   size_t dump_vertical(shcore::Value::Array_type_ref records);
   void dump_warnings(bool classic = false);
 };
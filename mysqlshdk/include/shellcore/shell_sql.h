@@ -26,6 +26,8 @@
 
 #include <memory>
 #include <stack>
+#include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/db/session.h"
@@ -69,7 +71,30 @@ class SHCORE_PUBLIC Shell_sql : public Shell_language {
   void kill_query(uint64_t conn_id,
                   const mysqlshdk::db::Connection_options &conn_opts);
 
+  /**
+   * Sets the number of statements which are sent to the server before their
+   * results are read, 0 disables the pipelining.
+   */
+  void set_pipeline_size(size_t size);
+
+  /**
+   * Executes the pending pipelined statements, processing their results.
+   *
+   * @returns false if any of the statements failed.
+   */
+  bool flush_pipeline();
+
  private:
+  struct Pipelined_statement {
+    std::string sql;
+    std::string delimiter;
+  };
+
+  size_t _pipeline_size = 0;
+  std::vector<Pipelined_statement> _pipeline;
+  // session of the current run, it's kept between the flushes
+  std::shared_ptr<mysqlshdk::db::ISession> _pipeline_session;
+
   std::string _sql_cache;
   mysql::splitter::Delimiters _delimiters;
   std::stack<std::string> _parsing_context_stack;
@@ -80,6 +105,10 @@ class SHCORE_PUBLIC Shell_sql : public Shell_language {
   bool process_sql(const std::string &query_str,
                    mysql::splitter::Delimiters::delim_type_t delimiter,
                    std::shared_ptr<mysqlshdk::db::ISession> session);
+  void end_pipeline();
+  bool pipeline_sql(const std::string &query_str,
+                    mysql::splitter::Delimiters::delim_type_t delimiter,
+                    std::shared_ptr<mysqlshdk::db::ISession> session);
 
   void cmd_process_file(const std::vector<std::string> &params);
 };
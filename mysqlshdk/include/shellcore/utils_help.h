@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_INCLUDE_SHELLCORE_UTILS_HELP_H_
 #define MYSQLSHDK_INCLUDE_SHELLCORE_UTILS_HELP_H_
 
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -101,6 +102,10 @@ struct Help_topic {
  *   registered topic.
  * - The help tree: which contains all the registered topics and the relations
  *   between them and their associations with the help data.
+ *
+ * The help registered statically (REGISTER_HELP* macros) is only recorded
+ * while the program starts: the text is kept as the string literals it comes
+ * from and the help tree is built the first time it is needed.
  */
 class Help_registry {
   // The Keyword Registry holds the relations between a keyword, a topic as well
@@ -135,6 +140,19 @@ class Help_registry {
   // Registers the help text for a specific token
   void add_help(const std::string &token, const std::string &data);
 
+  // Registers help text which lives for the whole program, without copying it
+  void add_static_help(const char *token, const char *data);
+
+  // Records a topic (or a class if upper_class is not null) to be registered
+  // when the help tree is loaded
+  void add_static_topic(const char *name, Topic_type type, const char *tag,
+                        const char *parent, IShell_core::Mode_mask mode,
+                        const char *upper_class = nullptr);
+
+  // Runs the given registration once the help tree is loaded, right away if
+  // it already is
+  void defer(const std::function<void()> &registration);
+
   // Registers a new topic and it's associated keywords
   Help_topic *add_help_topic(const std::string &name, Topic_type type,
                              const std::string &tag, const std::string &parent,
@@ -165,9 +183,33 @@ class Help_registry {
                         bool case_sensitive = false);
 
  private:
+  struct Static_help {
+    const char *token;
+    const char *data;
+  };
+
+  struct Static_topic {
+    const char *name;
+    Topic_type type;
+    const char *tag;
+    const char *parent;
+    IShell_core::Mode_mask mode;
+    const char *upper_class;
+  };
+
   // Options will be stored on a MAP
   Data_registry m_help_data;
 
+  // Statically registered help text, sorted by token on first lookup
+  std::vector<Static_help> m_static_help;
+  bool m_static_help_sorted = false;
+
+  // Statically registered topics and deferred registrations, pending until
+  // the help tree is loaded
+  std::vector<Static_topic> m_static_topics;
+  std::vector<std::function<void()>> m_deferred;
+  bool m_topics_loaded = false;
+
   // Holds all the registered topics
   std::map<size_t, Help_topic> m_topics;
 
@@ -188,18 +230,25 @@ class Help_registry {
 
   static bool icomp(const std::string &lhs, const std::string &rhs);
 
+  // Builds the help tree out of the statically registered topics
+  void load_topics();
+
   // Helper functions for add_help_topic
   void register_topic(Help_topic *topic, bool new_topic,
                       IShell_core::Mode_mask mode);
   void register_keywords(Help_topic *topic, IShell_core::Mode_mask mode);
+
+#ifdef FRIEND_TEST
+  friend class Help_registry_test;
+#endif
 };
 
 /**
  * Helper structure to statically register help data.
  */
 struct Help_register {
-  Help_register(const std::string &token, const std::string &data) {
-    shcore::Help_registry::get()->add_help(token, data);
+  Help_register(const char *token, const char *data) {
+    shcore::Help_registry::get()->add_static_help(token, data);
   }
 };
 
@@ -208,9 +257,8 @@ enum class Help_mode { ALL, SCRIPTING, JAVASCRIPT, PYTHON, SQL };
  * Helper structure to statically register help topics
  */
 struct Help_topic_register {
-  Help_topic_register(const std::string &name, Topic_type type,
-                      const std::string &tag, const std::string &parent,
-                      Help_mode mode) {
+  Help_topic_register(const char *name, Topic_type type, const char *tag,
+                      const char *parent, Help_mode mode) {
     IShell_core::Mode_mask mask;
     using Mode = IShell_core::Mode;
 
@@ -232,7 +280,7 @@ struct Help_topic_register {
         break;
     }
 
-    Help_registry::get()->add_help_topic(name, type, tag, parent, mask);
+    Help_registry::get()->add_static_topic(name, type, tag, parent, mask);
   }
 };
 
@@ -240,9 +288,13 @@ struct Help_topic_register {
  * Helper structure to statically register help classes
  */
 struct Help_class_register {
-  Help_class_register(const std::string &child, const std::string &parent,
-                      const std::string &upper_class) {
-    Help_registry::get()->add_help_class(child, parent, upper_class);
+  Help_class_register(const char *child, const char *parent,
+                      const char *upper_class) {
+    IShell_core::Mode_mask mode(IShell_core::Mode::JavaScript);
+    mode.set(IShell_core::Mode::Python);
+
+    Help_registry::get()->add_static_topic(child, Topic_type::CLASS, child,
+                                           parent, mode, upper_class);
   }
 };
 
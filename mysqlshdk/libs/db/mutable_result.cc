@@ -42,7 +42,8 @@ Mutable_result::Mutable_result(IResult *result)
     : _metadata(result->get_metadata()) {
   auto *row = result->fetch_one();
   while (row) {
-    _rows.emplace_back(std::unique_ptr<Row_copy>(new Row_copy(*row)));
+    _rows.emplace_back(std::unique_ptr<Row_copy>(
+        _rows.empty() ? new Row_copy(*row) : new Row_copy(*row, *_rows[0])));
     row = result->fetch_one();
   }
 }
@@ -79,7 +80,8 @@ void Mutable_result::add_from(IResult *result) {
   _metadata = result->get_metadata();
   auto *row = result->fetch_one();
   while (row) {
-    _rows.emplace_back(new Row_copy(*row));
+    _rows.emplace_back(
+        _rows.empty() ? new Row_copy(*row) : new Row_copy(*row, *_rows[0]));
     row = result->fetch_one();
   }
 }
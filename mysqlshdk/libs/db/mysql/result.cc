@@ -124,22 +124,7 @@ std::unique_ptr<Warning> Result::fetch_one_warning() {
   if (_warning_count && !_fetched_warnings) {
     _fetched_warnings = true;
     if (auto s = _session.lock()) {
-      auto result = s->query("show warnings", true);
-      while (auto row = result->fetch_one()) {
-        std::unique_ptr<Warning> w(new Warning());
-        std::string level = row->get_string(0);
-        if (level == "Error") {
-          w->level = Warning::Level::Error;
-        } else if (level == "Warning") {
-          w->level = Warning::Level::Warn;
-        } else {
-          assert(level == "Note");
-          w->level = Warning::Level::Note;
-        }
-        w->code = row->get_int(1);
-        w->msg = row->get_string(2);
-        _warnings.push_back(std::move(w));
-      }
+      add_warnings(s->query("show warnings", true).get());
     }
   }
 
@@ -151,6 +136,24 @@ std::unique_ptr<Warning> Result::fetch_one_warning() {
   return {};
 }
 
+void Result::add_warnings(IResult *show_warnings) {
+  while (auto row = show_warnings->fetch_one()) {
+    std::unique_ptr<Warning> w(new Warning());
+    std::string level = row->get_string(0);
+    if (level == "Error") {
+      w->level = Warning::Level::Error;
+    } else if (level == "Warning") {
+      w->level = Warning::Level::Warn;
+    } else {
+      assert(level == "Note");
+      w->level = Warning::Level::Note;
+    }
+    w->code = row->get_int(1);
+    w->msg = row->get_string(2);
+    _warnings.push_back(std::move(w));
+  }
+}
+
 void Result::reset(std::shared_ptr<MYSQL_RES> res) {
   _has_resultset = false;
 
@@ -69,6 +69,8 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
          uint64_t last_insert_id, const char *info);
   void reset(std::shared_ptr<MYSQL_RES> res);
   void fetch_metadata();
+  // adds the rows of a SHOW WARNINGS result to the warnings of this result
+  void add_warnings(IResult *show_warnings);
   Type map_data_type(int raw_type, int flags);
 
   virtual std::shared_ptr<Field_names> field_names() const;
@@ -22,16 +22,113 @@
  */
 
 #include "mysqlshdk/libs/db/mysql/session.h"
+#include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
 #include <vector>
 
+#include <errmsg.h>
 #include <mysql_version.h>
 #include "utils/utils_general.h"
+#include "utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace db {
 namespace mysql {
+/**
+ * Result of a single statement of a multi-statement batch, the following
+ * result sets belong to the statements which follow it.
+ */
+class Pipelined_result : public Result {
+ public:
+  Pipelined_result(std::shared_ptr<Session_impl> owner, uint64_t affected_rows,
+                   unsigned int warning_count, uint64_t last_insert_id,
+                   const char *info, bool warnings_follow)
+      : Result(owner, affected_rows, warning_count, last_insert_id, info),
+        m_warnings_follow(warnings_follow) {}
+
+  bool next_resultset() override {
+    _fetched_row_count = 0;
+    return false;
+  }
+
+  std::unique_ptr<Warning> fetch_one_warning() override {
+    // SHOW WARNINGS would discard the results of the following statements,
+    // the warnings are read from the result set which follows this one
+    if (m_warnings_follow) {
+      m_warnings_follow = false;
+      _fetched_warnings = true;
+
+      if (auto s = _session.lock()) {
+        if (auto warnings = s->next_pipelined_warnings())
+          add_warnings(warnings.get());
+      }
+    }
+
+    return Result::fetch_one_warning();
+  }
+
+ private:
+  bool m_warnings_follow;
+};
+
+namespace {
+bool is_call_statement(const std::string &sql) {
+  const auto length = sql.length();
+  size_t i = 0;
+
+  // skips whitespace and comments, contents of versioned comments are SQL
+  while (i < length) {
+    if (std::isspace(static_cast<unsigned char>(sql[i]))) {
+      ++i;
+    } else if (sql.compare(i, 3, "/*!") == 0) {
+      i += 3;
+      while (i < length && std::isdigit(static_cast<unsigned char>(sql[i])))
+        ++i;
+    } else if (sql.compare(i, 2, "/*") == 0) {
+      i = sql.find("*/", i + 2);
+      if (std::string::npos == i) return false;
+      i += 2;
+    } else if (sql[i] == '#' ||
+               (sql.compare(i, 2, "--") == 0 &&
+                (i + 2 == length ||
+                 std::isspace(static_cast<unsigned char>(sql[i + 2]))))) {
+      i = sql.find('\n', i);
+      if (std::string::npos == i) return false;
+    } else {
+      break;
+    }
+  }
+
+  return shcore::str_ibeginswith(sql.c_str() + i, "call") &&
+         (i + 4 == length ||
+          !(std::isalnum(static_cast<unsigned char>(sql[i + 4])) ||
+            sql[i + 4] == '_'));
+}
+
+/**
+ * Checks if the statement may read the diagnostics or the row counts left by
+ * its predecessor, SHOW WARNINGS cannot be placed between them.
+ */
+bool reads_previous_statement(const std::string &sql) {
+  static constexpr const char *k_names[] = {"ROW_COUNT", "FOUND_ROWS",
+                                            "WARNING", "ERROR", "DIAGNOSTICS"};
+
+  for (const auto name : k_names) {
+    const auto end = name + strlen(name);
+    if (std::search(sql.begin(), sql.end(), name, end, [](char a, char b) {
+          return std::toupper(static_cast<unsigned char>(a)) == b;
+        }) != sql.end())
+      return true;
+  }
+
+  return false;
+}
+}  // namespace
+
 //-------------------------- Session Implementation ----------------------------
 void Session_impl::throw_on_connection_fail() {
   auto exception = mysqlshdk::db::Error(
@@ -42,6 +139,27 @@ void Session_impl::throw_on_connection_fail() {
 
 Session_impl::Session_impl() : _mysql(NULL) {}
 
+int Session_impl::local_infile_init(void **ptr, const char *, void *userdata) {
+  *ptr = userdata;
+  return 0;
+}
+
+int Session_impl::local_infile_read(void *ptr, char *buffer,
+                                    unsigned int size) {
+  auto self = static_cast<Session_impl *>(ptr);
+  if (!self->m_local_infile_reader) return -1;
+  return self->m_local_infile_reader(buffer, size);
+}
+
+void Session_impl::local_infile_end(void *) {}
+
+int Session_impl::local_infile_error(void *, char *message,
+                                     unsigned int message_size) {
+  snprintf(message, message_size, "%s",
+           "Error reading data for LOAD DATA LOCAL INFILE");
+  return CR_UNKNOWN_ERROR;
+}
+
 void Session_impl::connect(
     const mysqlshdk::db::Connection_options &connection_options) {
   long flags = CLIENT_MULTI_RESULTS | CLIENT_CAN_HANDLE_EXPIRED_PASSWORDS;
@@ -94,6 +212,19 @@ void Session_impl::connect(
   }
   mysql_options(_mysql, MYSQL_OPT_CONNECT_TIMEOUT, &connect_timeout);
 
+  if (m_read_timeout > 0)
+    mysql_options(_mysql, MYSQL_OPT_READ_TIMEOUT, &m_read_timeout);
+
+  if (m_local_infile_reader) {
+    // the server is only able to read data provided by the reader
+    unsigned int local_infile = 1;
+    mysql_options(_mysql, MYSQL_OPT_LOCAL_INFILE, &local_infile);
+    mysql_set_local_infile_handler(_mysql, &Session_impl::local_infile_init,
+                                   &Session_impl::local_infile_read,
+                                   &Session_impl::local_infile_end,
+                                   &Session_impl::local_infile_error, this);
+  }
+
   if (!mysql_real_connect(
           _mysql,
           _connection_options.has_host()
@@ -205,6 +336,9 @@ void Session_impl::close() {
 
   if (_mysql) mysql_close(_mysql);
   _mysql = nullptr;
+  _max_allowed_packet = 0;
+  m_multi_statements = false;
+  m_pipelined_warnings = false;
 }
 
 std::shared_ptr<IResult> Session_impl::query(const std::string &sql,
@@ -219,6 +353,24 @@ void Session_impl::execute(const std::string &sql) {
 std::shared_ptr<IResult> Session_impl::run_sql(const std::string &query,
                                                bool buffered) {
   if (_mysql == nullptr) throw std::runtime_error("Not connected");
+  discard_pending_results();
+
+  if (mysql_real_query(_mysql, query.c_str(), query.length()) != 0) {
+    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                mysql_sqlstate(_mysql));
+  }
+
+  std::shared_ptr<Result> result(
+      new Result(shared_from_this(), mysql_affected_rows(_mysql),
+                 mysql_warning_count(_mysql), mysql_insert_id(_mysql),
+                 mysql_info(_mysql)));
+
+  prepare_fetch(result.get(), buffered);
+
+  return std::static_pointer_cast<IResult>(result);
+}
+
+void Session_impl::discard_pending_results() {
   if (_prev_result) {
     _prev_result.reset();
   } else {
@@ -231,20 +383,164 @@ std::shared_ptr<IResult> Session_impl::run_sql(const std::string &query,
     MYSQL_RES *trailing_result = mysql_use_result(_mysql);
     mysql_free_result(trailing_result);
   }
+}
 
-  if (mysql_real_query(_mysql, query.c_str(), query.length()) != 0) {
-    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
-                mysql_sqlstate(_mysql));
+size_t Session_impl::get_max_allowed_packet() {
+  if (0 == _max_allowed_packet) {
+    const auto result = run_sql("SELECT @@max_allowed_packet");
+    const auto row = result->fetch_one();
+
+    if (!row) {
+      throw std::logic_error("Query result returned fewer rows than expected");
+    }
+
+    _max_allowed_packet = row->get_uint(0);
+    _prev_result.reset();
   }
 
-  std::shared_ptr<Result> result(
-      new Result(shared_from_this(), mysql_affected_rows(_mysql),
-                 mysql_warning_count(_mysql), mysql_insert_id(_mysql),
-                 mysql_info(_mysql)));
+  return _max_allowed_packet;
+}
 
-  prepare_fetch(result.get(), buffered);
+void Session_impl::execute_pipelined(const std::vector<std::string> &sql,
+                                     bool stop_on_error,
+                                     const Pipeline_callback &callback) {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+  discard_pending_results();
+
+  // each batch is sent as a single COM_QUERY packet, one byte is taken by the
+  // command
+  const size_t max_batch_size = get_max_allowed_packet() - 1;
+
+  // enabled once, the following runs keep it until end_pipeline() is called
+  if (!m_multi_statements) {
+    if (mysql_set_server_option(_mysql, MYSQL_OPTION_MULTI_STATEMENTS_ON) !=
+        0) {
+      throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                  mysql_sqlstate(_mysql));
+    }
 
-  return std::static_pointer_cast<IResult>(result);
+    m_multi_statements = true;
+  }
+
+  shcore::Scoped_callback discard([this]() {
+    m_pipelined_warnings = false;
+    if (_mysql) discard_pending_results();
+  });
+
+  size_t next = 0;
+  bool done = false;
+
+  while (next < sql.size() && !done) {
+    // results of a CALL cannot be told apart from the results of the
+    // statements which follow it, it is executed on its own
+    if (is_call_statement(sql[next])) {
+      std::shared_ptr<IResult> result;
+
+      try {
+        result = run_sql(sql[next]);
+      } catch (const Error &e) {
+        done = !callback(next++, nullptr, &e) || stop_on_error;
+        continue;
+      }
+
+      done = !callback(next++, result, nullptr);
+      continue;
+    }
+
+    size_t end = next;
+    std::string batch;
+
+    while (end < sql.size() && !is_call_statement(sql[end]) &&
+           (end == next || !reads_previous_statement(sql[end]))) {
+      // new line terminates a trailing comment, warnings of the previous
+      // statement are read before they are cleared by the next one
+      static constexpr char separator[] = "\n;\nSHOW WARNINGS;\n";
+      const size_t separator_size = end > next ? sizeof(separator) - 1 : 0;
+
+      // a single statement which exceeds the limit is sent anyway, server
+      // reports it
+      if (end > next && batch.length() + separator_size + sql[end].length() >
+                            max_batch_size) {
+        break;
+      }
+
+      if (end > next) batch.append(separator);
+      batch.append(sql[end++]);
+    }
+
+    // the server executes the statements until one of them fails, each
+    // statement produces one result set, followed by the one of SHOW WARNINGS
+    int status = mysql_real_query(_mysql, batch.c_str(), batch.length());
+
+    while (true) {
+      if (status != 0) {
+        const Error error(mysql_error(_mysql), mysql_errno(_mysql),
+                          mysql_sqlstate(_mysql));
+
+        if (!done) done = !callback(next, nullptr, &error) || stop_on_error;
+
+        // remaining statements of the batch were not executed
+        ++next;
+        break;
+      }
+
+      if (m_pipelined_warnings) {
+        // warnings of the previous statement were not requested
+        m_pipelined_warnings = false;
+        mysql_free_result(mysql_use_result(_mysql));
+      } else {
+        // the last statement of a batch is not followed by SHOW WARNINGS,
+        // its warnings are still there once the batch is completed
+        m_pipelined_warnings = next + 1 < end;
+
+        if (next < end && !done) {
+          std::shared_ptr<Result> result(new Pipelined_result(
+              shared_from_this(), mysql_affected_rows(_mysql),
+              mysql_warning_count(_mysql), mysql_insert_id(_mysql),
+              mysql_info(_mysql), m_pipelined_warnings));
+
+          prepare_fetch(result.get(), false);
+
+          done = !callback(next, result, nullptr);
+          _prev_result.reset();
+        } else {
+          mysql_free_result(mysql_use_result(_mysql));
+        }
+
+        if (next < end) ++next;
+      }
+
+      status = mysql_next_result(_mysql);
+
+      if (status < 0) break;
+    }
+  }
+}
+
+void Session_impl::end_pipeline() {
+  if (m_multi_statements && _mysql) {
+    discard_pending_results();
+    mysql_set_server_option(_mysql, MYSQL_OPTION_MULTI_STATEMENTS_OFF);
+  }
+
+  m_multi_statements = false;
+}
+
+std::shared_ptr<IResult> Session_impl::next_pipelined_warnings() {
+  if (!m_pipelined_warnings || !_mysql) return {};
+
+  m_pipelined_warnings = false;
+
+  // rows of the statement which were not fetched are discarded
+  _prev_result.reset();
+
+  if (mysql_next_result(_mysql) != 0) return {};
+
+  std::shared_ptr<Result> result(
+      new Result(shared_from_this(), 0, 0, 0, nullptr));
+  prepare_fetch(result.get(), true);
+
+  return result;
 }
 
 template <class T>
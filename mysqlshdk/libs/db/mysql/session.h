@@ -42,6 +42,16 @@
 namespace mysqlshdk {
 namespace db {
 namespace mysql {
+
+/**
+ * Provides data of the LOAD DATA LOCAL INFILE statements, fills the buffer of
+ * the given size and returns the number of bytes written, 0 at the end of data
+ * or a negative value on error.
+ */
+using Local_infile_reader = std::function<int(char *buffer, unsigned int size)>;
+
+class Pipelined_result;
+
 /*
  * Session implementation for the MySQL protocol.
  *
@@ -53,6 +63,7 @@ namespace mysql {
 class Session_impl : public std::enable_shared_from_this<Session_impl> {
   friend class Session;  // The Session class instantiates this class
   friend class Result;   // The Result class uses some functions of this class
+  friend class Pipelined_result;
  public:
   virtual ~Session_impl();
 
@@ -62,6 +73,10 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   std::shared_ptr<IResult> query(const std::string &sql, bool buffered);
   void execute(const std::string &sql);
+  void execute_pipelined(const std::vector<std::string> &sql,
+                         bool stop_on_error, const Pipeline_callback &callback);
+  void end_pipeline();
+  std::shared_ptr<IResult> next_pipelined_warnings();
 
   void start_transaction();
   void commit();
@@ -74,6 +89,19 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   std::string uri() { return _uri; }
 
+  void set_local_infile_reader(const Local_infile_reader &reader) {
+    m_local_infile_reader = reader;
+  }
+
+  void set_read_timeout(unsigned int seconds) { m_read_timeout = seconds; }
+
+  static int local_infile_init(void **ptr, const char *filename,
+                               void *userdata);
+  static int local_infile_read(void *ptr, char *buffer, unsigned int size);
+  static void local_infile_end(void *ptr);
+  static int local_infile_error(void *ptr, char *message,
+                                unsigned int message_size);
+
   // Utility functions to retriev session status
   uint64_t get_thread_id() {
     _prev_result.reset();
@@ -150,6 +178,8 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
 
   std::shared_ptr<IResult> run_sql(const std::string &sql,
                                    bool lazy_fetch = true);
+  void discard_pending_results();
+  size_t get_max_allowed_packet();
   bool setup_ssl(const mysqlshdk::db::Ssl_options &ssl_options) const;
   void throw_on_connection_fail();
   std::string _uri;
@@ -158,6 +188,15 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
   std::shared_ptr<MYSQL_RES> _prev_result;
   mysqlshdk::db::Connection_options _connection_options;
   std::unique_ptr<Error> m_last_error;
+  Local_infile_reader m_local_infile_reader;
+  unsigned int m_read_timeout = 0;
+  // value of max_allowed_packet, queried when first needed
+  size_t _max_allowed_packet = 0;
+  // multi-statements stay enabled until the end of the pipelined run
+  bool m_multi_statements = false;
+  // the result set which follows holds the warnings of the pipelined
+  // statement whose result was handed to the callback
+  bool m_pipelined_warnings = false;
 };
 
 class SHCORE_PUBLIC Session : public ISession,
@@ -184,6 +223,44 @@ class SHCORE_PUBLIC Session : public ISession,
   }
 
   void execute(const std::string &sql) override { _impl->execute(sql); }
+
+  /**
+   * The statements are sent together as multi-statements, the server stops
+   * executing them on the first error. CALL statements are sent on their own.
+   * Each statement but the last one of a batch is followed by SHOW WARNINGS.
+   */
+  void execute_pipelined(const std::vector<std::string> &sql,
+                         bool stop_on_error,
+                         const Pipeline_callback &callback) override {
+    _impl->execute_pipelined(sql, stop_on_error, callback);
+  }
+
+  /**
+   * Disables the multi-statements, which stay enabled between the
+   * execute_pipelined() calls.
+   */
+  void end_pipeline() override { _impl->end_pipeline(); }
+
+  /**
+   * Sets the function which provides data to the LOAD DATA LOCAL INFILE
+   * statements instead of the named client files. LOCAL INFILE is enabled only
+   * for sessions which have the reader set before connecting, it can be
+   * replaced afterwards.
+   */
+  void set_local_infile_reader(const Local_infile_reader &reader) {
+    _impl->set_local_infile_reader(reader);
+  }
+
+  /**
+   * Sets the time the client waits for each read from the server, must be
+   * called before connecting. The client library retries a timed out read, so
+   * a request may wait up to three times this long. 0 waits forever, which is
+   * the default.
+   */
+  void set_read_timeout(unsigned int seconds) {
+    _impl->set_read_timeout(seconds);
+  }
+
   void close() override { _impl->close(); }
   const char *get_ssl_cipher() const override {
     return _impl->get_ssl_cipher();
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/mysqlx/expr_cache.h"
+
+#include <utility>
+
+#include "mysqlshdk/libs/db/mysqlx/expr_parser.h"
+#include "mysqlshdk/libs/db/mysqlx/orderby_parser.h"
+#include "mysqlshdk/libs/db/mysqlx/proj_parser.h"
+
+namespace mysqlx {
+
+namespace {
+
+std::string make_key(char kind, bool document_mode, const std::string &source) {
+  std::string key;
+  key.reserve(source.size() + 2);
+  key += kind;
+  key += document_mode ? 'd' : 't';
+  key += source;
+  return key;
+}
+
+}  // namespace
+
+Expr_cache::Expr_cache(size_t capacity) : m_cache(capacity) {}
+
+Expr_cache *Expr_cache::get() {
+  static Expr_cache instance;
+  return &instance;
+}
+
+template <typename Message_type>
+bool Expr_cache::copy_cached(const std::string &key, Message_type *target,
+                             std::vector<std::string> *placeholders) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto entry = m_cache.find(key);
+
+  if (!entry) return false;
+
+  target->CopyFrom(static_cast<const Message_type &>(*entry->message));
+  if (placeholders) *placeholders = entry->placeholders;
+
+  return true;
+}
+
+void Expr_cache::put(const std::string &key, Entry entry) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_cache.put(key, std::move(entry));
+}
+
+std::unique_ptr<Mysqlx::Expr::Expr> Expr_cache::filter(
+    const std::string &source, bool document_mode,
+    std::vector<std::string> *placeholders) {
+  if (placeholders && !placeholders->empty()) {
+    Expr_parser parser(source, document_mode, false, placeholders);
+    return parser.expr();
+  }
+
+  const auto key = make_key('f', document_mode, source);
+  std::unique_ptr<Mysqlx::Expr::Expr> expr(new Mysqlx::Expr::Expr());
+
+  if (!copy_cached(key, expr.get(), placeholders)) {
+    Entry entry;
+    Expr_parser parser(source, document_mode, false, &entry.placeholders);
+    std::shared_ptr<const Mysqlx::Expr::Expr> parsed = parser.expr();
+
+    expr->CopyFrom(*parsed);
+    if (placeholders) *placeholders = entry.placeholders;
+
+    entry.message = std::move(parsed);
+    put(key, std::move(entry));
+  }
+
+  return expr;
+}
+
+void Expr_cache::order(const std::string &source, bool document_mode,
+                       Mysqlx::Crud::Order *order) {
+  const auto key = make_key('o', document_mode, source);
+
+  if (!copy_cached(key, order)) {
+    google::protobuf::RepeatedPtrField<Mysqlx::Crud::Order> parsed;
+    Orderby_parser parser(source, document_mode);
+    parser.parse(parsed);
+
+    order->CopyFrom(parsed.Get(0));
+
+    Entry entry;
+    entry.message = std::make_shared<Mysqlx::Crud::Order>(parsed.Get(0));
+    put(key, std::move(entry));
+  }
+}
+
+void Expr_cache::projection(const std::string &source, bool document_mode,
+                            bool allow_alias,
+                            Mysqlx::Crud::Projection *projection) {
+  const auto key = make_key(allow_alias ? 'a' : 'p', document_mode, source);
+
+  if (!copy_cached(key, projection)) {
+    google::protobuf::RepeatedPtrField<Mysqlx::Crud::Projection> parsed;
+    Proj_parser parser(source, document_mode, allow_alias);
+    parser.parse(parsed);
+
+    projection->CopyFrom(parsed.Get(0));
+
+    Entry entry;
+    entry.message = std::make_shared<Mysqlx::Crud::Projection>(parsed.Get(0));
+    put(key, std::move(entry));
+  }
+}
+
+void Expr_cache::set_capacity(size_t capacity) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_cache.set_capacity(capacity);
+}
+
+size_t Expr_cache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_cache.size();
+}
+
+uint64_t Expr_cache::hits() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_cache.hits();
+}
+
+uint64_t Expr_cache::misses() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_cache.misses();
+}
+
+void Expr_cache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_cache.clear();
+}
+
+}  // namespace mysqlx
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_MYSQLX_EXPR_CACHE_H_
+#define MYSQLSHDK_LIBS_DB_MYSQLX_EXPR_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
+#include "mysqlshdk/libs/utils/lru_cache.h"
+
+namespace mysqlx {
+
+/**
+ * Process wide cache of the parsed DevAPI expressions, keyed by the
+ * expression text, its kind and the parse mode (document or table).
+ *
+ * Callers receive a copy of the cached message, the least recently used
+ * expressions are dropped once the cache is full.
+ */
+class Expr_cache {
+ public:
+  explicit Expr_cache(size_t capacity = 256);
+  Expr_cache(const Expr_cache &) = delete;
+  Expr_cache &operator=(const Expr_cache &) = delete;
+
+  /**
+   * Provides the shared instance of the cache.
+   */
+  static Expr_cache *get();
+
+  /**
+   * Parses a filter expression, names of the placeholders it uses are
+   * appended to the given list.
+   *
+   * Positions of the placeholders depend on the ones which are already on
+   * the list, the cache is used only if it's empty.
+   */
+  std::unique_ptr<Mysqlx::Expr::Expr> filter(
+      const std::string &source, bool document_mode,
+      std::vector<std::string> *placeholders);
+
+  void order(const std::string &source, bool document_mode,
+             Mysqlx::Crud::Order *order);
+
+  void projection(const std::string &source, bool document_mode,
+                  bool allow_alias, Mysqlx::Crud::Projection *projection);
+
+  void set_capacity(size_t capacity);
+  size_t size() const;
+  uint64_t hits() const;
+  uint64_t misses() const;
+  void clear();
+
+ private:
+  struct Entry {
+    std::shared_ptr<const google::protobuf::MessageLite> message;
+    std::vector<std::string> placeholders;
+  };
+
+  template <typename Message_type>
+  bool copy_cached(const std::string &key, Message_type *target,
+                   std::vector<std::string> *placeholders = nullptr);
+
+  void put(const std::string &key, Entry entry);
+
+  mutable std::mutex m_mutex;
+  mysqlshdk::utils::Lru_cache<std::string, Entry> m_cache;
+};
+
+}  // namespace mysqlx
+
+#endif  // MYSQLSHDK_LIBS_DB_MYSQLX_EXPR_CACHE_H_
@@ -24,6 +24,7 @@
 #ifndef _MYSQLX_PARSER_H_
 #define _MYSQLX_PARSER_H_
 
+#include "expr_cache.h"
 #include "expr_parser.h"
 #include "orderby_parser.h"
 #include "proj_parser.h"
@@ -34,8 +35,7 @@ namespace mysqlx {
 namespace parser {
 inline Mysqlx::Expr::Expr *parse_collection_filter(
     const std::string &source, std::vector<std::string> *placeholders = NULL) {
-  Expr_parser parser(source, true, false, placeholders);
-  return parser.expr().release();
+  return Expr_cache::get()->filter(source, true, placeholders).release();
 }
 
 inline void parse_document_path(const std::string &source,
@@ -51,48 +51,41 @@ inline Mysqlx::Expr::Expr *parse_column_identifier(const std::string &source) {
 
 inline Mysqlx::Expr::Expr *parse_table_filter(
     const std::string &source, std::vector<std::string> *placeholders = NULL) {
-  Expr_parser parser(source, false, false, placeholders);
-  return parser.expr().release();
+  return Expr_cache::get()->filter(source, false, placeholders).release();
 }
 
 template <typename Container>
 void parse_collection_sort_column(Container &container,
                                   const std::string &source) {
-  Orderby_parser parser(source, true);
-  return parser.parse(container);
+  Expr_cache::get()->order(source, true, container.Add());
 }
 
 template <typename Container>
 void parse_table_sort_column(Container &container, const std::string &source) {
-  Orderby_parser parser(source, false);
-  return parser.parse(container);
+  Expr_cache::get()->order(source, false, container.Add());
 }
 
 template <typename Container>
 void parse_collection_column_list(Container &container,
                                   const std::string &source) {
-  Proj_parser parser(source, true, false);
-  parser.parse(container);
+  Expr_cache::get()->projection(source, true, false, container.Add());
 }
 
 template <typename Container>
 void parse_collection_column_list_with_alias(Container &container,
                                              const std::string &source) {
-  Proj_parser parser(source, true, true);
-  parser.parse(container);
+  Expr_cache::get()->projection(source, true, true, container.Add());
 }
 
 template <typename Container>
 void parse_table_column_list(Container &container, const std::string &source) {
-  Proj_parser parser(source, false, false);
-  parser.parse(container);
+  Expr_cache::get()->projection(source, false, false, container.Add());
 }
 
 template <typename Container>
 void parse_table_column_list_with_alias(Container &container,
                                         const std::string &source) {
-  Proj_parser parser(source, false, true);
-  parser.parse(container);
+  Expr_cache::get()->projection(source, false, true, container.Add());
 }
 }  // namespace parser
 }  // namespace mysqlx
@@ -34,11 +34,12 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 #include "mysqlshdk/libs/db/mysqlx/row.h"
-#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/db/row_buffer.h"
 
 namespace mysqlshdk {
 namespace db {
@@ -60,11 +61,20 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
     throw std::logic_error("not implemented");
   }
 
-  // Read and buffer all rows for the active data set
-  bool pre_fetch_rows(bool persistent = false);
+  // Read and buffer all rows for the active data set, buffered rows are kept
+  // until the next result set is requested, so they can be re-read after
+  // rewind(). Rows are not released as they are read, the columnar buffer
+  // only releases its memory as a whole.
+  bool pre_fetch_rows();
   void stop_pre_fetch();
   void rewind();
 
+  // Marks all the rows of the active data set as read, buffering them first
+  // if needed. Returns the buffer and the position of the first row which was
+  // not read before, the buffer is shared, not copied.
+  std::pair<std::shared_ptr<const mysqlshdk::db::Row_buffer>, size_t>
+  fetch_all_buffered();
+
   // Metadata retrieval
   int64_t get_auto_increment_value() const override;
   bool has_resultset() override;
@@ -81,7 +91,12 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   std::vector<Column> _metadata;
 
-  std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  // Replaced when the next result set is requested, rows handed out by
+  // fetch_all_buffered() may still refer to it
+  std::shared_ptr<mysqlshdk::db::Row_buffer> _pre_fetched_rows;
+  // Returned by fetch_one(), one per buffered row, so the rows stay valid
+  // like the ones returned before
+  std::deque<mysqlshdk::db::Row_buffer::Cursor> _pre_fetched_cursors;
   std::unique_ptr<xcl::XQuery_result> _result;
   mutable std::shared_ptr<Field_names> _field_names;
 
@@ -90,8 +105,12 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   size_t _fetched_warning_count = 0;
   std::string _info;
   bool _stop_pre_fetch = false;
+  size_t _pre_fetch_index = 0;
   bool _pre_fetched = false;
-  bool _persistent_pre_fetch = false;
+
+  // Replies to the remaining batches of an Insert which had to be split to fit
+  // into mysqlx_max_allowed_packet, already read, _result holds the first one
+  std::vector<std::unique_ptr<xcl::XQuery_result>> _batch_results;
 };
 }  // namespace mysqlx
 }  // namespace db
@@ -31,6 +31,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 
 #include "mysqlshdk/libs/db/mysqlx/result.h"
@@ -70,6 +71,7 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   void close();
 
   void before_query();
+  void finish_prev_result();
 
   bool valid() const { return _mysql.get() != nullptr; }
 
@@ -91,10 +93,29 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
                                         const std::string &stmt,
                                         const ::xcl::Arguments &args);
 
+  void execute_pipelined(const std::vector<std::string> &sql,
+                         bool stop_on_error, const Pipeline_callback &callback);
+
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Insert &msg);
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Update &msg);
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Delete &msg);
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Find &msg);
+  std::shared_ptr<IResult> execute_crud_in_batches(
+      const ::Mysqlx::Crud::Insert &msg, size_t max_packet);
+  size_t get_max_allowed_packet();
+
+  bool supports_prepared_statements() const;
+  uint32_t new_stmt_id() { return ++_last_stmt_id; }
+  bool prepare_stmt(uint32_t stmt_id, const ::Mysqlx::Crud::Update &msg);
+  bool prepare_stmt(uint32_t stmt_id, const ::Mysqlx::Crud::Delete &msg);
+  bool prepare_stmt(uint32_t stmt_id, const ::Mysqlx::Crud::Find &msg);
+  std::shared_ptr<IResult> execute_prep_stmt(
+      uint32_t stmt_id,
+      const ::google::protobuf::RepeatedPtrField<::Mysqlx::Datatypes::Scalar>
+          &args);
+  void deallocate_stmt(uint32_t stmt_id);
+  void flush_deallocated_stmts();
+  bool check_prepare_error(const xcl::XError &error);
 
   void load_session_info();
 
@@ -114,6 +135,14 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   bool _enable_trace = false;
   bool _expired_account = false;
   bool _case_sensitive_table_names = false;
+  // value of mysqlx_max_allowed_packet, queried when first needed
+  size_t _max_allowed_packet = 0;
+
+  // Server side prepared statements, statements released by their owners are
+  // deallocated before the next query is sent
+  bool _prepared_statements = true;
+  uint32_t _last_stmt_id = 0;
+  std::vector<uint32_t> _deallocated_stmts;
 
   std::weak_ptr<Result> _prev_result;
   mysqlshdk::db::Connection_options _connection_options;
@@ -162,12 +191,30 @@ class SHCORE_PUBLIC Session : public ISession,
 
   void execute(const std::string &sql) override { _impl->execute(sql); }
 
+  /**
+   * All the statements are sent at once. If stop_on_error is set, they are
+   * sent in an expectation block, so the server skips the statements
+   * following the one which failed.
+   */
+  void execute_pipelined(const std::vector<std::string> &sql,
+                         bool stop_on_error,
+                         const Pipeline_callback &callback) override {
+    _impl->execute_pipelined(sql, stop_on_error, callback);
+  }
+
   virtual std::shared_ptr<IResult> execute_stmt(const std::string &ns,
                                                 const std::string &stmt,
                                                 const ::xcl::Arguments &args) {
     return _impl->execute_stmt(ns, stmt, args);
   }
 
+  /**
+   * Rows which do not fit into a single message of mysqlx_max_allowed_packet
+   * bytes are sent in several batches, without waiting for the reply to the
+   * previous one. The batches following a failed one are not executed. The
+   * result reports the affected rows, warnings and generated IDs of all the
+   * batches.
+   */
   virtual std::shared_ptr<IResult> execute_crud(
       const ::Mysqlx::Crud::Insert &msg) {
     return _impl->execute_crud(msg);
@@ -188,6 +235,57 @@ class SHCORE_PUBLIC Session : public ISession,
     return _impl->execute_crud(msg);
   }
 
+  /**
+   * Tells whether X Protocol prepared statements can be used, false if the
+   * server rejected a previous prepare request, servers older than 8.0.14 do
+   * not know the Prepare messages.
+   */
+  virtual bool supports_prepared_statements() const {
+    return _impl->supports_prepared_statements();
+  }
+
+  /**
+   * Returns a statement ID which was not used yet in this session.
+   */
+  uint32_t new_stmt_id() { return _impl->new_stmt_id(); }
+
+  /**
+   * Prepares the given CRUD message on the server, its args are ignored, they
+   * are provided on each call to execute_prep_stmt().
+   *
+   * @returns false if the statement could not be prepared and the message
+   *          needs to be executed using execute_crud().
+   */
+  virtual bool prepare_stmt(uint32_t stmt_id,
+                            const ::Mysqlx::Crud::Update &msg) {
+    return _impl->prepare_stmt(stmt_id, msg);
+  }
+
+  virtual bool prepare_stmt(uint32_t stmt_id,
+                            const ::Mysqlx::Crud::Delete &msg) {
+    return _impl->prepare_stmt(stmt_id, msg);
+  }
+
+  virtual bool prepare_stmt(uint32_t stmt_id,
+                            const ::Mysqlx::Crud::Find &msg) {
+    return _impl->prepare_stmt(stmt_id, msg);
+  }
+
+  virtual std::shared_ptr<IResult> execute_prep_stmt(
+      uint32_t stmt_id,
+      const ::google::protobuf::RepeatedPtrField<::Mysqlx::Datatypes::Scalar>
+          &args) {
+    return _impl->execute_prep_stmt(stmt_id, args);
+  }
+
+  /**
+   * Releases a prepared statement, the request is sent to the server along
+   * with the next query.
+   */
+  virtual void deallocate_stmt(uint32_t stmt_id) {
+    _impl->deallocate_stmt(stmt_id);
+  }
+
   bool is_open() const override { return _impl->valid(); };
 
   const Error *get_last_error() const override {
@@ -77,6 +77,14 @@ inline void set_scalar(::Mysqlx::Datatypes::Scalar &scalar,
   scalar.mutable_v_string()->set_value(value);
 }
 
+inline void set_scalar(::Mysqlx::Datatypes::Scalar &scalar, const char *value,
+                       const size_t length) {
+  scalar.set_type(::Mysqlx::Datatypes::Scalar::V_STRING);
+  scalar.set_allocated_v_string(new ::Mysqlx::Datatypes::Scalar_String());
+
+  scalar.mutable_v_string()->set_value(value, length);
+}
+
 template <typename ValueType>
 inline void set_scalar(::Mysqlx::Datatypes::Any &any, const ValueType value) {
   any.set_type(::Mysqlx::Datatypes::Any::SCALAR);
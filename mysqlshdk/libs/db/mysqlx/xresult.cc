@@ -21,6 +21,7 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include "mysqlshdk/libs/db/mysqlx/result.h"
@@ -34,7 +35,10 @@ namespace mysqlshdk {
 namespace db {
 namespace mysqlx {
 Result::Result(std::unique_ptr<xcl::XQuery_result> result)
-    : _result(std::move(result)), _row(this), _fetched_row_count(0) {}
+    : _pre_fetched_rows(std::make_shared<mysqlshdk::db::Row_buffer>()),
+      _result(std::move(result)),
+      _row(this),
+      _fetched_row_count(0) {}
 
 void Result::fetch_metadata() {
   _metadata.clear();
@@ -158,16 +162,21 @@ int64_t Result::get_auto_increment_value() const {
 }
 
 uint64_t Result::get_affected_row_count() const {
+  uint64_t count = 0;
   uint64_t i = 0;
-  if (_result) {
-    _result->try_get_affected_rows(&i);
+  if (_result && _result->try_get_affected_rows(&i)) count += i;
+  for (const auto &batch : _batch_results) {
+    if (batch->try_get_affected_rows(&i)) count += i;
   }
-  return i;
+  return count;
 }
 
 uint64_t Result::get_warning_count() const {
-  if (_result) return _result->get_warnings().size();
-  return 0;
+  uint64_t count = 0;
+  if (_result) count += _result->get_warnings().size();
+  for (const auto &batch : _batch_results)
+    count += batch->get_warnings().size();
+  return count;
 }
 
 std::vector<std::string> Result::get_generated_ids() {
@@ -175,6 +184,12 @@ std::vector<std::string> Result::get_generated_ids() {
 
   _result->try_get_generated_document_ids(&ids);
 
+  for (const auto &batch : _batch_results) {
+    std::vector<std::string> batch_ids;
+    if (batch->try_get_generated_document_ids(&batch_ids))
+      ids.insert(ids.end(), batch_ids.begin(), batch_ids.end());
+  }
+
   return ids;
 }
 
@@ -192,19 +207,13 @@ Result::~Result() {
 
 const IRow *Result::fetch_one() {
   if (_pre_fetched) {
-    if (_persistent_pre_fetch && !_pre_fetched_rows.empty()) {
-      if (_fetched_row_count > 0)  // free the previously fetched row
-        _pre_fetched_rows.pop_front();
-      if (!_pre_fetched_rows.empty()) {
-        // return the next row, but don't pop it yet otherwise it'll be freed
-        const IRow *row = &_pre_fetched_rows.front();
-        _fetched_row_count++;
-        return row;
-      }
-    } else {
-      if (_fetched_row_count < _pre_fetched_rows.size()) {
-        return &_pre_fetched_rows[_fetched_row_count++];
+    if (_pre_fetch_index < _pre_fetched_rows->size()) {
+      if (_pre_fetch_index == _pre_fetched_cursors.size()) {
+        _pre_fetched_cursors.emplace_back(
+            _pre_fetched_rows->row(_pre_fetch_index));
       }
+      _fetched_row_count++;
+      return &_pre_fetched_cursors[_pre_fetch_index++];
     }
   } else {
     // Loads the first row
@@ -222,11 +231,13 @@ const IRow *Result::fetch_one() {
   return nullptr;
 }
 
-void Result::rewind() { _fetched_row_count = 0; }
+void Result::rewind() {
+  _fetched_row_count = 0;
+  _pre_fetch_index = 0;
+}
 
-bool Result::pre_fetch_rows(bool persistent) {
+bool Result::pre_fetch_rows() {
   if (_result) {
-    _persistent_pre_fetch = persistent;
     _stop_pre_fetch = false;
     if (!_result->has_resultset()) return false;
     Row wrapper(this);
@@ -234,12 +245,12 @@ bool Result::pre_fetch_rows(bool persistent) {
     while (const ::xcl::XRow *row = _result->get_next_row(&error)) {
       if (_stop_pre_fetch) return true;
       wrapper.reset(row);
-      _pre_fetched_rows.push_back(Row_copy(wrapper));
+      _pre_fetched_rows->append(wrapper);
     }
     if (error) {
       std::stringstream msg;
       msg << "Error " << error.error() << " (" << error.what() << ")";
-      msg << " while fetching row " << _pre_fetched_rows.size() + 1 << ".";
+      msg << " while fetching row " << _pre_fetched_rows->size() + 1 << ".";
       throw mysqlshdk::db::Error(msg.str().c_str(), error.error());
     }
     _pre_fetched = true;
@@ -249,13 +260,31 @@ bool Result::pre_fetch_rows(bool persistent) {
 
 void Result::stop_pre_fetch() { _stop_pre_fetch = true; }
 
+std::pair<std::shared_ptr<const mysqlshdk::db::Row_buffer>, size_t>
+Result::fetch_all_buffered() {
+  // rows which were streamed are not in the buffer, it only gets the
+  // remaining ones
+  if (!_pre_fetched) {
+    pre_fetch_rows();
+    _pre_fetch_index = 0;
+  }
+
+  const size_t first = std::min(_pre_fetch_index, _pre_fetched_rows->size());
+  _pre_fetch_index = _pre_fetched_rows->size();
+  _fetched_row_count += _pre_fetch_index - first;
+
+  return {_pre_fetched_rows, first};
+}
+
 bool Result::has_resultset() { return _result->has_resultset(); }
 
 bool Result::next_resultset() {
   bool ret_val = false;
 
-  _pre_fetched_rows.clear();
+  _pre_fetched_rows = std::make_shared<mysqlshdk::db::Row_buffer>();
+  _pre_fetched_cursors.clear();
   _pre_fetched = false;
+  _pre_fetch_index = 0;
 
   xcl::XError error;
   ret_val = _result->next_resultset(&error);
@@ -265,10 +294,25 @@ bool Result::next_resultset() {
 }
 
 std::unique_ptr<Warning> Result::fetch_one_warning() {
-  const auto &warnings = _result->get_warnings();
-  if (_fetched_warning_count < warnings.size()) {
+  // warnings of the batches follow the ones of the first reply
+  const Mysqlx::Notice::Warning *next = nullptr;
+  size_t index = _fetched_warning_count;
+  const auto find_next = [&next, &index](xcl::XQuery_result &result) {
+    const auto &warnings = result.get_warnings();
+    if (index < warnings.size())
+      next = &warnings[index];
+    else
+      index -= warnings.size();
+  };
+
+  find_next(*_result);
+  for (auto it = _batch_results.begin(); !next && it != _batch_results.end();
+       ++it)
+    find_next(**it);
+
+  if (next) {
     std::unique_ptr<Warning> w(new Warning());
-    const Mysqlx::Notice::Warning &warning = warnings[_fetched_warning_count];
+    const Mysqlx::Notice::Warning &warning = *next;
     switch (warning.level()) {
       case Mysqlx::Notice::Warning::NOTE:
         w->level = Warning::Level::Note;
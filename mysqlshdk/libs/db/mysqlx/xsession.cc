@@ -21,14 +21,18 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <mysqld_error.h>
 #include <mysqlx_version.h>
 
+#include <deque>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "utils/debug.h"
 #include "utils/utils_general.h"
 
@@ -37,6 +41,93 @@ namespace db {
 namespace mysqlx {
 
 namespace {
+// mysqlx_max_allowed_packet cannot be set below this value, smaller messages
+// are sent without checking the actual limit
+constexpr size_t k_min_max_allowed_packet = 512;
+
+// X Protocol frame header: payload length and message type
+constexpr size_t k_frame_header_bytes = 5;
+
+// Field tag and length of each of the rows of the Crud::Insert message
+constexpr size_t k_insert_row_overhead_bytes = 6;
+
+// Estimated size of the reply to a Crud::Insert and of each of the document
+// IDs it reports. Batches are sent without reading the replies as long as the
+// pending ones fit into the socket buffers, otherwise the server could block
+// writing them while the client is blocked sending the next batch.
+constexpr size_t k_insert_reply_bytes = 64;
+constexpr size_t k_insert_reply_bytes_per_document = 40;
+constexpr size_t k_max_pending_reply_bytes = 64 * 1024;
+
+/**
+ * Expectation block which fails all the messages following the first one
+ * which failed, without executing them.
+ *
+ * The reply to Expect::Open comes before the replies to the messages of the
+ * block, the reply to Expect::Close comes after them. All of them need to be
+ * read even if one of them is an error, otherwise the remaining ones would be
+ * taken as replies to the next request, so non-fatal errors are recorded to
+ * be thrown once the block is closed. Fatal errors are returned to be thrown
+ * right away.
+ */
+class Expect_block {
+ public:
+  explicit Expect_block(xcl::XProtocol *protocol) : m_protocol(protocol) {}
+
+  xcl::XError open() {
+    Mysqlx::Expect::Open open;
+    open.add_cond()->set_condition_key(
+        Mysqlx::Expect::Open_Condition_Key_EXPECT_NO_ERROR);
+    return m_protocol->send(open);
+  }
+
+  xcl::XError close() { return m_protocol->send(Mysqlx::Expect::Close()); }
+
+  /**
+   * Reads the reply to Expect::Open, needs to be called before the reply to
+   * the first message of the block is read.
+   */
+  xcl::XError read_open_reply() {
+    if (m_open_replied) return {};
+
+    m_open_replied = true;
+    return record(m_protocol->recv_ok());
+  }
+
+  /**
+   * Reads the reply to Expect::Close, once the replies to all the messages
+   * were read. The block fails if any of the messages failed, that error is
+   * not recorded.
+   */
+  xcl::XError read_close_reply() {
+    const auto error = read_open_reply();
+    if (error) return error;
+
+    const auto close_error = m_protocol->recv_ok();
+    return close_error.is_fatal() ? close_error : xcl::XError();
+  }
+
+  xcl::XError record(const xcl::XError &error) {
+    if (error.is_fatal()) return error;
+
+    if (error && !m_error) {
+      m_error.reset(new Error(error.what(), error.error()));
+    }
+
+    return {};
+  }
+
+  /**
+   * The first error recorded, nullptr if none.
+   */
+  const Error *error() const { return m_error.get(); }
+
+ private:
+  xcl::XProtocol *m_protocol;
+  bool m_open_replied = false;
+  std::unique_ptr<Error> m_error;
+};
+
 template <typename Message_type>
 std::string message_to_text(const std::string &binary_message) {
   std::string result;
@@ -363,7 +454,10 @@ void XSession_impl::close() {
   _version = utils::Version();
   _expired_account = false;
   _case_sensitive_table_names = false;
+  _max_allowed_packet = 0;
   _prev_result.reset();
+  _prepared_statements = true;
+  _deallocated_stmts.clear();
   _connection_options = Connection_options();
 }
 
@@ -412,11 +506,16 @@ XSession_impl::~XSession_impl() {
 void XSession_impl::before_query() {
   if (!_mysql) throw std::logic_error("Not connected");
 
+  finish_prev_result();
+  flush_deallocated_stmts();
+}
+
+void XSession_impl::finish_prev_result() {
   if (auto result = _prev_result.lock()) {
     if (result->has_resultset()) {
       // buffer the previous result to remove it from the connection
       // in case it's still active
-      result->pre_fetch_rows(false);
+      result->pre_fetch_rows();
     } else {
       // there's no data, but we need to call next_resultset() anyway
       // bug#26581651 filed for this
@@ -432,7 +531,7 @@ std::shared_ptr<IResult> XSession_impl::after_query(
   res->fetch_metadata();
   _prev_result = res;
 
-  if (buffered) res->pre_fetch_rows(false);
+  if (buffered) res->pre_fetch_rows();
 
   return std::static_pointer_cast<IResult>(res);
 }
@@ -463,8 +562,103 @@ std::shared_ptr<IResult> XSession_impl::execute_stmt(
   return after_query(std::move(xresult));
 }
 
+void XSession_impl::execute_pipelined(const std::vector<std::string> &sql,
+                                      bool stop_on_error,
+                                      const Pipeline_callback &callback) {
+  if (sql.empty()) return;
+
+  before_query();
+
+  auto &protocol = _mysql->get_protocol();
+  Expect_block block(&protocol);
+
+  // with an expectation block, the server fails all the statements following
+  // the first one which failed, without executing them
+  if (stop_on_error) check_error_and_throw(block.open());
+
+  // size of the results is not known upfront, instead the statements which
+  // were sent but whose replies were not read yet need to fit into the
+  // socket buffers, so that the client is never blocked sending while the
+  // server is blocked writing the results
+  std::deque<size_t> pending_replies;
+  size_t pending_reply_bytes = 0;
+  size_t next_reply = 0;
+  // if the block could not be opened none of the statements was executed
+  bool done = false;
+
+  // all the replies need to be read, even if caller is no longer interested
+  const auto read_reply = [&]() {
+    if (stop_on_error && 0 == next_reply) {
+      check_error_and_throw(block.read_open_reply());
+      done = block.error() != nullptr;
+    }
+
+    finish_prev_result();
+
+    xcl::XError error;
+    std::unique_ptr<xcl::XQuery_result> xresult(
+        protocol.recv_resultset(&error));
+
+    if (error) {
+      if (error.is_fatal()) check_error_and_throw(error);
+
+      if (!done) {
+        const Error e(error.what(), error.error());
+        m_last_error.reset(new Error(e));
+        done = !callback(next_reply, nullptr, &e) || stop_on_error;
+      }
+    } else {
+      auto result = after_query(std::move(xresult));
+      m_last_error.reset(nullptr);
+      if (!done) done = !callback(next_reply, result, nullptr);
+    }
+
+    // the whole reply is read before the next one
+    finish_prev_result();
+
+    ++next_reply;
+    pending_reply_bytes -= pending_replies.front();
+    pending_replies.pop_front();
+  };
+
+  for (const auto &stmt : sql) {
+    Mysqlx::Sql::StmtExecute execute;
+    execute.set_stmt(stmt);
+
+    const size_t stmt_bytes =
+        static_cast<size_t>(execute.ByteSize()) + k_frame_header_bytes;
+
+    while (!pending_replies.empty() &&
+           pending_reply_bytes + stmt_bytes > k_max_pending_reply_bytes) {
+      read_reply();
+    }
+
+    check_error_and_throw(protocol.send(execute));
+    pending_replies.push_back(stmt_bytes);
+    pending_reply_bytes += stmt_bytes;
+  }
+
+  if (stop_on_error) check_error_and_throw(block.close());
+
+  while (!pending_replies.empty()) read_reply();
+
+  if (stop_on_error) {
+    // errors of the statements were already reported
+    check_error_and_throw(block.read_close_reply());
+    if (block.error()) store_error_and_throw(*block.error());
+  }
+}
+
 std::shared_ptr<IResult> XSession_impl::execute_crud(
     const ::Mysqlx::Crud::Insert &msg) {
+  const size_t msg_size =
+      static_cast<size_t>(msg.ByteSize()) + k_frame_header_bytes;
+
+  if (msg.row_size() > 1 && msg_size > k_min_max_allowed_packet) {
+    const size_t max_packet = get_max_allowed_packet();
+    if (msg_size > max_packet) return execute_crud_in_batches(msg, max_packet);
+  }
+
   before_query();
   xcl::XError error;
   std::unique_ptr<xcl::XQuery_result> xresult(
@@ -473,6 +667,122 @@ std::shared_ptr<IResult> XSession_impl::execute_crud(
   return after_query(std::move(xresult));
 }
 
+std::shared_ptr<IResult> XSession_impl::execute_crud_in_batches(
+    const ::Mysqlx::Crud::Insert &msg, size_t max_packet) {
+  before_query();
+
+  auto &protocol = _mysql->get_protocol();
+
+  // everything but the rows is repeated in each batch
+  Mysqlx::Crud::Insert batch;
+  *batch.mutable_collection() = msg.collection();
+  batch.set_data_model(msg.data_model());
+  *batch.mutable_projection() = msg.projection();
+  *batch.mutable_args() = msg.args();
+  if (msg.has_upsert()) batch.set_upsert(msg.upsert());
+
+  const size_t batch_overhead =
+      static_cast<size_t>(batch.ByteSize()) + k_frame_header_bytes;
+  const bool generates_ids = msg.data_model() == Mysqlx::Crud::DOCUMENT;
+
+  // with an expectation block, the server fails all the batches following
+  // the first one which failed, without executing them
+  Expect_block block(&protocol);
+  check_error_and_throw(block.open());
+
+  std::deque<size_t> pending_replies;
+  size_t pending_reply_bytes = 0;
+  std::vector<std::unique_ptr<xcl::XQuery_result>> results;
+
+  const auto read_reply = [&]() {
+    check_error_and_throw(block.read_open_reply());
+
+    xcl::XError error;
+    std::unique_ptr<xcl::XQuery_result> xresult(
+        protocol.recv_resultset(&error));
+
+    if (!error) {
+      // read everything up to StmtExecuteOk, so the next reply can be read
+      while (xresult->next_resultset(&error)) {
+      }
+    }
+
+    if (error)
+      check_error_and_throw(block.record(error));
+    else
+      results.emplace_back(std::move(xresult));
+
+    pending_reply_bytes -= pending_replies.front();
+    pending_replies.pop_front();
+  };
+
+  const auto send_batch = [&]() {
+    const size_t reply_bytes =
+        k_insert_reply_bytes +
+        (generates_ids ? batch.row_size() * k_insert_reply_bytes_per_document
+                       : 0);
+
+    while (!pending_replies.empty() &&
+           pending_reply_bytes + reply_bytes > k_max_pending_reply_bytes) {
+      read_reply();
+    }
+
+    check_error_and_throw(protocol.send(batch));
+    pending_replies.push_back(reply_bytes);
+    pending_reply_bytes += reply_bytes;
+    batch.clear_row();
+  };
+
+  size_t batch_size = batch_overhead;
+
+  for (const auto &row : msg.row()) {
+    const size_t row_size =
+        static_cast<size_t>(row.ByteSize()) + k_insert_row_overhead_bytes;
+
+    // a single row which exceeds the limit is sent anyway, server reports it
+    if (batch.row_size() > 0 && batch_size + row_size > max_packet) {
+      send_batch();
+      batch_size = batch_overhead;
+    }
+
+    *batch.add_row() = row;
+    batch_size += row_size;
+  }
+
+  send_batch();
+  check_error_and_throw(block.close());
+
+  // all the replies need to be read, even if one of the batches failed
+  while (!pending_replies.empty()) read_reply();
+
+  check_error_and_throw(block.read_close_reply());
+  if (block.error()) store_error_and_throw(*block.error());
+
+  std::shared_ptr<Result> res(new Result(std::move(results.front())));
+
+  for (auto it = results.begin() + 1; it != results.end(); ++it)
+    res->_batch_results.emplace_back(std::move(*it));
+
+  m_last_error.reset(nullptr);
+
+  return std::static_pointer_cast<IResult>(res);
+}
+
+size_t XSession_impl::get_max_allowed_packet() {
+  if (0 == _max_allowed_packet) {
+    const auto result = query("SELECT @@mysqlx_max_allowed_packet");
+    const auto row = result->fetch_one();
+
+    if (!row) {
+      throw std::logic_error("Query result returned fewer rows than expected");
+    }
+
+    _max_allowed_packet = row->get_uint(0);
+  }
+
+  return _max_allowed_packet;
+}
+
 std::shared_ptr<IResult> XSession_impl::execute_crud(
     const ::Mysqlx::Crud::Update &msg) {
   before_query();
@@ -503,6 +813,194 @@ std::shared_ptr<IResult> XSession_impl::execute_crud(
   return after_query(std::move(xresult));
 }
 
+bool XSession_impl::supports_prepared_statements() const {
+  return _prepared_statements;
+}
+
+namespace {
+/**
+ * Encoder of the Mysqlx.Prepare messages (mysqlx_prepare.proto). They were
+ * added to the X Protocol in 8.0.14, the client library this is built against
+ * does not define them, so they are encoded here and sent as raw messages.
+ */
+class Prepare_message {
+ public:
+  // Mysqlx.ClientMessages.Type
+  enum Type : xcl::XProtocol::Header_message_type_id {
+    PREPARE = 40,
+    EXECUTE = 41,
+    DEALLOCATE = 42
+  };
+
+  // Mysqlx.Prepare.Prepare.OneOfMessage.Type
+  enum Stmt_type : uint32_t { FIND = 0, UPDATE = 2, DELETE = 4 };
+
+  explicit Prepare_message(Type type) : m_type(type) {}
+
+  Prepare_message &add_uint32(uint32_t field, uint32_t value) {
+    add_varint(field << 3 | k_wire_varint);
+    add_varint(value);
+    return *this;
+  }
+
+  Prepare_message &add_message(uint32_t field, const std::string &bytes) {
+    add_varint(field << 3 | k_wire_length_delimited);
+    add_varint(bytes.size());
+    m_buffer.append(bytes);
+    return *this;
+  }
+
+  Prepare_message &add_message(uint32_t field,
+                               const ::google::protobuf::MessageLite &msg) {
+    return add_message(field, msg.SerializeAsString());
+  }
+
+  const std::string &bytes() const { return m_buffer; }
+
+  xcl::XError send(xcl::XProtocol *protocol) const {
+    return protocol->send(m_type,
+                          reinterpret_cast<const uint8_t *>(m_buffer.data()),
+                          m_buffer.size());
+  }
+
+ private:
+  static constexpr uint32_t k_wire_varint = 0;
+  static constexpr uint32_t k_wire_length_delimited = 2;
+
+  void add_varint(uint64_t value) {
+    while (value >= 0x80) {
+      m_buffer.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+
+    m_buffer.push_back(static_cast<char>(value));
+  }
+
+  Type m_type;
+  std::string m_buffer;
+};
+
+// Fields of Mysqlx.Prepare.Prepare.OneOfMessage holding the statement
+constexpr uint32_t k_prepare_find_field = 2;
+constexpr uint32_t k_prepare_update_field = 4;
+constexpr uint32_t k_prepare_delete_field = 5;
+
+template <typename Message>
+xcl::XError send_prepare(xcl::XSession *session, uint32_t stmt_id,
+                         Prepare_message::Stmt_type type, uint32_t field,
+                         Message msg) {
+  // args are sent with each Execute
+  msg.clear_args();
+
+  // Prepare.OneOfMessage, embedded in the Prepare message
+  const auto stmt = Prepare_message(Prepare_message::PREPARE)
+                        .add_uint32(1, type)
+                        .add_message(field, msg);
+
+  auto &protocol = session->get_protocol();
+  xcl::XError error = Prepare_message(Prepare_message::PREPARE)
+                          .add_uint32(1, stmt_id)
+                          .add_message(2, stmt.bytes())
+                          .send(&protocol);
+  if (!error) error = protocol.recv_ok();
+  return error;
+}
+}  // namespace
+
+bool XSession_impl::check_prepare_error(const xcl::XError &error) {
+  if (!error) return true;
+
+  switch (error.error()) {
+    case ER_UNKNOWN_COM_ERROR:
+      // server does not know the Prepare message, don't try again
+      _prepared_statements = false;
+      return false;
+
+    case ER_MAX_PREPARED_STMT_COUNT_REACHED:
+      return false;
+
+    default:
+      check_error_and_throw(error);
+      return false;
+  }
+}
+
+bool XSession_impl::prepare_stmt(uint32_t stmt_id,
+                                 const ::Mysqlx::Crud::Update &msg) {
+  before_query();
+  return check_prepare_error(
+      send_prepare(_mysql.get(), stmt_id, Prepare_message::UPDATE,
+                   k_prepare_update_field, msg));
+}
+
+bool XSession_impl::prepare_stmt(uint32_t stmt_id,
+                                 const ::Mysqlx::Crud::Delete &msg) {
+  before_query();
+  return check_prepare_error(
+      send_prepare(_mysql.get(), stmt_id, Prepare_message::DELETE,
+                   k_prepare_delete_field, msg));
+}
+
+bool XSession_impl::prepare_stmt(uint32_t stmt_id,
+                                 const ::Mysqlx::Crud::Find &msg) {
+  before_query();
+  return check_prepare_error(
+      send_prepare(_mysql.get(), stmt_id, Prepare_message::FIND,
+                   k_prepare_find_field, msg));
+}
+
+std::shared_ptr<IResult> XSession_impl::execute_prep_stmt(
+    uint32_t stmt_id,
+    const ::google::protobuf::RepeatedPtrField<::Mysqlx::Datatypes::Scalar>
+        &args) {
+  before_query();
+  Prepare_message execute(Prepare_message::EXECUTE);
+  execute.add_uint32(1, stmt_id);
+  for (const auto &arg : args) {
+    Mysqlx::Datatypes::Any any;
+    any.set_type(Mysqlx::Datatypes::Any::SCALAR);
+    any.mutable_scalar()->CopyFrom(arg);
+    execute.add_message(2, any);
+  }
+
+  auto &protocol = _mysql->get_protocol();
+  xcl::XError error = execute.send(&protocol);
+  check_error_and_throw(error);
+  std::unique_ptr<xcl::XQuery_result> xresult(protocol.recv_resultset(&error));
+  check_error_and_throw(error);
+  return after_query(std::move(xresult));
+}
+
+void XSession_impl::deallocate_stmt(uint32_t stmt_id) {
+  // statements are gone along with the connection
+  if (valid()) _deallocated_stmts.push_back(stmt_id);
+}
+
+void XSession_impl::flush_deallocated_stmts() {
+  if (_deallocated_stmts.empty()) return;
+
+  std::vector<uint32_t> stmts;
+  std::swap(stmts, _deallocated_stmts);
+
+  auto &protocol = _mysql->get_protocol();
+
+  // requests are pipelined, replies are read once all of them are sent
+  for (const auto id : stmts) {
+    check_error_and_throw(Prepare_message(Prepare_message::DEALLOCATE)
+                              .add_uint32(1, id)
+                              .send(&protocol));
+  }
+
+  for (size_t i = 0; i < stmts.size(); ++i) {
+    xcl::XError error = protocol.recv_ok();
+
+    if (error) {
+      if (error.is_fatal()) check_error_and_throw(error);
+      log_warning("Error deallocating prepared statement: %s", error.what());
+    }
+  }
+}
+
 void XSession_impl::check_error_and_throw(const xcl::XError &error) {
   if (error) {
     store_error_and_throw(Error(error.what(), error.error()));
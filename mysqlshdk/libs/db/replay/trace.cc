@@ -597,6 +597,14 @@ class Row_unserializer : public db::IRow {
   }
 };
 
+// rows of a result share the field types of its first row
+void append_row(const IRow &row, std::vector<Row_copy> *rows) {
+  if (rows->empty())
+    rows->emplace_back(row);
+  else
+    rows->emplace_back(row, rows->front());
+}
+
 void Trace::unserialize_result_rows(
     rapidjson::Value *rlist, std::shared_ptr<Result_mysql> result,
     std::function<std::unique_ptr<IRow>(std::unique_ptr<IRow>)> intercept) {
@@ -604,10 +612,10 @@ void Trace::unserialize_result_rows(
     if (intercept) {
       std::unique_ptr<IRow> row_copier(intercept(std::unique_ptr<IRow>{
           new Row_unserializer((*rlist)[i], result->_metadata)}));
-      result->_rows.emplace_back(*row_copier);
+      append_row(*row_copier, &result->_rows);
     } else {
-      result->_rows.emplace_back(
-          Row_unserializer((*rlist)[i], result->_metadata));
+      append_row(Row_unserializer((*rlist)[i], result->_metadata),
+                 &result->_rows);
     }
   }
 }
@@ -619,10 +627,10 @@ void Trace::unserialize_result_rows(
     if (intercept) {
       std::unique_ptr<IRow> row_copier(intercept(std::unique_ptr<IRow>{
           new Row_unserializer((*rlist)[i], result->_metadata)}));
-      result->_rows.emplace_back(*row_copier);
+      append_row(*row_copier, &result->_rows);
     } else {
-      result->_rows.emplace_back(
-          Row_unserializer((*rlist)[i], result->_metadata));
+      append_row(Row_unserializer((*rlist)[i], result->_metadata),
+                 &result->_rows);
     }
   }
 }
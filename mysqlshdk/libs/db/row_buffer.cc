@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/row_buffer.h"
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace db {
+
+#define FIELD_ERROR(index, func, msg) \
+  std::invalid_argument(              \
+      shcore::str_format("%s(%u): " msg, func, index).c_str())
+
+#define FIELD_ERROR1(index, func, msg, arg) \
+  std::invalid_argument(                    \
+      shcore::str_format("%s(%u): " msg, func, index, arg).c_str())
+
+#define GET_VALIDATE_TYPE(index, TYPE_CHECK)                      \
+  const Column &col = value(index, __FUNCTION__);                 \
+  const Type ftype = col.type;                                    \
+  if (!(TYPE_CHECK))                                              \
+    throw FIELD_ERROR1(index, __FUNCTION__, "field type is %s",   \
+                       to_string(ftype).c_str());                 \
+  const Cell &cell = col.cells[_row];                             \
+  (void)cell
+
+bool Row_buffer::is_arena_type(Type type) {
+  return type == Type::Decimal || type == Type::Bit || is_string_type(type);
+}
+
+void Row_buffer::append(const IRow &row) {
+  const uint32_t fields = row.num_fields();
+
+  if (_rows == 0 && _columns.empty()) {
+    _columns.reserve(fields);
+    for (uint32_t i = 0; i < fields; i++) _columns.emplace_back(row.get_type(i));
+  } else if (fields != _columns.size()) {
+    throw std::invalid_argument(
+        "Attempt to buffer a row with a different number of fields");
+  }
+
+  for (uint32_t i = 0; i < fields; i++) {
+    Column &col = _columns[i];
+    const bool null = col.type == Type::Null || row.is_null(i);
+    Cell cell;
+    cell.u = 0;
+
+    col.nulls.push_back(null);
+
+    if (!null) {
+      switch (col.type) {
+        case Type::Integer:
+          cell.i = row.get_int(i);
+          break;
+
+        case Type::UInteger:
+          cell.u = row.get_uint(i);
+          break;
+
+        case Type::Float:
+          cell.f = row.get_float(i);
+          break;
+
+        case Type::Double:
+          cell.d = row.get_double(i);
+          break;
+
+        case Type::Decimal:
+        case Type::Bit: {
+          const std::string data = row.get_as_string(i);
+          cell.u = _arena.size();
+          _arena.append(data);
+          col.lengths.push_back(static_cast<uint32_t>(data.size()));
+          break;
+        }
+
+        case Type::Geometry:
+        case Type::Json:
+        case Type::Date:
+        case Type::Time:
+        case Type::DateTime:
+        case Type::Enum:
+        case Type::Set: {
+          const std::string data = row.get_string(i);
+          cell.u = _arena.size();
+          _arena.append(data);
+          col.lengths.push_back(static_cast<uint32_t>(data.size()));
+          break;
+        }
+
+        case Type::String:
+        case Type::Bytes: {
+          // copied straight from the protocol buffer, no temporary string
+          const auto data = row.get_string_data(i);
+          cell.u = _arena.size();
+          _arena.append(data.first, data.second);
+          col.lengths.push_back(static_cast<uint32_t>(data.second));
+          break;
+        }
+
+        case Type::Null:
+          break;
+      }
+    } else if (is_arena_type(col.type)) {
+      col.lengths.push_back(0);
+    }
+
+    col.cells.push_back(cell);
+  }
+
+  ++_rows;
+}
+
+Row_buffer::Cursor Row_buffer::row(size_t index) const {
+  if (index >= _rows) throw std::out_of_range("Row index out of bounds");
+  return Cursor(this, index);
+}
+
+void Row_buffer::clear() {
+  // swap to actually release the memory
+  std::vector<Column>().swap(_columns);
+  std::string().swap(_arena);
+  _rows = 0;
+}
+
+size_t Row_buffer::memory_usage() const {
+  size_t total = _arena.capacity();
+  for (const auto &col : _columns) {
+    total += col.cells.capacity() * sizeof(Cell) +
+             col.lengths.capacity() * sizeof(uint32_t) +
+             col.nulls.capacity() / CHAR_BIT;
+  }
+  return total;
+}
+
+const Row_buffer::Column &Row_buffer::Cursor::column(uint32_t index,
+                                                     const char *func) const {
+  if (index >= _owner->_columns.size())
+    throw FIELD_ERROR(index, func, "index out of bounds");
+  return _owner->_columns[index];
+}
+
+const Row_buffer::Column &Row_buffer::Cursor::value(uint32_t index,
+                                                    const char *func) const {
+  const Column &col = column(index, func);
+  if (col.nulls[_row]) throw FIELD_ERROR(index, func, "field is NULL");
+  return col;
+}
+
+std::pair<const char *, size_t> Row_buffer::Cursor::string_value(
+    const Column &col) const {
+  return {_owner->_arena.data() + col.cells[_row].u, col.lengths[_row]};
+}
+
+uint32_t Row_buffer::Cursor::num_fields() const {
+  return static_cast<uint32_t>(_owner->_columns.size());
+}
+
+Type Row_buffer::Cursor::get_type(uint32_t index) const {
+  return column(index, __FUNCTION__).type;
+}
+
+bool Row_buffer::Cursor::is_null(uint32_t index) const {
+  return column(index, __FUNCTION__).nulls[_row];
+}
+
+std::string Row_buffer::Cursor::get_as_string(uint32_t index) const {
+  const Column &col = column(index, __FUNCTION__);
+
+  if (col.nulls[_row]) return "NULL";
+
+  const Cell &cell = col.cells[_row];
+
+  switch (col.type) {
+    case Type::Null:
+      return "NULL";
+
+    case Type::Integer:
+      return std::to_string(cell.i);
+
+    case Type::UInteger:
+      return std::to_string(cell.u);
+
+    case Type::Float:
+      return std::to_string(cell.f);
+
+    case Type::Double:
+      return std::to_string(cell.d);
+
+    default: {
+      const auto data = string_value(col);
+      return std::string(data.first, data.second);
+    }
+  }
+}
+
+std::string Row_buffer::Cursor::get_string(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (is_string_type(ftype)));
+  const auto data = string_value(col);
+  return std::string(data.first, data.second);
+}
+
+std::pair<const char *, size_t> Row_buffer::Cursor::get_string_data(
+    uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::String || ftype == Type::Bytes));
+  return string_value(col);
+}
+
+int64_t Row_buffer::Cursor::get_int(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer ||
+                            ftype == Type::UInteger ||
+                            ftype == Type::Decimal));
+
+  if (ftype == Type::UInteger) {
+    if (cell.u > LLONG_MAX)
+      throw FIELD_ERROR(index, __FUNCTION__,
+                        "field value out of the allowed range");
+    return static_cast<int64_t>(cell.u);
+  } else if (ftype == Type::Decimal) {
+    const auto data = string_value(col);
+    const std::string dec(data.first, data.second);
+    if (dec.find('.') != std::string::npos)
+      throw FIELD_ERROR1(index, __FUNCTION__, "field type is %s",
+                         to_string(ftype).c_str());
+    return std::stoll(dec);
+  }
+  return cell.i;
+}
+
+uint64_t Row_buffer::Cursor::get_uint(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer ||
+                            ftype == Type::UInteger ||
+                            ftype == Type::Decimal));
+
+  if (ftype == Type::Integer) {
+    if (cell.i < 0)
+      throw FIELD_ERROR(index, __FUNCTION__,
+                        "field value out of the allowed range");
+    return static_cast<uint64_t>(cell.i);
+  } else if (ftype == Type::Decimal) {
+    const auto data = string_value(col);
+    const std::string dec(data.first, data.second);
+    if (dec.find('.') != std::string::npos)
+      throw FIELD_ERROR1(index, __FUNCTION__, "field type is %s",
+                         to_string(ftype).c_str());
+    if (!dec.empty() && dec[0] == '-')
+      throw FIELD_ERROR(index, __FUNCTION__,
+                        "field value out of the allowed range");
+    return std::stoull(dec);
+  }
+  return cell.u;
+}
+
+float Row_buffer::Cursor::get_float(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Float || ftype == Type::Decimal ||
+                            ftype == Type::Double));
+  switch (ftype) {
+    case Type::Decimal: {
+      const auto data = string_value(col);
+      try {
+        return std::stof(std::string(data.first, data.second));
+      } catch (...) {
+        throw FIELD_ERROR(index, __FUNCTION__,
+                          "float value out of the allowed range");
+      }
+    }
+    case Type::Double:
+      return static_cast<float>(cell.d);
+    default:
+      return cell.f;
+  }
+}
+
+double Row_buffer::Cursor::get_double(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Double || ftype == Type::Float ||
+                            ftype == Type::Decimal));
+  switch (ftype) {
+    case Type::Decimal: {
+      const auto data = string_value(col);
+      try {
+        return std::stod(std::string(data.first, data.second));
+      } catch (...) {
+        throw FIELD_ERROR(index, __FUNCTION__,
+                          "double value out of the allowed range");
+      }
+    }
+    case Type::Float:
+      return static_cast<double>(cell.f);
+    default:
+      return cell.d;
+  }
+}
+
+uint64_t Row_buffer::Cursor::get_bit(uint32_t index) const {
+  GET_VALIDATE_TYPE(index, (ftype == Type::Bit));
+  const auto data = string_value(col);
+  return shcore::string_to_bits(std::string(data.first, data.second)).first;
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
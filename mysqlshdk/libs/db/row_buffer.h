@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Columnar in-memory storage for buffered result sets
+
+#ifndef MYSQLSHDK_LIBS_DB_ROW_BUFFER_H_
+#define MYSQLSHDK_LIBS_DB_ROW_BUFFER_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "mysqlshdk/include/mysqlshdk_export.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Stores a sequence of rows column by column, as opposed to a sequence of
+ * Row_copy objects, which allocate one object per field.
+ *
+ * Numeric values are kept in a fixed size slot per cell, string-like values
+ * are appended to a single contiguous arena shared by all columns and NULLs
+ * are tracked in a bitmap per column. Rows are read back through cursors
+ * that implement IRow, each cursor refers to a single row and stays valid
+ * until the buffer is cleared.
+ */
+class SHCORE_PUBLIC Row_buffer {
+ private:
+  struct Column;
+
+ public:
+  /**
+   * View of a single buffered row, cheap to copy.
+   */
+  class Cursor : public IRow {
+   public:
+    Cursor(const Cursor &other)
+        : IRow(), _owner(other._owner), _row(other._row) {}
+
+    Cursor &operator=(const Cursor &other) {
+      _owner = other._owner;
+      _row = other._row;
+      return *this;
+    }
+
+    uint32_t num_fields() const override;
+
+    Type get_type(uint32_t index) const override;
+    bool is_null(uint32_t index) const override;
+    std::string get_as_string(uint32_t index) const override;
+
+    std::string get_string(uint32_t index) const override;
+    int64_t get_int(uint32_t index) const override;
+    uint64_t get_uint(uint32_t index) const override;
+    float get_float(uint32_t index) const override;
+    double get_double(uint32_t index) const override;
+    std::pair<const char *, size_t> get_string_data(
+        uint32_t index) const override;
+    uint64_t get_bit(uint32_t index) const override;
+
+   private:
+    friend class Row_buffer;
+
+    Cursor(const Row_buffer *owner, size_t row) : _owner(owner), _row(row) {}
+
+    const Column &column(uint32_t index, const char *func) const;
+    const Column &value(uint32_t index, const char *func) const;
+    std::pair<const char *, size_t> string_value(const Column &col) const;
+
+    const Row_buffer *_owner;
+    size_t _row;
+  };
+
+  Row_buffer() = default;
+  Row_buffer(const Row_buffer &) = delete;
+  Row_buffer &operator=(const Row_buffer &) = delete;
+
+  /**
+   * Appends a copy of the given row. The column types are taken from the
+   * first row appended, all subsequent rows must have the same layout.
+   */
+  void append(const IRow &row);
+
+  /**
+   * Returns a view of the row at the given position.
+   */
+  Cursor row(size_t index) const;
+
+  size_t size() const { return _rows; }
+  bool empty() const { return _rows == 0; }
+
+  /**
+   * Releases all the stored rows.
+   */
+  void clear();
+
+  /**
+   * Approximate number of bytes allocated to hold the data.
+   */
+  size_t memory_usage() const;
+
+ private:
+  union Cell {
+    int64_t i;
+    uint64_t u;
+    float f;
+    double d;
+  };
+
+  struct Column {
+    explicit Column(Type t) : type(t) {}
+
+    Type type;
+    // numeric value or, for string-like columns, the offset in the arena
+    std::vector<Cell> cells;
+    // length of the string-like values, empty for numeric columns
+    std::vector<uint32_t> lengths;
+    std::vector<bool> nulls;
+  };
+
+  static bool is_arena_type(Type type);
+
+  std::vector<Column> _columns;
+  std::string _arena;
+  size_t _rows = 0;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+#endif  // MYSQLSHDK_LIBS_DB_ROW_BUFFER_H_
@@ -51,34 +51,56 @@ namespace db {
 
 #define GET_VALIDATE_TYPE(index, TYPE_CHECK)                                  \
   if (index >= num_fields()) throw FIELD_ERROR(index, "index out of bounds"); \
-  if (_data->fields[index] == nullptr)                                        \
-    throw FIELD_ERROR(index, "field is NULL");                                \
+  if (_data->fields[index].null) throw FIELD_ERROR(index, "field is NULL");   \
   ftype = get_type(index);                                                    \
   if (!(TYPE_CHECK))                                                          \
     throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str());
 
+namespace {
+
+std::shared_ptr<std::vector<Type>> row_types(const IRow &row) {
+  auto types = std::make_shared<std::vector<Type>>();
+  types->reserve(row.num_fields());
+  for (uint32_t c = row.num_fields(), i = 0; i < c; i++)
+    types->push_back(row.get_type(i));
+  return types;
+}
+
+}  // namespace
+
 Mem_row::Mem_row() {}
 
-Row_copy::Row_copy(const IRow &row) {
+Row_copy::Row_copy(const IRow &row) : Row_copy(row, Row_copy()) {}
+
+Row_copy::Row_copy(const IRow &row, const Mem_row &layout) {
   _data = std::make_shared<Data>();
 
-  for (uint32_t c = row.num_fields(), i = 0; i < c; i++) {
-    _data->types.push_back(row.get_type(i));
+  const uint32_t c = row.num_fields();
+  bool same_types = layout._data && layout._data->types->size() == c;
 
-    if (row.is_null(i)) {
-      _data->fields.emplace_back(nullptr);
-      continue;
-    }
+  for (uint32_t i = 0; same_types && i < c; i++)
+    same_types = (*layout._data->types)[i] == row.get_type(i);
+
+  _data->types = same_types ? layout._data->types : row_types(row);
+  _data->fields.resize(c);
+
+  for (uint32_t i = 0; i < c; i++) {
+    if (row.is_null(i)) continue;
 
-    switch (row.get_type(i)) {
+    Field &field = _data->fields[i];
+    field.null = false;
+
+    switch (field_type(i)) {
       case Type::Null:
-        _data->fields.emplace_back(nullptr);
+        field.null = true;
         break;
 
       case Type::Decimal:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<std::string>>(
-            new Field_data<std::string>(row.get_as_string(i))));
+      case Type::Bit: {
+        const std::string value = row.get_as_string(i);
+        set_string(i, value.data(), value.size());
         break;
+      }
 
       case Type::Date:
       case Type::DateTime:
@@ -87,43 +109,27 @@ Row_copy::Row_copy(const IRow &row) {
       case Type::Json:
       case Type::Enum:
       case Type::Set:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<std::string>>(
-            new Field_data<std::string>(row.get_string(i))));
-        break;
-
       case Type::String:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<std::string>>(
-            new Field_data<std::string>(row.get_string(i))));
-        break;
-
-      case Type::Bytes:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<std::string>>(
-            new Field_data<std::string>(row.get_string(i))));
+      case Type::Bytes: {
+        const std::string value = row.get_string(i);
+        set_string(i, value.data(), value.size());
         break;
+      }
 
       case Type::Integer:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<int64_t>>(
-            new Field_data<int64_t>(row.get_int(i))));
+        field.value.i = row.get_int(i);
         break;
 
       case Type::UInteger:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<uint64_t>>(
-            new Field_data<uint64_t>(row.get_uint(i))));
+        field.value.u = row.get_uint(i);
         break;
 
       case Type::Float:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<float>>(
-            new Field_data<float>(row.get_float(i))));
+        field.value.f = row.get_float(i);
         break;
 
       case Type::Double:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<double>>(
-            new Field_data<double>(row.get_double(i))));
-        break;
-
-      case Type::Bit:
-        _data->fields.emplace_back(std::unique_ptr<Field_data<std::string>>(
-            new Field_data<std::string>(row.get_as_string(i))));
+        field.value.d = row.get_double(i);
         break;
     }
   }
@@ -140,11 +146,11 @@ Mem_row &Mem_row::operator=(const Mem_row &row) {
 
 Type Mem_row::get_type(uint32_t index) const {
   VALIDATE_INDEX(index);
-  return _data->types[index];
+  return field_type(index);
 }
 
 uint32_t Mem_row::num_fields() const {
-  return static_cast<uint32_t>(_data->types.size());
+  return static_cast<uint32_t>(_data->types->size());
 }
 
 std::string Mem_row::get_as_string(uint32_t index) const {
@@ -157,10 +163,10 @@ std::string Mem_row::get_as_string(uint32_t index) const {
       return "NULL";
 
     case Type::String:
-      return get<std::string>(index);
+      return get_stored_string(index);
 
     case Type::Bytes:
-      return get<std::string>(index);
+      return get_stored_string(index);
 
     case Type::Decimal:
     case Type::Date:
@@ -170,22 +176,22 @@ std::string Mem_row::get_as_string(uint32_t index) const {
     case Type::Json:
     case Type::Enum:
     case Type::Set:
-      return get<std::string>(index);
+      return get_stored_string(index);
 
     case Type::Integer:
-      return std::to_string(get<int64_t>(index));
+      return std::to_string(_data->fields[index].value.i);
 
     case Type::UInteger:
-      return std::to_string(get<uint64_t>(index));
+      return std::to_string(_data->fields[index].value.u);
 
     case Type::Float:
-      return std::to_string(get<float>(index));
+      return std::to_string(_data->fields[index].value.f);
 
     case Type::Double:
-      return std::to_string(get<double>(index));
+      return std::to_string(_data->fields[index].value.d);
 
     case Type::Bit:
-      return get<std::string>(index);
+      return get_stored_string(index);
   }
   throw std::invalid_argument("Unknown type in field");
 }
@@ -195,11 +201,11 @@ int64_t Mem_row::get_int(uint32_t index) const {
   std::string dec;
   GET_VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
                             (ftype == Type::Decimal &&
-                             (dec = get<std::string>(index)).find('.') ==
+                             (dec = get_stored_string(index)).find('.') ==
                                  std::string::npos)));
 
   if (ftype == Type::UInteger) {
-    uint64_t u = get<uint64_t>(index);
+    uint64_t u = _data->fields[index].value.u;
     if (u > LLONG_MAX) {
       throw FIELD_ERROR(index, "field value out of the allowed range");
     }
@@ -207,7 +213,7 @@ int64_t Mem_row::get_int(uint32_t index) const {
   } else if (ftype == Type::Decimal) {
     return std::stoll(dec);
   }
-  return get<int64_t>(index);
+  return _data->fields[index].value.i;
 }
 
 uint64_t Mem_row::get_uint(uint32_t index) const {
@@ -215,11 +221,11 @@ uint64_t Mem_row::get_uint(uint32_t index) const {
   std::string dec;
   GET_VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
                             (ftype == Type::Decimal &&
-                             (dec = get<std::string>(index)).find('.') ==
+                             (dec = get_stored_string(index)).find('.') ==
                                  std::string::npos)));
 
   if (ftype == Type::Integer) {
-    int64_t i = get<int64_t>(index);
+    int64_t i = _data->fields[index].value.i;
     if (i < 0) {
       throw FIELD_ERROR(index, "field value out of the allowed range");
     }
@@ -230,21 +236,19 @@ uint64_t Mem_row::get_uint(uint32_t index) const {
     }
     return std::stoull(dec);
   }
-  return get<uint64_t>(index);
+  return _data->fields[index].value.u;
 }
 
 std::string Mem_row::get_string(uint32_t index) const {
   Type ftype;
   GET_VALIDATE_TYPE(index, (is_string_type(ftype)));
-  return get<std::string>(index);
+  return get_stored_string(index);
 }
 
 std::pair<const char *, size_t> Mem_row::get_string_data(uint32_t index) const {
   Type ftype;
   GET_VALIDATE_TYPE(index, (ftype == Type::String || ftype == Type::Bytes));
-  const auto &s =
-      static_cast<Field_data<std::string> *>(_data->fields[index].get())->value;
-  return {s.data(), s.size()};
+  return string_data(index);
 }
 
 float Mem_row::get_float(uint32_t index) const {
@@ -254,14 +258,14 @@ float Mem_row::get_float(uint32_t index) const {
   switch (ftype) {
     case Type::Decimal:
       try {
-        return std::stof(get<std::string>(index));
+        return std::stof(get_stored_string(index));
       } catch (...) {
         throw FIELD_ERROR(index, "float value out of the allowed range");
       }
     case Type::Double:
-      return static_cast<float>(get<double>(index));
+      return static_cast<float>(_data->fields[index].value.d);
     case Type::Float:
-      return get<float>(index);
+      return _data->fields[index].value.f;
     default:
       throw std::logic_error("internal error");
   }
@@ -274,14 +278,14 @@ double Mem_row::get_double(uint32_t index) const {
   switch (ftype) {
     case Type::Decimal:
       try {
-        return std::stod(get<std::string>(index));
+        return std::stod(get_stored_string(index));
       } catch (std::exception &e) {
         throw FIELD_ERROR(index, "double value out of the allowed range");
       }
     case Type::Float:
-      return static_cast<double>(get<float>(index));
+      return static_cast<double>(_data->fields[index].value.f);
     case Type::Double:
-      return get<double>(index);
+      return _data->fields[index].value.d;
     default:
       throw std::logic_error("internal error");
   }
@@ -290,25 +294,69 @@ double Mem_row::get_double(uint32_t index) const {
 uint64_t Mem_row::get_bit(uint32_t index) const {
   Type ftype;
   GET_VALIDATE_TYPE(index, (ftype == Type::Bit));
-  return shcore::string_to_bits(get<std::string>(index)).first;
+  return shcore::string_to_bits(get_stored_string(index)).first;
 }
 
 bool Mem_row::is_null(uint32_t index) const {
   VALIDATE_INDEX(index);
-  return _data->fields[index] == nullptr;
+  return _data->fields[index].null;
 }
 
 void Mem_row::add_field(Type type, uint32_t offset) {
-  if (offset > _data->types.size())
+  if (offset > _data->types->size())
     throw std::invalid_argument("Attempt to insert column past row size");
 
-  _data->types.insert(_data->types.begin() + offset, type);
-  _data->fields.insert(_data->fields.begin() + offset, nullptr);
+  if (_data->types.use_count() > 1)
+    _data->types = std::make_shared<std::vector<Type>>(*_data->types);
+
+  _data->types->insert(_data->types->begin() + offset, type);
+  _data->fields.insert(_data->fields.begin() + offset, Field());
 }
 
 void Mem_row::add_field(Type type) {
-  _data->types.push_back(type);
-  _data->fields.push_back(nullptr);
+  add_field(type, static_cast<uint32_t>(_data->types->size()));
+}
+
+void Mem_row::set_string(uint32_t index, const char *data, size_t length) {
+  Field &field = _data->fields[index];
+
+  if (length <= field.capacity) {
+    // overwrites the previous value, the remaining bytes stay with the field
+    _data->arena.replace(field.value.u, length, data, length);
+  } else {
+    _data->unused += field.capacity;
+    field.value.u = _data->arena.size();
+    field.capacity = static_cast<uint32_t>(length);
+    _data->arena.append(data, length);
+  }
+
+  field.length = static_cast<uint32_t>(length);
+  field.null = false;
+
+  // rewriting the fields with growing values would otherwise keep growing
+  // the arena
+  if (_data->unused > _data->arena.size() / 2) compact_arena();
+}
+
+void Mem_row::compact_arena() {
+  std::string arena;
+  arena.reserve(_data->arena.size() - _data->unused);
+
+  for (auto &field : _data->fields) {
+    if (field.capacity == 0) continue;
+
+    if (field.null) {
+      field.value.u = 0;
+      field.capacity = 0;
+    } else {
+      arena.append(_data->arena, field.value.u, field.length);
+      field.value.u = arena.size() - field.length;
+      field.capacity = field.length;
+    }
+  }
+
+  _data->arena.swap(arena);
+  _data->unused = 0;
 }
 
 Mutable_row::~Mutable_row() {}
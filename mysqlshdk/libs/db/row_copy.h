@@ -69,33 +69,69 @@ class SHCORE_PUBLIC Mem_row : public IRow {
   void add_field(Type type, uint32_t offset);
 
  protected:
-  class Field_data_ {
-   public:
-    virtual ~Field_data_() {}
+  union Field_value {
+    int64_t i;
+    uint64_t u;
+    float f;
+    double d;
   };
 
-  template <typename T>
-  class Field_data : public Field_data_ {
-   public:
-    explicit Field_data(const T &v) : value(v) {}
-    T value;
-  };
+  /**
+   * Fixed size slot of a field. Numeric values are stored in place, the data
+   * of string-like values is appended to the arena of the row and the slot
+   * keeps its offset and length, as well as the number of bytes it owns in
+   * the arena, which are reused by a later value which fits in them.
+   */
+  struct Field {
+    Field() { value.u = 0; }
 
-  template <typename T>
-  const T &get(int field) const {
-    return static_cast<Field_data<T> *>(_data->fields[field].get())->value;
-  }
+    Field_value value;
+    uint32_t length = 0;
+    uint32_t capacity = 0;
+    bool null = true;
+  };
 
+  /**
+   * Field types are shared by the rows copied from the same result, they are
+   * copied only when a field is added to one of these rows.
+   */
   struct Data {
-    std::vector<Type> types;
-    std::vector<std::unique_ptr<Field_data_>> fields;
+    std::shared_ptr<std::vector<Type>> types;
+    std::vector<Field> fields;
+    std::string arena;
+    // bytes of the arena no longer owned by any field
+    size_t unused = 0;
 
-    Data() {}
+    Data() : types(std::make_shared<std::vector<Type>>()) {}
 
-    explicit Data(const std::vector<Type> &types)
-        : types(types), fields(types.size()) {}
+    explicit Data(const std::vector<Type> &t)
+        : types(std::make_shared<std::vector<Type>>(t)), fields(t.size()) {}
   };
+
+  Type field_type(uint32_t index) const { return (*_data->types)[index]; }
+
+  void set_string(uint32_t index, const char *data, size_t length);
+
+  /**
+   * Moves the data of all the fields to a new arena, dropping the bytes which
+   * are no longer used.
+   */
+  void compact_arena();
+
+  std::pair<const char *, size_t> string_data(uint32_t index) const {
+    const Field &field = _data->fields[index];
+    return {_data->arena.data() + field.value.u, field.length};
+  }
+
+  std::string get_stored_string(uint32_t index) const {
+    const auto data = string_data(index);
+    return std::string(data.first, data.second);
+  }
+
   std::shared_ptr<Data> _data;
+
+ private:
+  friend class Row_copy;
 };
 
 /**
@@ -104,11 +140,18 @@ class SHCORE_PUBLIC Mem_row : public IRow {
  * underlying client library.
  *
  * Can be created from the copy-constructor, from any instance of IRow.
+ * All the fields of a copy are held in a single block of memory.
  */
 class SHCORE_PUBLIC Row_copy : public Mem_row {
  public:
   explicit Row_copy(const IRow &row);
 
+  /**
+   * Copies the row, sharing the field types with the given row of the same
+   * result, if they match.
+   */
+  Row_copy(const IRow &row, const Mem_row &layout);
+
   Row_copy() {}
 
   virtual ~Row_copy() {}
@@ -123,45 +166,47 @@ class SHCORE_PUBLIC Mutable_row : public Mem_row {
   template <class T>
   typename std::enable_if<std::is_integral<T>::value>::type set_field(
       uint32_t index, T &&arg) {
-    if (_data->types[index] == Type::Integer)
-      _data->fields[index] = std::unique_ptr<Field_data_>(
-          new Field_data<int64_t>(std::forward<T>(arg)));
-    else if (_data->types[index] == Type::UInteger)
-      _data->fields[index] = std::unique_ptr<Field_data_>(
-          new Field_data<uint64_t>(std::forward<T>(arg)));
+    Field &field = _data->fields[index];
+    if (field_type(index) == Type::Integer)
+      field.value.i = static_cast<int64_t>(arg);
+    else if (field_type(index) == Type::UInteger)
+      field.value.u = static_cast<uint64_t>(arg);
     else
       throw std::invalid_argument(
           "Attempt to write integer value to non integer field");
+    field.null = false;
   }
 
   template <class T>
   typename std::enable_if<std::is_floating_point<T>::value>::type set_field(
       uint32_t index, T &&arg) {
-    if (_data->types[index] != Type::Float &&
-        _data->types[index] != Type::Double)
+    Field &field = _data->fields[index];
+    if (field_type(index) == Type::Float)
+      field.value.f = static_cast<float>(arg);
+    else if (field_type(index) == Type::Double)
+      field.value.d = static_cast<double>(arg);
+    else
       throw std::invalid_argument(
           "Attempt to write floating point number to not neither float or "
           "double field.");
-    _data->fields[index] =
-        std::unique_ptr<Field_data_>(new Field_data<T>(std::forward<T>(arg)));
+    field.null = false;
   }
 
   template <class T>
   typename std::enable_if<std::is_same<T, std::nullptr_t>::value>::type
   set_field(uint32_t index, T && /*arg*/) {
-    _data->fields[index] = nullptr;
+    _data->fields[index].null = true;
   }
 
   template <class T>
   typename std::enable_if<!std::is_arithmetic<T>::value &&
                           !std::is_same<T, std::nullptr_t>::value>::type
   set_field(uint32_t index, T &&arg) {
-    if (_data->types[index] >= Type::Integer &&
-        _data->types[index] <= Type::Double)
+    if (field_type(index) >= Type::Integer && field_type(index) <= Type::Double)
       throw std::invalid_argument(
           "Attempt to write arithmetic type to non arithmetic field");
-    _data->fields[index] = std::unique_ptr<Field_data_>(
-        new Field_data<std::string>(std::string(std::forward<T>(arg))));
+    const std::string value(std::forward<T>(arg));
+    set_string(index, value.data(), value.size());
   }
 
  private:
@@ -28,10 +28,12 @@
 #define MYSQLSHDK_LIBS_DB_SESSION_H_
 
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/db/result.h"
@@ -68,6 +70,14 @@ class Error : public std::runtime_error {
   std::string sqlstate_;
 };
 
+/**
+ * Receives the result or the error of a pipelined statement, given its index.
+ * The result must be consumed before returning, returning false stops the
+ * execution of the remaining statements.
+ */
+using Pipeline_callback = std::function<bool(
+    size_t index, std::shared_ptr<IResult> result, const Error *error)>;
+
 class SHCORE_PUBLIC ISession {
  public:
   // Connection
@@ -111,6 +121,40 @@ class SHCORE_PUBLIC ISession {
     execute(shcore::sqlformat(sql, args...));
   }
 
+  /**
+   * Executes the given SQL statements, sending them ahead of the results of
+   * the previous ones when the protocol allows it.
+   *
+   * @param sql Statements to be executed, without delimiters.
+   * @param stop_on_error If true, statements following the one which failed
+   *        are not executed.
+   * @param callback Called with the outcome of each statement, in order.
+   *
+   * This default implementation executes the statements one at a time.
+   */
+  virtual void execute_pipelined(const std::vector<std::string> &sql,
+                                 bool stop_on_error,
+                                 const Pipeline_callback &callback) {
+    for (size_t i = 0; i < sql.size(); ++i) {
+      std::shared_ptr<IResult> result;
+
+      try {
+        result = query(sql[i]);
+      } catch (const Error &e) {
+        if (!callback(i, nullptr, &e) || stop_on_error) return;
+        continue;
+      }
+
+      if (!callback(i, result, nullptr)) return;
+    }
+  }
+
+  /**
+   * Called once no more execute_pipelined() calls follow, restores the
+   * session state they kept in between.
+   */
+  virtual void end_pipeline() {}
+
   // Disconnection
   virtual void close() = 0;
 
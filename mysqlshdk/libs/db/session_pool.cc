@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/session_pool.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace mysqlshdk {
+namespace db {
+
+Session_pool::Session_pool(std::chrono::seconds idle_timeout, size_t max_idle)
+    : _idle_timeout(idle_timeout), _max_idle(max_idle) {}
+
+Session_pool::~Session_pool() { clear(); }
+
+std::shared_ptr<Session_pool> Session_pool::get() {
+  static std::shared_ptr<Session_pool> instance =
+      std::make_shared<Session_pool>();
+  return instance;
+}
+
+std::string Session_pool::key(const Connection_options &options) {
+  // password is never a part of the key, it's compared when a session is
+  // picked
+  return options.as_uri(uri::formats::full_no_password());
+}
+
+bool Session_pool::same_credentials(const Connection_options &a,
+                                    const Connection_options &b) {
+  if (a.has_password() != b.has_password()) return false;
+  return !a.has_password() || a.get_password() == b.get_password();
+}
+
+bool Session_pool::is_alive(ISession *session) {
+  if (!session->is_open()) return false;
+
+  try {
+    session->execute("DO 1");
+    return true;
+  } catch (const std::exception &) {
+    return false;
+  }
+}
+
+std::shared_ptr<ISession> Session_pool::acquire(
+    const Connection_options &options, const Factory &factory) {
+  const std::string k = key(options);
+  std::shared_ptr<ISession> session;
+  // sessions to be discarded are closed outside of the lock
+  std::vector<std::shared_ptr<ISession>> stale;
+
+  while (!session) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      purge_idle(Clock::now());
+
+      auto it = _idle.find(k);
+      if (it == _idle.end()) break;
+
+      auto &sessions = it->second;
+      // most recently used session first, it's the most likely to be alive
+      auto idle = std::find_if(sessions.rbegin(), sessions.rend(),
+                               [&options](const Idle_session &s) {
+                                 return same_credentials(s.options, options);
+                               });
+      if (idle == sessions.rend()) break;
+
+      session = std::move(idle->session);
+      sessions.erase(std::next(idle).base());
+      if (sessions.empty()) _idle.erase(it);
+    }
+
+    if (!is_alive(session.get())) {
+      stale.emplace_back(std::move(session));
+      session.reset();
+    }
+  }
+
+  for (const auto &s : stale) {
+    if (s->is_open()) s->close();
+  }
+
+  if (!session) session = factory(options);
+
+  // the session is handed back to the pool once the caller is done with it,
+  // keyed by the requested options, the session may hold additional defaults
+  std::weak_ptr<Session_pool> weak_pool = shared_from_this();
+
+  return std::shared_ptr<ISession>(
+      session.get(), [weak_pool, session, k, options](ISession *) {
+        if (auto pool = weak_pool.lock()) pool->release(k, options, session);
+      });
+}
+
+void Session_pool::release(const std::string &key,
+                           const Connection_options &options,
+                           std::shared_ptr<ISession> session) {
+  if (!session->is_open()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // expired sessions are also closed here, so they are not kept open until
+    // the next acquire()
+    purge_idle(Clock::now());
+
+    auto &sessions = _idle[key];
+
+    if (sessions.size() < _max_idle) {
+      sessions.push_back({std::move(session), options, Clock::now()});
+      return;
+    }
+  }
+
+  session->close();
+}
+
+void Session_pool::purge_idle() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  purge_idle(Clock::now());
+}
+
+void Session_pool::purge_idle(Clock::time_point now) {
+  for (auto it = _idle.begin(); it != _idle.end();) {
+    auto &sessions = it->second;
+
+    // sessions are stored in the order they were released
+    while (!sessions.empty() &&
+           now - sessions.front().since >= _idle_timeout) {
+      sessions.front().session->close();
+      sessions.pop_front();
+    }
+
+    if (sessions.empty())
+      it = _idle.erase(it);
+    else
+      ++it;
+  }
+}
+
+void Session_pool::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (auto &entry : _idle) {
+    for (auto &idle : entry.second) idle.session->close();
+  }
+
+  _idle.clear();
+}
+
+size_t Session_pool::idle_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  size_t count = 0;
+
+  for (const auto &entry : _idle) count += entry.second.size();
+
+  return count;
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_SESSION_POOL_H_
+#define MYSQLSHDK_LIBS_DB_SESSION_POOL_H_
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "mysqlshdk/include/mysqlshdk_export.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Keeps idle sessions around so they can be reused by subsequent operations
+ * on the same server, saving the cost of the connection handshake.
+ *
+ * Sessions are keyed by the target endpoint and user, an idle session is only
+ * reused if it was opened with the same password. A session returned by
+ * acquire() is handed back to the pool once the last reference to it is
+ * released, unless it was closed by the caller.
+ * Callers must not leave any session level state (i.e. session variables or
+ * open transactions) behind, as the same session may be given to another
+ * caller later.
+ */
+class SHCORE_PUBLIC Session_pool
+    : public std::enable_shared_from_this<Session_pool> {
+ public:
+  using Factory = std::function<std::shared_ptr<ISession>(
+      const Connection_options &options)>;
+
+  /**
+   * @param idle_timeout idle sessions older than this are closed instead of
+   *        being reused, they are checked every time a session is acquired or
+   *        handed back.
+   * @param max_idle maximum number of idle sessions kept per key.
+   */
+  explicit Session_pool(
+      std::chrono::seconds idle_timeout = std::chrono::seconds(60),
+      size_t max_idle = 4);
+  Session_pool(const Session_pool &) = delete;
+  Session_pool &operator=(const Session_pool &) = delete;
+  ~Session_pool();
+
+  /**
+   * Provides the shared instance of the pool.
+   */
+  static std::shared_ptr<Session_pool> get();
+
+  /**
+   * Returns an open session to the server specified by the given options.
+   *
+   * An idle session is reused if it is still alive, otherwise a new one is
+   * created using the factory.
+   */
+  std::shared_ptr<ISession> acquire(const Connection_options &options,
+                                    const Factory &factory);
+
+  /**
+   * Closes all the idle sessions which exceeded the idle timeout.
+   */
+  void purge_idle();
+
+  /**
+   * Closes all the idle sessions.
+   */
+  void clear();
+
+  size_t idle_count() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Idle_session {
+    std::shared_ptr<ISession> session;
+    // options requested when the session was acquired
+    Connection_options options;
+    Clock::time_point since;
+  };
+
+  static std::string key(const Connection_options &options);
+  static bool same_credentials(const Connection_options &a,
+                               const Connection_options &b);
+  static bool is_alive(ISession *session);
+
+  void release(const std::string &key, const Connection_options &options,
+               std::shared_ptr<ISession> session);
+  void purge_idle(Clock::time_point now);
+
+  const std::chrono::seconds _idle_timeout;
+  const size_t _max_idle;
+
+  mutable std::mutex _mutex;
+  std::map<std::string, std::list<Idle_session>> _idle;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_SESSION_POOL_H_
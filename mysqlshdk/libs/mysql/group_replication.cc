@@ -21,12 +21,15 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <limits>
 #include <memory>
 #include <random>
 #include <set>
+#include <utility>
+#include <vector>
 
 #ifdef WIN32
 #include <windows.h>
@@ -593,14 +596,20 @@ void start_group_replication(const mysqlshdk::mysql::IInstance &instance,
                         mysqlshdk::mysql::Var_qualifier::GLOBAL);
     // Wait for SUPER READ ONLY to be OFF.
     // Required for MySQL versions < 5.7.20.
-    mysqlshdk::utils::nullable<bool> read_only = instance.get_sysvar_bool(
-        "super_read_only", mysqlshdk::mysql::Var_qualifier::GLOBAL);
+    // The snapshot is refreshed on each read, a value taken by the caller
+    // before GR was started would never change.
+    const auto read_super_read_only = [&instance]() {
+      instance.snapshot_sysvars({"super_read_only"},
+                                mysqlshdk::mysql::Var_qualifier::GLOBAL);
+      return instance.get_sysvar_bool("super_read_only",
+                                      mysqlshdk::mysql::Var_qualifier::GLOBAL);
+    };
+    mysqlshdk::utils::nullable<bool> read_only = read_super_read_only();
     uint16_t waiting_time = 0;
     while (*read_only && waiting_time < read_only_timeout) {
       shcore::sleep_ms(1000);
       waiting_time += 1;
-      read_only = instance.get_sysvar_bool(
-          "super_read_only", mysqlshdk::mysql::Var_qualifier::GLOBAL);
+      read_only = read_super_read_only();
     }
     // Throw an error is SUPPER READ ONLY is ON.
     if (*read_only) throw std::runtime_error(kErrorReadOnlyTimeout);
@@ -769,14 +778,54 @@ std::map<std::string, std::string> check_data_compliance(
  *
  * @return A map containing the result of the check operation including
  *         the details about the server variables that do not meet the needed
- *         requirements to use GR.
+ *         requirements to use GR, each one mapped to its current value
+ *         ("<not set>" if the variable does not exist).
  */
 std::map<std::string, std::string> check_server_variables(
-    const mysqlshdk::mysql::IInstance & /*instance*/) {
-  // TODO(pjesus)
-  // NOTE: Review the type of object to return.
-  assert(0);
-  return {};
+    const mysqlshdk::mysql::IInstance &instance) {
+  // accepted values of each of the required variables
+  static const std::vector<
+      std::pair<std::string, std::vector<std::string>>>
+      k_required_values = {
+          {"log_bin", {"ON", "1"}},
+          {"binlog_format", {"ROW"}},
+          {"binlog_checksum", {"NONE"}},
+          {"gtid_mode", {"ON"}},
+          {"log_slave_updates", {"ON", "1"}},
+          {"enforce_gtid_consistency", {"ON", "1"}},
+          {"master_info_repository", {"TABLE"}},
+          {"relay_log_info_repository", {"TABLE"}},
+          {"transaction_write_set_extraction",
+           {"XXHASH64", "2", "MURMUR32", "1"}}};
+
+  std::vector<std::string> names;
+  for (const auto &required : k_required_values) {
+    names.emplace_back(required.first);
+  }
+
+  // read all the variables in a single query
+  instance.snapshot_sysvars(names, mysqlshdk::mysql::Var_qualifier::GLOBAL);
+  shcore::on_leave_scope clear_snapshot(
+      [&instance]() { instance.clear_sysvar_snapshot(); });
+
+  std::map<std::string, std::string> result;
+
+  for (const auto &required : k_required_values) {
+    const auto value = instance.get_sysvar_string(
+        required.first, mysqlshdk::mysql::Var_qualifier::GLOBAL);
+    const auto &accepted = required.second;
+
+    if (value.is_null()) {
+      result[required.first] = "<not set>";
+    } else if (std::find_if(accepted.begin(), accepted.end(),
+                            [&value](const std::string &v) {
+                              return shcore::str_caseeq(v, *value);
+                            }) == accepted.end()) {
+      result[required.first] = *value;
+    }
+  }
+
+  return result;
 }
 
 bool is_group_replication_delayed_starting(
@@ -26,6 +26,8 @@
 #include <map>
 #include <utility>
 
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/session_pool.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -39,6 +41,18 @@ namespace mysql {
 
 Instance::Instance(std::shared_ptr<db::ISession> session) : _session(session) {}
 
+std::unique_ptr<Instance> Instance::connect_pooled(
+    const db::Connection_options &connection_options) {
+  auto session = db::Session_pool::get()->acquire(
+      connection_options, [](const db::Connection_options &options) {
+        auto session = db::mysql::Session::create();
+        session->connect(options);
+        return std::static_pointer_cast<db::ISession>(session);
+      });
+
+  return std::unique_ptr<Instance>(new Instance(session));
+}
+
 std::string Instance::descr() const {
   return _session->get_connection_options().as_uri(
       db::uri::formats::only_transport());
@@ -85,15 +99,64 @@ utils::nullable<bool> Instance::get_cached_global_sysvar_as_bool(
   return {};
 }
 
+/**
+ * Reads the given system variables using a single query and keeps their
+ * values, which are then returned by the get_sysvar_*() functions called with
+ * the same scope, instead of querying the server again.
+ *
+ * Values are kept until clear_sysvar_snapshot() is called, setting a variable
+ * using this instance discards its value. Changes done by other means (i.e.
+ * by other sessions or as a side effect of a statement) are not detected, the
+ * snapshot should only cover the duration of a single operation.
+ *
+ * @param names vector with the names of the variables to read, all variables
+ *              are read if empty.
+ * @param scope Var_qualifier with the scope of the variables, only GLOBAL and
+ *              SESSION are supported.
+ */
+void Instance::snapshot_sysvars(const std::vector<std::string> &names,
+                                const Var_qualifier scope) const {
+  auto variables = get_system_variables(names, scope);
+  auto &snapshot = Var_qualifier::GLOBAL == scope ? _global_sysvar_snapshot
+                                                  : _session_sysvar_snapshot;
+
+  for (auto &variable : variables) {
+    snapshot[variable.first] = std::move(variable.second);
+  }
+}
+
+void Instance::clear_sysvar_snapshot() const {
+  _global_sysvar_snapshot.clear();
+  _session_sysvar_snapshot.clear();
+}
+
+utils::nullable<std::string> Instance::get_sysvar(
+    const std::string &name, const Var_qualifier scope) const {
+  const auto &snapshot = Var_qualifier::GLOBAL == scope
+                             ? _global_sysvar_snapshot
+                             : _session_sysvar_snapshot;
+  const auto it = snapshot.find(name);
+
+  if (snapshot.end() != it) {
+    return it->second;
+  }
+
+  return get_system_variables({name}, scope)[name];
+}
+
+void Instance::invalidate_sysvar(const std::string &name) const {
+  _global_sysvar_snapshot.erase(name);
+  _session_sysvar_snapshot.erase(name);
+}
+
 utils::nullable<bool> Instance::get_sysvar_bool(
     const std::string &name, const Var_qualifier scope) const {
   utils::nullable<bool> ret_val;
 
-  std::map<std::string, utils::nullable<std::string>> variables =
-      get_system_variables({name}, scope);
+  const auto value = get_sysvar(name, scope);
 
-  if (variables[name]) {
-    ret_val = sysvar_to_bool(name, variables[name]);
+  if (value) {
+    ret_val = sysvar_to_bool(name, *value);
   }
 
   return ret_val;
@@ -101,17 +164,17 @@ utils::nullable<bool> Instance::get_sysvar_bool(
 
 utils::nullable<std::string> Instance::get_sysvar_string(
     const std::string &name, const Var_qualifier scope) const {
-  return get_system_variables({name}, scope)[name];
+  return get_sysvar(name, scope);
 }
 
 utils::nullable<int64_t> Instance::get_sysvar_int(
     const std::string &name, const Var_qualifier scope) const {
   utils::nullable<int64_t> ret_val;
 
-  auto variables = get_system_variables({name}, scope);
+  const auto variable = get_sysvar(name, scope);
 
-  if (variables[name]) {
-    std::string value = variables[name];
+  if (variable) {
+    std::string value = *variable;
 
     if (!value.empty()) {
       size_t end_pos;
@@ -152,6 +215,7 @@ void Instance::set_sysvar(const std::string &name, const std::string &value,
   set_stmt << value;
   set_stmt.done();
   _session->execute(set_stmt);
+  invalidate_sysvar(name);
 }
 
 /**
@@ -176,6 +240,7 @@ void Instance::set_sysvar_default(const std::string &name,
   set_stmt << name;
   set_stmt.done();
   _session->execute(set_stmt);
+  invalidate_sysvar(name);
 }
 
 /**
@@ -202,6 +267,7 @@ void Instance::set_sysvar(const std::string &name, const int64_t value,
   set_stmt << value;
   set_stmt.done();
   _session->execute(set_stmt);
+  invalidate_sysvar(name);
 }
 
 /**
@@ -229,6 +295,7 @@ void Instance::set_sysvar(const std::string &name, const bool value,
   set_stmt << str_value;
   set_stmt.done();
   _session->execute(set_stmt);
+  invalidate_sysvar(name);
 }
 
 std::map<std::string, utils::nullable<std::string>>
@@ -65,6 +65,11 @@ class IInstance {
   virtual utils::nullable<bool> get_cached_global_sysvar_as_bool(
       const std::string &name) const = 0;
 
+  virtual void snapshot_sysvars(
+      const std::vector<std::string> &names,
+      const Var_qualifier scope = Var_qualifier::SESSION) const = 0;
+  virtual void clear_sysvar_snapshot() const = 0;
+
   virtual utils::nullable<bool> get_sysvar_bool(
       const std::string &name,
       const Var_qualifier scope = Var_qualifier::SESSION) const = 0;
@@ -119,6 +124,15 @@ class Instance : public IInstance {
  public:
   explicit Instance(std::shared_ptr<db::ISession> session);
 
+  /**
+   * Connects to the instance using a classic session from the shared session
+   * pool, an idle session to the same server is reused if possible. The
+   * session is handed back to the pool once it's no longer referenced,
+   * unless close_session() was called.
+   */
+  static std::unique_ptr<Instance> connect_pooled(
+      const db::Connection_options &connection_options);
+
   std::string descr() const override;
 
   void cache_global_sysvars(bool force_refresh = false) override;
@@ -127,6 +141,11 @@ class Instance : public IInstance {
   utils::nullable<bool> get_cached_global_sysvar_as_bool(
       const std::string &name) const override;
 
+  void snapshot_sysvars(
+      const std::vector<std::string> &names,
+      const Var_qualifier scope = Var_qualifier::SESSION) const override;
+  void clear_sysvar_snapshot() const override;
+
   utils::nullable<bool> get_sysvar_bool(
       const std::string &name,
       const Var_qualifier scope = Var_qualifier::SESSION) const override;
@@ -181,9 +200,17 @@ class Instance : public IInstance {
                    const std::string &hostname) const override;
 
  private:
+  utils::nullable<std::string> get_sysvar(const std::string &name,
+                                          const Var_qualifier scope) const;
+  void invalidate_sysvar(const std::string &name) const;
+
   std::shared_ptr<db::ISession> _session;
   mutable mysqlshdk::utils::Version _version;
   std::map<std::string, utils::nullable<std::string>> _global_sysvars;
+  mutable std::map<std::string, utils::nullable<std::string>>
+      _global_sysvar_snapshot;
+  mutable std::map<std::string, utils::nullable<std::string>>
+      _session_sysvar_snapshot;
 };
 
 }  // namespace mysql
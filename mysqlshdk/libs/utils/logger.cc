@@ -35,7 +35,13 @@
 #endif  // !_WIN32
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -88,6 +94,183 @@ Logger_levels_table g_level_converter;
 
 }  // namespace
 
+/**
+ * Writes log entries to the log file from a background thread.
+ *
+ * Entries are kept in a bounded ring of pre-allocated slots, producers claim
+ * a slot with a single CAS, so any number of threads may log concurrently
+ * while there is only one consumer: the writer thread. When the ring is full,
+ * producers wait for the writer instead of dropping entries.
+ *
+ * Slots have a fixed size, entries are copied in place. Only messages which
+ * do not fit into a slot are stored in its overflow string, which keeps its
+ * capacity once it is allocated.
+ */
+class Logger::Async_writer final {
+ public:
+  Async_writer(std::ofstream *file, std::mutex *file_mutex)
+      : m_slots(new Slot[k_capacity]), m_file(file), m_file_mutex(file_mutex) {
+    for (size_t i = 0; i < k_capacity; ++i) {
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_thread = std::thread(&Async_writer::run, this);
+  }
+
+  Async_writer(const Async_writer &) = delete;
+  Async_writer(Async_writer &&) = delete;
+
+  Async_writer &operator=(const Async_writer &) = delete;
+  Async_writer &operator=(Async_writer &&) = delete;
+
+  /**
+   * Writes the pending entries, caller has to make sure that no thread is
+   * pushing an entry at this point, otherwise it could be lost.
+   */
+  ~Async_writer() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+
+    m_wakeup.notify_one();
+    m_thread.join();
+  }
+
+  void push(const Log_entry &entry) {
+    auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+
+    while (true) {
+      slot = &m_slots[pos & k_mask];
+      const auto sequence = slot->sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+      if (0 == diff) {
+        if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // ring is full, let the writer catch up
+        m_wakeup.notify_one();
+        std::this_thread::yield();
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      } else {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->timestamp = entry.timestamp;
+    slot->level = entry.level;
+    slot->has_domain = nullptr != entry.domain;
+    // domains are short identifiers, longer ones are truncated
+    if (slot->has_domain) copy_truncated(entry.domain, slot->domain);
+
+    const auto length = strlen(entry.message);
+
+    if (length < sizeof(slot->message)) {
+      memcpy(slot->message, entry.message, length + 1);
+      slot->overflow = false;
+    } else {
+      slot->long_message.assign(entry.message, length);
+      slot->overflow = true;
+    }
+
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    // wake up the writer once half of the ring is used
+    if (0 == ((pos + 1) & (k_capacity / 2 - 1))) m_wakeup.notify_one();
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    time_t timestamp;
+    LOG_LEVEL level;
+    bool has_domain;
+    bool overflow;
+    char domain[32];
+    char message[224];
+    std::string long_message;
+  };
+
+  // must be a power of two
+  static constexpr size_t k_capacity = 1024;
+  static constexpr size_t k_mask = k_capacity - 1;
+
+  // pending entries are written at least this often
+  static constexpr std::chrono::milliseconds k_write_interval{100};
+
+  template <size_t N>
+  static void copy_truncated(const char *source, char (&target)[N]) {
+    strncpy(target, source, N - 1);
+    target[N - 1] = '\0';
+  }
+
+  bool has_pending() const {
+    return m_slots[m_dequeue_pos & k_mask].sequence.load(
+               std::memory_order_acquire) == m_dequeue_pos + 1;
+  }
+
+  void write_pending() {
+    m_buffer.clear();
+
+    while (has_pending()) {
+      auto &slot = m_slots[m_dequeue_pos & k_mask];
+
+      Log_entry entry{slot.has_domain ? slot.domain : nullptr,
+                      slot.overflow ? slot.long_message.c_str() : slot.message,
+                      slot.level};
+      entry.timestamp = slot.timestamp;
+      m_buffer += format_message(entry);
+
+      slot.sequence.store(m_dequeue_pos + k_capacity,
+                          std::memory_order_release);
+      ++m_dequeue_pos;
+    }
+
+    if (!m_buffer.empty()) {
+      std::lock_guard<std::mutex> lock(*m_file_mutex);
+
+      if (m_file->is_open()) {
+        m_file->write(m_buffer.c_str(), m_buffer.length());
+        m_file->flush();
+      }
+    }
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_stop) {
+      m_wakeup.wait_for(lock, k_write_interval);
+
+      lock.unlock();
+      write_pending();
+      lock.lock();
+    }
+
+    // drain entries which were queued before the writer was stopped
+    write_pending();
+  }
+
+  std::unique_ptr<Slot[]> m_slots;
+  std::atomic<size_t> m_enqueue_pos{0};
+  size_t m_dequeue_pos = 0;
+  std::string m_buffer;
+
+  std::ofstream *m_file;
+  std::mutex *m_file_mutex;
+  bool m_stop = false;
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::thread m_thread;
+};
+
+constexpr std::chrono::milliseconds Logger::Async_writer::k_write_interval;
+
 std::unique_ptr<Logger> Logger::s_instance;
 std::string Logger::s_output_format;
 
@@ -123,6 +306,27 @@ void Logger::set_log_level(LOG_LEVEL log_level) {
 
 Logger::LOG_LEVEL Logger::get_log_level() { return m_log_level; }
 
+void Logger::set_async(bool async) {
+  if (async == is_async()) return;
+
+  if (async) {
+    std::atomic_store(&m_async_writer,
+                      std::make_shared<Async_writer>(&m_log_file,
+                                                     &m_log_file_mutex));
+  } else {
+    auto writer = std::atomic_exchange(&m_async_writer,
+                                       std::shared_ptr<Async_writer>());
+
+    // threads which got the writer before it was replaced hold a reference
+    // until their entry is pushed, new ones write synchronously, possibly
+    // before the entries which are still queued
+    while (writer.use_count() > 1) std::this_thread::yield();
+
+    // writer drains the queued entries before it is destroyed
+    writer.reset();
+  }
+}
+
 void Logger::assert_logger_initialized() {
   if (s_instance.get() == nullptr) {
     static constexpr auto msg_noinit =
@@ -146,15 +350,18 @@ std::string Logger::format(const char *formats, ...) {
 }
 
 std::string Logger::format(const char *formats, va_list args) {
+  // most messages fit in this buffer, they are formatted only once
+  char buffer[1024];
+
   va_list args_copy;
   va_copy(args_copy, args);
-#ifdef _WIN32
-  int n = _vscprintf(formats, args_copy);
-#else   // !_WIN32
-  size_t n = (size_t)vsnprintf(nullptr, 0, formats, args_copy);
-#endif  // !_WIN32
+  const int n = vsnprintf(buffer, sizeof(buffer), formats, args_copy);
   va_end(args_copy);
 
+  if (n < 0) return {};
+
+  if (static_cast<size_t>(n) < sizeof(buffer)) return std::string(buffer, n);
+
   std::string mybuf;
   mybuf.resize(n + 1);
 
@@ -162,6 +369,8 @@ std::string Logger::format(const char *formats, va_list args) {
   vsnprintf(&mybuf[0], n + 1, formats, args_copy);
   va_end(args_copy);
 
+  mybuf.resize(n);
+
   return mybuf;
 }
 
@@ -195,9 +404,12 @@ void Logger::log(const std::exception &exc, const char *domain,
 }
 
 void Logger::do_log(const Log_entry &entry) {
-  const auto s = format_message(entry);
-
-  if (s_instance->m_log_file.is_open()) {
+  if (const auto writer = std::atomic_load(&s_instance->m_async_writer)) {
+    writer->push(entry);
+  } else if (s_instance->m_log_file.is_open()) {
+    const auto s = format_message(entry);
+    // writer of the asynchronous mode may still be draining its entries
+    std::lock_guard<std::mutex> lock(s_instance->m_log_file_mutex);
     s_instance->m_log_file.write(s.c_str(), s.length());
     s_instance->m_log_file.flush();
   }
@@ -300,6 +512,10 @@ std::string Logger::format_message(const Log_entry &entry) {
 void Logger::setup_instance(const char *filename, bool use_stderr,
                             Logger::LOG_LEVEL log_level) {
   if (s_instance) {
+    // log file cannot change while it is being written
+    const bool async = s_instance->is_async();
+    s_instance->set_async(false);
+
     if (filename) {
       if (filename != s_instance->m_log_file_name) {
         if (s_instance->m_log_file.is_open()) s_instance->m_log_file.close();
@@ -322,6 +538,8 @@ void Logger::setup_instance(const char *filename, bool use_stderr,
     if (use_stderr) {
       s_instance->attach_log_hook(&Logger::out_to_stderr);
     }
+
+    s_instance->set_async(async);
   } else {
     s_instance.reset(new Logger(filename, use_stderr, log_level));
   }
@@ -345,6 +563,8 @@ Logger::Logger(const char *filename, bool use_stderr,
 }
 
 Logger::~Logger() {
+  set_async(false);
+
   if (m_log_file.is_open()) m_log_file.close();
 }
 
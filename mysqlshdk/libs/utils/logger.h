@@ -28,6 +28,7 @@
 #include <fstream>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -84,6 +85,17 @@ class SHCORE_PUBLIC Logger final {
   void set_log_level(LOG_LEVEL log_level);
   LOG_LEVEL get_log_level();
 
+  /**
+   * Enables or disables writing the log file from a background thread.
+   *
+   * In asynchronous mode entries are queued and written in batches, pending
+   * entries are written before this call returns when it is disabled.
+   */
+  void set_async(bool async);
+  bool is_async() const {
+    return std::atomic_load(&m_async_writer) != nullptr;
+  }
+
 #if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ > 4)
   static void log(LOG_LEVEL level, const char *domain, const char *format, ...)
       __attribute__((__format__(__printf__, 3, 4)));
@@ -147,13 +159,18 @@ class SHCORE_PUBLIC Logger final {
 
   static void do_log(const Log_entry &entry);
 
+  class Async_writer;
+
   static std::unique_ptr<Logger> s_instance;
   static std::string s_output_format;
 
   LOG_LEVEL m_log_level;
   std::ofstream m_log_file;
+  std::mutex m_log_file_mutex;
   std::string m_log_file_name;
   std::list<Log_hook> m_hook_list;
+  // replaced atomically, threads which log hold a reference while they push
+  std::shared_ptr<Async_writer> m_async_writer;
 };
 
 #define log_internal_error(...)                                           \
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_LRU_CACHE_H_
+#define MYSQLSHDK_LIBS_UTILS_LRU_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace mysqlshdk {
+namespace utils {
+
+/**
+ * Bounded map which evicts the least recently used entry once it's full.
+ *
+ * Counts the hits and misses of find(), the class is not thread safe.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class Lru_cache {
+ public:
+  explicit Lru_cache(size_t capacity) : m_capacity(capacity) {}
+
+  /**
+   * Returns the value stored for the given key and marks it as the most
+   * recently used one, or nullptr if the key is not in the cache.
+   *
+   * The pointer is valid until the cache is modified.
+   */
+  const Value *find(const Key &key) {
+    const auto it = m_index.find(key);
+
+    if (m_index.end() == it) {
+      ++m_misses;
+      return nullptr;
+    }
+
+    ++m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return &it->second->second;
+  }
+
+  /**
+   * Stores the value as the most recently used one, replacing the one stored
+   * for the same key.
+   */
+  void put(const Key &key, Value value) {
+    if (0 == m_capacity) return;
+
+    const auto it = m_index.find(key);
+
+    if (m_index.end() != it) {
+      it->second->second = std::move(value);
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+    } else {
+      m_entries.emplace_front(key, std::move(value));
+      m_index.emplace(key, m_entries.begin());
+      evict();
+    }
+  }
+
+  void set_capacity(size_t capacity) {
+    m_capacity = capacity;
+    evict();
+  }
+
+  size_t capacity() const { return m_capacity; }
+
+  size_t size() const { return m_entries.size(); }
+
+  uint64_t hits() const { return m_hits; }
+
+  uint64_t misses() const { return m_misses; }
+
+  /**
+   * Removes all the entries, counters are kept.
+   */
+  void clear() {
+    m_index.clear();
+    m_entries.clear();
+  }
+
+ private:
+  using Entries = std::list<std::pair<Key, Value>>;
+
+  void evict() {
+    while (m_entries.size() > m_capacity) {
+      m_index.erase(m_entries.back().first);
+      m_entries.pop_back();
+    }
+  }
+
+  size_t m_capacity;
+  Entries m_entries;
+  std::unordered_map<Key, typename Entries::iterator, Hash> m_index;
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+};
+
+}  // namespace utils
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_LRU_CACHE_H_
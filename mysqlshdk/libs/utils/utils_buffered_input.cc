@@ -29,15 +29,20 @@
 #ifdef _WIN32
 #include <io.h>
 #else
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
-#include <deque>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <limits>
 #include <string>
 
 namespace shcore {
 
-void Buffered_input::open(const std::string &filepath_) {
+void Buffered_input::open(const std::string &filepath_, bool use_mmap) {
   close();
 #ifdef _WIN32
   m_fd = ::_open(filepath_.c_str(), O_RDONLY);
@@ -49,15 +54,45 @@ void Buffered_input::open(const std::string &filepath_) {
     throw std::runtime_error(filepath_ + ": " + errno_to_string(err) +
                              " (error code " + std::to_string(err) + ")");
   }
+
+#ifndef _WIN32
+  struct stat st;
+  if (use_mmap && ::fstat(m_fd, &st) == 0 && S_ISREG(st.st_mode) &&
+      st.st_size > 0 &&
+      static_cast<uint64_t>(st.st_size) <=
+          std::numeric_limits<size_t>::max()) {
+    const size_t size = static_cast<size_t>(st.st_size);
+    void *map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    // if file cannot be mapped, fall back to regular reads
+    if (map != MAP_FAILED) {
+      ::madvise(map, size, MADV_SEQUENTIAL);
+      m_map = map;
+      m_map_size = size;
+      m_pos = static_cast<byte *>(map);
+      m_end = m_pos + size;
+    }
+  }
+#else
+  (void)use_mmap;
+#endif
 }
 
 void Buffered_input::close() {
+#ifndef _WIN32
+  if (m_map) {
+    ::munmap(m_map, m_map_size);
+    m_map = nullptr;
+    m_map_size = 0;
+    m_pos = m_end = m_buffer;
+  }
+#endif
   if (m_fd > 0) {
 #ifdef _WIN32
     ::_close(m_fd);
 #else
     ::close(m_fd);
 #endif
+    m_fd = 0;
   }
 }
 
@@ -89,6 +124,15 @@ void Buffered_input::fill_buffer() {
     return;
   }
 
+  if (m_map) {
+    // whole file is already available, mapping is read only so terminate
+    // input using internal buffer
+    m_pos = m_end = m_buffer;
+    m_eof = true;
+    *m_pos = '\0';
+    return;
+  }
+
   m_pos = m_buffer;
 #ifdef _WIN32
   int bytes = ::_read(m_fd, m_buffer, BUFFER_SIZE);
@@ -108,8 +152,157 @@ void Buffered_input::fill_buffer() {
   }
 }
 
-std::string span_one_maybe_json(shcore::Buffered_input *input) {
-  std::deque<char> context;
+namespace {
+
+#if defined(__SSE2__)
+/**
+ * Returns pointer to the first byte in [p, end) equal to any of `N` given
+ * characters, or `end` if there is no such byte. Compares 16 bytes at a time.
+ */
+template <size_t N>
+inline const char *find_first_of(const char *p, const char *end,
+                                 const char (&chars)[N]) {
+  __m128i needles[N];
+  for (size_t i = 0; i < N; ++i) needles[i] = _mm_set1_epi8(chars[i]);
+
+  while (end - p >= 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i match = _mm_cmpeq_epi8(block, needles[0]);
+    for (size_t i = 1; i < N; ++i)
+      match = _mm_or_si128(match, _mm_cmpeq_epi8(block, needles[i]));
+    const int mask = _mm_movemask_epi8(match);
+    if (mask != 0) return p + __builtin_ctz(mask);
+    p += 16;
+  }
+
+  for (; p < end; ++p) {
+    for (size_t i = 0; i < N; ++i)
+      if (*p == chars[i]) return p;
+  }
+  return end;
+}
+#else
+template <size_t N>
+inline const char *find_first_of(const char *p, const char *end,
+                                 const char (&chars)[N]) {
+  for (; p < end; ++p) {
+    for (size_t i = 0; i < N; ++i)
+      if (*p == chars[i]) return p;
+  }
+  return end;
+}
+#endif
+
+constexpr const char k_structural_chars[] = {'{', '}', '[', ']', '"', '\0'};
+constexpr const char k_string_chars[] = {'"', '\\'};
+
+/**
+ * Incremental scanner finding the end of JSON document, used to split input
+ * into documents without copying it byte by byte. Performs the same minimal
+ * validation as span_one_maybe_json() always did.
+ */
+class Json_span_scanner {
+ public:
+  /**
+   * Scan [begin, end) range, which must start right after previously scanned
+   * range.
+   *
+   * @param begin Start of the range.
+   * @param end End of the range.
+   * @param offset Offset of `begin` from the input start, used in errors.
+   * @return Number of bytes which belong to the document.
+   */
+  size_t scan(const char *begin, const char *end, size_t offset) {
+    const char *p = begin;
+
+    while (p < end) {
+      if (m_in_string) {
+        if (m_escape) {
+          m_escape = false;
+          ++p;
+          continue;
+        }
+
+        p = find_first_of(p, end, k_string_chars);
+        if (p == end) break;
+
+        if (*p == '\\')
+          m_escape = true;
+        else
+          m_in_string = false;
+        ++p;
+      } else {
+        p = find_first_of(p, end, k_structural_chars);
+        if (p == end) break;
+
+        switch (*p) {
+          case '\0':
+            // end of input before end of document
+            throw invalid_json("Premature end of input stream",
+                               offset + (p - begin));
+
+          case '{':
+          case '[':
+            m_context.push_back(*p);
+            break;
+
+          case '}':
+            if (m_context.empty() || m_context.back() != '{') {
+              throw invalid_json("Unexpected '}' in input",
+                                 offset + (p - begin));
+            }
+            m_context.pop_back();
+            break;
+
+          case ']':
+            if (m_context.empty() || m_context.back() != '[') {
+              throw invalid_json("Unexpected ']' in input",
+                                 offset + (p - begin));
+            }
+            m_context.pop_back();
+            break;
+
+          case '"':
+            m_in_string = true;
+            break;
+        }
+
+        ++p;
+
+        if (m_context.empty()) {
+          m_done = true;
+          break;
+        }
+      }
+    }
+
+    return p - begin;
+  }
+
+  bool done() const { return m_done; }
+
+  bool in_string() const { return m_in_string; }
+
+ private:
+  std::string m_context;
+  bool m_in_string = false;
+  bool m_escape = false;
+  bool m_done = false;
+};
+
+[[noreturn]] void throw_premature_end(const Json_span_scanner &scanner,
+                                      shcore::Buffered_input *input) {
+  if (scanner.in_string()) {
+    throw std::out_of_range("Incomplete quoted string");
+  }
+  throw invalid_json("Premature end of input stream", input->offset());
+}
+
+}  // namespace
+
+Input_span span_one_maybe_json(shcore::Buffered_input *input,
+                               std::string *buffer) {
   input->skip_whitespaces();
 
   if (input->eof()) return {};
@@ -119,56 +312,47 @@ std::string span_one_maybe_json(shcore::Buffered_input *input) {
                        input->offset());
   }
 
-  std::string s;
-  s += input->get(); /* { */
-  context.emplace_back('{');
-
-  while (!context.empty()) {
-    switch (input->peek()) {
-      case '\0':
-        // end of input before end of document
-        throw invalid_json("Premature end of input stream", input->offset());
-        // return s;
-
-      case '{':
-        context.emplace_back('{');
-        s += input->get();
-        break;
+  Json_span_scanner scanner;
 
-      case '[':
-        context.emplace_back('[');
-        s += input->get();
-        break;
+  if (input->is_mapped()) {
+    const char *begin = input->data();
+    const size_t size =
+        scanner.scan(begin, begin + input->available(), input->offset());
+    input->skip(size);
 
-      case '}':
-        if (context.empty() || context.back() != '{') {
-          throw invalid_json("Unexpected '}' in input", input->offset());
-        }
-        context.pop_back();
-        s += input->get();
-        break;
+    if (!scanner.done()) {
+      input->peek();
+      throw_premature_end(scanner, input);
+    }
 
-      case ']':
-        if (context.empty() || context.back() != '[') {
-          throw invalid_json("Unexpected ']' in input", input->offset());
-        }
-        context.pop_back();
-        s += input->get();
-        break;
+    return Input_span(begin, size);
+  }
 
-      case '"':
-        s += input->get_double_quoted_string();
-        if (s.back() != '"') {
-          throw invalid_json("Incomplete quoted string in input",
-                             input->offset());
-        }
-        break;
+  buffer->clear();
 
-      default:
-        s += input->get();
-        break;
-    }
+  while (true) {
+    const char *begin = input->data();
+    if (input->available() == 0) throw_premature_end(scanner, input);
+
+    const size_t size =
+        scanner.scan(begin, begin + input->available(), input->offset());
+    buffer->append(begin, size);
+    input->skip(size);
+
+    if (scanner.done()) break;
   }
+
+  return Input_span(buffer->data(), buffer->size());
+}
+
+std::string span_one_maybe_json(shcore::Buffered_input *input) {
+  std::string s;
+  const auto span = span_one_maybe_json(input, &s);
+
+  if (!span.empty() && span.data != s.data()) {
+    s.assign(span.data, span.size);
+  }
+
   return s;
 }
 }  // namespace shcore
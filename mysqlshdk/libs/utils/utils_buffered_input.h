@@ -49,8 +49,27 @@ class invalid_json : public std::invalid_argument {
   std::string m_msg;  //< Exception message
 };
 
+/**
+ * Non-owning reference to a contiguous range of input bytes.
+ */
+struct Input_span {
+  Input_span() = default;
+  Input_span(const char *d, size_t s) : data(d), size(s) {}
+
+  bool empty() const { return size == 0; }
+
+  std::string str() const { return std::string(data, size); }
+
+  const char *data = nullptr;
+  size_t size = 0;
+};
+
 /**
  * Forward read only buffered input.
+ *
+ * Regular files are memory mapped where supported, so whole file content is
+ * directly available through data() and can be referenced without copying.
+ * Other inputs (i.e. pipes, stdin) are read through 64 KiB buffer.
  */
 class Buffered_input {
   using byte = unsigned char;
@@ -67,10 +86,22 @@ class Buffered_input {
 
   ~Buffered_input() { close(); }
 
-  void open(const std::string &filepath_);
+  /**
+   * Open file for reading.
+   *
+   * @param filepath_ Path to the file.
+   * @param use_mmap Memory map the file if it is a regular, non-empty file.
+   */
+  void open(const std::string &filepath_, bool use_mmap = true);
 
   bool eof() { return m_eof; }
 
+  /**
+   * Whether input is memory mapped, in that case data returned by data()
+   * stays valid until input is closed.
+   */
+  bool is_mapped() const { return m_map != nullptr; }
+
   byte peek() {
     if (m_pos == m_end) {
       fill_buffer();
@@ -85,6 +116,27 @@ class Buffered_input {
     return c;
   }
 
+  /**
+   * Bytes available for reading without refilling the buffer, refills it if
+   * it is already consumed. Only available() bytes can be accessed.
+   */
+  const char *data() {
+    if (m_pos == m_end) {
+      fill_buffer();
+    }
+    return reinterpret_cast<const char *>(m_pos);
+  }
+
+  size_t available() const { return m_end - m_pos; }
+
+  /**
+   * Consume `count` bytes, `count` cannot be greater than available().
+   */
+  void skip(size_t count) {
+    m_pos += count;
+    m_bytes_processed += count;
+  }
+
   size_t offset() { return m_bytes_processed; }
 
   void skip_whitespaces() {
@@ -107,6 +159,8 @@ class Buffered_input {
   byte *m_pos = m_buffer;
   byte *m_end = m_buffer;
   size_t m_bytes_processed = 0;
+  void *m_map = nullptr;
+  size_t m_map_size = 0;
 };
 
 /**
@@ -124,6 +178,20 @@ class Buffered_input {
  */
 std::string span_one_maybe_json(shcore::Buffered_input *input);
 
+/**
+ * Zero-copy variant of span_one_maybe_json().
+ *
+ * If input is memory mapped, returned span references the mapping and stays
+ * valid until input is closed. Otherwise document is copied to `buffer` and
+ * returned span references it.
+ *
+ * @param input Input with JSON document.
+ * @param buffer Storage used when document cannot be referenced in place.
+ * @return Span with JSON document, empty if there is no more documents.
+ */
+Input_span span_one_maybe_json(shcore::Buffered_input *input,
+                               std::string *buffer);
+
 }  // namespace shcore
 
 #endif  // MYSQLSHDK_LIBS_UTILS_UTILS_BUFFERED_INPUT_H_
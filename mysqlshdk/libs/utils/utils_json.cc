@@ -39,6 +39,19 @@ JSON_dumper::~JSON_dumper() {
   if (_writer) delete (_writer);
 }
 
+void JSON_dumper::set_output_handler(
+    const std::function<void(const std::string &)> &handler,
+    size_t buffer_size) {
+  _output_handler = handler;
+  _buffer_size = buffer_size;
+}
+
+void JSON_dumper::flush(bool force) {
+  if (_output_handler && _writer->size() > 0 &&
+      (force || _writer->size() >= _buffer_size))
+    _output_handler(_writer->take());
+}
+
 void JSON_dumper::append_value(const Value &value) {
   switch (value.type) {
     case Undefined:
@@ -26,6 +26,7 @@
 
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/writer.h>
+#include <functional>
 #include <string>
 
 #include "mysqlshdk_export.h"
@@ -65,6 +66,16 @@ class SHCORE_PUBLIC Writer_base {
 
  public:
   std::string str() { return _data.data; }
+
+  size_t size() const { return _data.data.size(); }
+
+  // Removes the text written so far, the writer state is kept, so the
+  // document can be continued
+  std::string take() {
+    std::string data;
+    std::swap(data, _data.data);
+    return data;
+  }
 };
 
 class SHCORE_PUBLIC Raw_writer : public Writer_base {
@@ -171,10 +182,30 @@ class SHCORE_PUBLIC JSON_dumper {
 
   std::string str() { return _writer->str(); }
 
+  /**
+   * Sets the function which receives the JSON text when the dumper is
+   * flushed, so big documents do not need to be held in memory.
+   *
+   * @param handler Receives the text written since the last flush.
+   * @param buffer_size Minimum amount of text passed to the handler, unless
+   *        the flush is forced.
+   */
+  void set_output_handler(
+      const std::function<void(const std::string &)> &handler,
+      size_t buffer_size);
+
+  /**
+   * Passes the buffered text to the output handler, if the buffer is full or
+   * if the flush is forced. Does nothing if there is no output handler.
+   */
+  void flush(bool force = false);
+
  private:
   int _deep_level;
 
   Writer_base *_writer;
+  std::function<void(const std::string &)> _output_handler;
+  size_t _buffer_size = 0;
 };
 }  // namespace shcore
 #endif /* defined(__MYSH__UTILS_JSON__) */
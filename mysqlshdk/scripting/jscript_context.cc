@@ -433,7 +433,7 @@ struct JScript_context::JScript_context_impl {
       if (i > 0) text.push_back(' ');
 
       try {
-        if (format.find("json") == 0)
+        if (format.find("json") != std::string::npos)
           text += self->types.v8_value_to_shcore_value(args[i]).json(format ==
                                                                      "json");
         else
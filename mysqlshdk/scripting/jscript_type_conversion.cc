@@ -35,6 +35,7 @@
 #include "scripting/obj_date.h"
 
 #include <cerrno>
+#include <ctime>
 #include <fstream>
 #include "utils/utils_string.h"
 
@@ -42,6 +43,31 @@
 
 using namespace shcore;
 
+namespace {
+// ASCII strings at least this long are handed to V8 as external strings,
+// which skips decoding them as UTF-8 and keeps them out of the V8 heap
+const size_t k_external_string_min_length = 1024;
+
+class External_string : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit External_string(const std::string &data) : m_data(data) {}
+
+  const char *data() const override { return m_data.data(); }
+  size_t length() const override { return m_data.size(); }
+
+ private:
+  std::string m_data;
+};
+
+bool is_ascii(const std::string &s) {
+  for (const auto c : s) {
+    if (static_cast<unsigned char>(c) & 0x80) return false;
+  }
+
+  return true;
+}
+}  // namespace
+
 JScript_type_bridger::JScript_type_bridger(JScript_context *context)
     : owner(context),
       object_wrapper(NULL),
@@ -99,8 +125,28 @@ v8::Handle<v8::Value> JScript_type_bridger::native_object_to_js(
     Object_bridge_ref object) {
   if (object && object->class_name() == "Date") {
     std::shared_ptr<Date> date = std::static_pointer_cast<Date>(object);
+
+    // Like new Date(...), the date is taken as local time. Two digit years
+    // are mapped to 19xx by JS, so they are left to the script below.
+    std::tm tm = {};
+    tm.tm_year = date->get_year() - 1900;
+    tm.tm_mon = date->get_month() - 1;
+    tm.tm_mday = date->get_day();
+    tm.tm_hour = date->get_hour();
+    tm.tm_min = date->get_min();
+    tm.tm_sec = date->get_sec();
+    tm.tm_isdst = -1;
+
+    const std::time_t time = std::mktime(&tm);
+
+    if (time != -1 && date->get_year() >= 100) {
+      return v8::Date::New(owner->isolate(),
+                           static_cast<double>(time) * 1000.0 +
+                               date->get_usec() / 1000);
+    }
+
     // The only Date constructor exposed to C++ takes milliseconds, the
-    // constructor that parses a date from an string is implemented in
+    // constructor that takes the date components is implemented in
     // Javascript, so it is invoked this way.
     v8::Handle<v8::String> source = v8::String::NewFromUtf8(
         owner->isolate(),
@@ -150,6 +196,11 @@ Value JScript_type_bridger::v8_value_to_shcore_value(
   else if (value->IsNumber())
     return Value(value->ToNumber()->Value());
   else if (value->IsString()) {
+    const auto external =
+        v8::Handle<v8::String>::Cast(value)->GetExternalOneByteStringResource();
+
+    if (external) return Value(external->data(), external->length());
+
     v8::String::Utf8Value s(value->ToString());
     return Value(*s, s.length());
   } else if (value->IsTrue())
@@ -223,9 +274,19 @@ v8::Handle<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
     case Bool:
       r = v8::Boolean::New(owner->isolate(), value.value.b);
       break;
-    case String:
-      r = v8::String::NewFromUtf8(owner->isolate(), value.value.s->c_str());
-      break;
+    case String: {
+      const std::string &s = *value.value.s;
+
+      if (s.length() >= k_external_string_min_length && is_ascii(s)) {
+        // V8 takes ownership of the resource
+        r = v8::String::NewExternal(owner->isolate(), new External_string(s));
+      } else {
+        // the length is given so embedded NULs are kept
+        r = v8::String::NewFromUtf8(owner->isolate(), s.data(),
+                                    v8::String::kNormalString,
+                                    static_cast<int>(s.length()));
+      }
+    } break;
     case Integer:
       r = v8::Integer::New(owner->isolate(), value.value.i);
       break;
@@ -46,8 +46,7 @@ void Object_registry::add_to_reg_list(
   Value::Map_type::iterator liter = _registry->find(list_name);
 
   if (liter == _registry->end())
-    (*_registry)[list_name] =
-        Value(std::shared_ptr<Value::Array_type>(new Value::Array_type()));
+    liter = _registry->emplace(list_name, Value::new_array()).first;
   else if (liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
@@ -59,8 +58,7 @@ void Object_registry::add_to_reg_list(const std::string &list_name,
   Value::Map_type::iterator liter = _registry->find(list_name);
 
   if (liter == _registry->end())
-    (*_registry)[list_name] =
-        Value(std::shared_ptr<Value::Array_type>(new Value::Array_type()));
+    liter = _registry->emplace(list_name, Value::new_array()).first;
   else if (liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
@@ -259,7 +259,7 @@ static PyObject *object_printable(PyShObjObject *self) {
   Value object((*self->object));
   std::string format = mysqlsh::current_shell_options()->get().output_format;
 
-  if (format.find("json") == 0)
+  if (format.find("json") != std::string::npos)
     ret_val = PyString_FromString(object.json(format == "json").c_str());
   else
     ret_val = PyString_FromString(object.descr(true).c_str());
@@ -22,7 +22,9 @@
  */
 
 #include "scripting/types.h"
+#include <rapidjson/error/en.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
 #include <cfloat>
 #include <cmath>
 #include <cstdarg>
@@ -369,8 +371,31 @@ void Value::Map_type::merge_contents(std::shared_ptr<Map_type> source,
   }
 }
 
+void Value::Map_type::assign(container_type &&members) {
+  if (!std::is_sorted(members.begin(), members.end(), key_less_member)) {
+    // stable, so that the last occurrence of a repeated key stays last
+    std::stable_sort(members.begin(), members.end(), key_less_member);
+  }
+
+  auto out = members.begin();
+
+  for (auto it = members.begin(); it != members.end(); ++it) {
+    if (out != members.begin() && (out - 1)->first == it->first)
+      (out - 1)->second = std::move(it->second);
+    else if (out++ != it)
+      *(out - 1) = std::move(*it);
+  }
+
+  members.erase(out, members.end());
+  _map = std::move(members);
+}
+
 Value::Value(const Value &copy) : type(shcore::Null) { operator=(copy); }
 
+Value::Value(Value &&other) noexcept : type(other.type), value(other.value) {
+  other.type = Undefined;
+}
+
 Value::Value(const std::string &s) : type(String) {
   value.s = new std::string(s);
 }
@@ -556,6 +581,16 @@ Value &Value::operator=(const Value &other) {
   return *this;
 }
 
+Value &Value::operator=(Value &&other) noexcept {
+  if (this != &other) {
+    // previous contents are released by the temporary
+    Value tmp(std::move(other));
+    std::swap(type, tmp.type);
+    std::swap(value, tmp.value);
+  }
+  return *this;
+}
+
 Value Value::parse_map(const char **pc) {
   Map_type_ref map(new Map_type());
 
@@ -871,6 +906,131 @@ Value Value::parse(const std::string &s) {
   return tmp;
 }
 
+namespace {
+/**
+ * rapidjson SAX handler which builds a Value out of the parsed document.
+ */
+class Value_builder
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Value_builder> {
+ public:
+  bool Null() { return add(Value::Null()); }
+  bool Bool(bool b) { return add(Value(b)); }
+  bool Int(int i) { return add(Value(i)); }
+  bool Uint(unsigned u) { return add(Value(static_cast<int64_t>(u))); }
+  bool Int64(int64_t i) { return add(Value(i)); }
+
+  bool Uint64(uint64_t u) {
+    if (u <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+      return add(Value(static_cast<int64_t>(u)));
+    else
+      return add(Value(u));
+  }
+
+  bool Double(double d) { return add(Value(d)); }
+
+  bool String(const char *str, rapidjson::SizeType length, bool) {
+    return add(Value(str, length));
+  }
+
+  bool StartObject() {
+    m_stack.emplace_back(Value::new_map());
+    return true;
+  }
+
+  bool EndObject(rapidjson::SizeType) {
+    auto &object = m_stack.back();
+    object.map->assign(std::move(object.members));
+    return end_container();
+  }
+
+  bool Key(const char *str, rapidjson::SizeType length, bool) {
+    m_stack.back().key.assign(str, length);
+    return true;
+  }
+
+  bool StartArray() {
+    m_stack.emplace_back(Value::new_array());
+    return true;
+  }
+
+  bool EndArray(rapidjson::SizeType) { return end_container(); }
+
+  Value &result() { return m_result; }
+
+ private:
+  struct Container {
+    explicit Container(Value &&v) : value(std::move(v)) {
+      if (shcore::Map == value.type)
+        map = value.value.map->get();
+      else
+        array = value.value.array->get();
+    }
+
+    Value value;
+    Value::Map_type *map = nullptr;
+    Value::Array_type *array = nullptr;
+    // members of an object are sorted once it is complete
+    Value::Map_type::container_type members;
+    std::string key;
+  };
+
+  bool add(Value &&value) {
+    if (m_stack.empty()) {
+      m_result = std::move(value);
+    } else {
+      auto &parent = m_stack.back();
+
+      if (parent.map)
+        parent.members.emplace_back(std::move(parent.key), std::move(value));
+      else
+        parent.array->emplace_back(std::move(value));
+    }
+
+    return true;
+  }
+
+  bool end_container() {
+    Value value = std::move(m_stack.back().value);
+    m_stack.pop_back();
+    return add(std::move(value));
+  }
+
+  std::vector<Container> m_stack;
+  Value m_result;
+};
+
+template <unsigned parse_flags, typename Stream>
+Value parse_json_stream(Stream *stream) {
+  Value_builder builder;
+  rapidjson::Reader reader;
+
+  const auto result =
+      reader.Parse<parse_flags | rapidjson::kParseFullPrecisionFlag>(*stream,
+                                                                     builder);
+
+  if (result.IsError()) {
+    throw Exception::parser_error(
+        std::string("Error parsing JSON document at offset ") +
+        std::to_string(result.Offset()) + ": " +
+        rapidjson::GetParseError_En(result.Code()));
+  }
+
+  return std::move(builder.result());
+}
+}  // namespace
+
+Value Value::parse_json(const std::string &json) {
+  rapidjson::StringStream stream(json.c_str());
+  return parse_json_stream<rapidjson::kParseDefaultFlags>(&stream);
+}
+
+Value Value::parse_json(std::string &&json) {
+  // strings are decoded in place, the buffer is discarded afterwards
+  std::string buffer(std::move(json));
+  rapidjson::InsituStringStream stream(&buffer[0]);
+  return parse_json_stream<rapidjson::kParseInsituFlag>(&stream);
+}
+
 Value Value::parse(const char **pc) {
   if (**pc == '{') {
     return parse_map(pc);
@@ -58,6 +58,7 @@ Base_shell::Base_shell(std::shared_ptr<Shell_options> cmdline_options,
 
   ngcommon::Logger::setup_instance(log_path.c_str(), options().log_to_stderr,
                                    options().log_level);
+  ngcommon::Logger::singleton()->set_async(options().log_async);
 
   _input_mode = shcore::Input_state::Ok;
 
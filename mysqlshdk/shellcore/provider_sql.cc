@@ -23,11 +23,22 @@
 
 #include "mysqlshdk/shellcore/provider_sql.h"
 #include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
 
 #include "modules/devapi/base_resultset.h"  // TODO(alfredo) remove when ISession
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -37,8 +48,87 @@ namespace completer {
 namespace {
 
 extern std::vector<std::string> k_sorted_keywords;
+
+bool compare_ci(const std::string &a, const std::string &b) {
+  return shcore::str_casecmp(a, b) < 0;
+}
+
+void sort_unique_ci(std::vector<std::string> *names) {
+  std::sort(names->begin(), names->end(), compare_ci);
+  names->erase(std::unique(names->begin(), names->end()), names->end());
+}
+
+/**
+ * Location of the persisted name cache of the given schema, schema name is
+ * hex encoded if it has characters which may not be valid in a file name.
+ */
+std::string name_cache_path(const std::string &server_uuid,
+                            const std::string &schema) {
+  static const char k_hex[] = "0123456789abcdef";
+  std::string file_name;
+
+  for (const char c : schema) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '_') {
+      file_name.push_back(c);
+    } else {
+      file_name.push_back('@');
+      file_name.push_back(k_hex[(c >> 4) & 0xf]);
+      file_name.push_back(k_hex[c & 0xf]);
+    }
+  }
+
+  return shcore::path::join_path(shcore::get_user_config_path(), "name_cache",
+                                 server_uuid, file_name);
+}
+
+// Persisted cache holds one "table<TAB>column" entry per line.
+bool load_name_cache(
+    const std::string &path,
+    std::vector<std::pair<std::string, std::string>> *columns) {
+  std::string data;
+
+  if (!shcore::file_exists(path) || !shcore::load_text_file(path, data))
+    return false;
+
+  for (const auto &line : shcore::str_split(data, "\n")) {
+    const auto tab = line.find('\t');
+    if (tab != std::string::npos)
+      columns->emplace_back(line.substr(0, tab), line.substr(tab + 1));
+  }
+
+  return true;
+}
+
+void save_name_cache(
+    const std::string &path,
+    const std::vector<std::pair<std::string, std::string>> &columns) {
+  std::string data;
+
+  for (const auto &c : columns) {
+    // names which cannot be represented in this format are not persisted
+    if (c.first.find_first_of("\t\n") != std::string::npos ||
+        c.second.find_first_of("\t\n") != std::string::npos)
+      continue;
+
+    data.append(c.first).append(1, '\t').append(c.second).append(1, '\n');
+  }
+
+  shcore::create_directory(shcore::path::dirname(path), true);
+
+  if (!shcore::create_file(path, data))
+    log_warning("Could not write auto-completion cache to '%s'", path.c_str());
+}
+
+std::shared_ptr<mysqlshdk::db::ISession> create_session(
+    const mysqlshdk::db::Connection_options &options) {
+  if (options.get_session_type() == mysqlsh::SessionType::X)
+    return mysqlshdk::db::mysqlx::Session::create();
+  else
+    return mysqlshdk::db::mysql::Session::create();
 }
 
+}  // namespace
+
 void add_matches_ci(const std::vector<std::string> &options,
                     Completion_list *out_list, const std::string &prefix,
                     bool back_quote = false) {
@@ -66,6 +156,14 @@ Completion_list Provider_sql::complete_schema(const std::string &prefix) {
   return list;
 }
 
+Provider_sql::Provider_sql()
+    : name_cache_(std::make_shared<Name_cache_holder>()), cancelled_(false) {}
+
+Provider_sql::~Provider_sql() {
+  cancel_name_cache_refresh();
+  join_stopped_refreshes(true);
+}
+
 /**
  * Return list of possible completions for the provided text.
  *
@@ -120,14 +218,131 @@ Completion_list Provider_sql::complete(const std::string &text,
   // add DB objects
   add_matches_ci(schema_names_, &options, prefix, back_quote);
 
-  if (dot_pos != std::string::npos) {
-    add_matches_ci(object_dot_names_, &options, prefix, back_quote);
+  // names are not available until the first refresh completes, unless they
+  // were persisted for this schema
+  const auto cache = get_name_cache();
+
+  if (cache) {
+    if (dot_pos != std::string::npos) {
+      add_matches_ci(cache->object_dot_names, &options, prefix, back_quote);
+    }
+    add_matches_ci(cache->object_names, &options, prefix, back_quote);
   }
-  add_matches_ci(object_names_, &options, prefix, back_quote);
   return options;
 }
 
-void Provider_sql::interrupt_rehash() { cancelled_ = true; }
+void Provider_sql::interrupt_rehash() {
+  cancelled_ = true;
+  cancel_name_cache_refresh();
+  join_stopped_refreshes(true);
+}
+
+void Provider_sql::wait_name_cache_refresh() {
+  if (refresh_thread_.joinable()) refresh_thread_.join();
+}
+
+void Provider_sql::cancel_name_cache_refresh() {
+  if (!refresh_) return;
+
+  {
+    // once this returns, the refresh cannot replace the name cache
+    std::lock_guard<std::mutex> lock(name_cache_->mutex);
+    refresh_->cancelled = true;
+  }
+
+  bool finished;
+  {
+    std::lock_guard<std::mutex> lock(refresh_->mutex);
+    finished = refresh_->finished;
+  }
+
+  if (finished) {
+    wait_name_cache_refresh();
+  } else {
+    // the refresh is stopped in the background, so the prompt does not wait
+    // for its connection to be killed
+    join_stopped_refreshes(false);
+    stopping_.emplace_back(refresh_,
+                           std::thread(stop_name_cache_refresh, refresh_,
+                                       std::move(refresh_thread_)));
+  }
+
+  refresh_.reset();
+}
+
+void Provider_sql::stop_name_cache_refresh(
+    const std::shared_ptr<Name_cache_refresh> &refresh, std::thread thread) {
+  mysqlsh::thread_init();
+
+  uint64_t connection_id = 0;
+  {
+    std::lock_guard<std::mutex> lock(refresh->mutex);
+    if (!refresh->finished) connection_id = refresh->connection_id;
+  }
+
+  // killing the connection of the refresh makes its query fail right away
+  if (connection_id != 0) {
+    try {
+      auto kill_session = create_session(refresh->options);
+
+      kill_session->connect(refresh->options);
+
+      kill_session->execute("KILL " + std::to_string(connection_id));
+
+      kill_session->close();
+    } catch (const std::exception &e) {
+      log_warning("Error cancelling auto-completion cache update: %s",
+                  e.what());
+    }
+  }
+
+  thread.join();
+  refresh->stopped = true;
+
+  mysqlsh::thread_end();
+}
+
+void Provider_sql::join_stopped_refreshes(bool all) {
+  for (auto it = stopping_.begin(); it != stopping_.end();) {
+    if (all || it->first->stopped) {
+      it->second.join();
+      it = stopping_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+std::shared_ptr<const Provider_sql::Name_cache> Provider_sql::get_name_cache()
+    const {
+  std::lock_guard<std::mutex> lock(name_cache_->mutex);
+  return name_cache_->cache;
+}
+
+void Provider_sql::set_name_cache(std::shared_ptr<const Name_cache> cache) {
+  std::lock_guard<std::mutex> lock(name_cache_->mutex);
+  name_cache_->cache = std::move(cache);
+}
+
+std::shared_ptr<const Provider_sql::Name_cache> Provider_sql::build_name_cache(
+    const Column_list &columns, bool include_tables) {
+  auto cache = std::make_shared<Name_cache>();
+
+  cache->object_names.reserve(columns.size() * (include_tables ? 2 : 1));
+  cache->object_dot_names.reserve(columns.size());
+
+  for (const auto &c : columns) {
+    if (include_tables) cache->object_names.push_back(c.first);
+    // FIXME add quoting
+    cache->object_names.push_back(c.second);
+    cache->object_dot_names.push_back(c.first + "." + c.second);
+  }
+
+  sort_unique_ci(&cache->object_names);
+  sort_unique_ci(&cache->object_dot_names);
+
+  return cache;
+}
 
 void Provider_sql::refresh_schema_cache(
     std::shared_ptr<mysqlsh::ShellBaseSession> session) {
@@ -142,75 +357,134 @@ void Provider_sql::refresh_schema_cache(
     schema_names_.push_back(column);
     row = res->call("fetchOne", shcore::Argument_list());
   }
-  std::sort(schema_names_.begin(), schema_names_.end(),
-            [](const std::string &a, const std::string &b) -> bool {
-              return shcore::str_casecmp(a, b) < 0;
-            });
+  std::sort(schema_names_.begin(), schema_names_.end(), compare_ci);
 }
 
 void Provider_sql::refresh_name_cache(
     std::shared_ptr<mysqlsh::ShellBaseSession> session,
     const std::string &current_schema,
-    const std::vector<std::string> *table_names, bool rehash_all) {
+    const std::vector<std::string> *table_names, bool rehash_all,
+    bool load_saved_names) {
+  cancel_name_cache_refresh();
+
   cancelled_ = false;
   default_schema_ = current_schema;
 
-  object_names_.clear();
-  object_dot_names_.clear();
+  set_name_cache(nullptr);
 
   // cache schema names if not done yet
   if (schema_names_.empty() || rehash_all) {
     refresh_schema_cache(session);
   }
 
-  if (!current_schema.empty() && !cancelled_) {
-    // fetch table names, if one was not provided
-    std::vector<std::string> schema_tables;
-    if (table_names == nullptr) {
-      table_names = &schema_tables;
-
-      auto res = session->raw_execute_sql(
-          shcore::sqlstring("show tables from !", 0) << current_schema);
-      auto row = res->call("fetchOne", shcore::Argument_list());
-      while (row && !cancelled_) {
-        std::string table =
-            row.as_object<mysqlsh::Row>()->get_member(0).get_string();
-        object_names_.push_back(table);
-        schema_tables.push_back(table);
-        row = res->call("fetchOne", shcore::Argument_list());
+  if (current_schema.empty() || cancelled_) return;
+
+  // only the names of the whole schema are persisted
+  const bool include_tables = table_names == nullptr;
+  std::string cache_path;
+
+  if (include_tables) {
+    try {
+      cache_path = name_cache_path(
+          session->query_one_string("SELECT @@server_uuid"), current_schema);
+
+      Column_list columns;
+      if (load_saved_names && load_name_cache(cache_path, &columns))
+        set_name_cache(build_name_cache(columns, true));
+    } catch (const std::exception &e) {
+      log_warning("Could not load auto-completion cache: %s", e.what());
+    }
+  }
+
+  // fetch the up to date names using a separate connection, so the prompt
+  // is not blocked while the query is running
+  auto options = session->get_connection_options();
+  if (options.has_scheme()) options.clear_scheme();
+  options.set_scheme(session->session_type() == mysqlsh::SessionType::X
+                         ? "mysqlx"
+                         : "mysql");
+
+  std::vector<std::string> tables;
+  if (table_names) tables = *table_names;
+
+  refresh_ = std::make_shared<Name_cache_refresh>(options);
+  refresh_thread_ = std::thread(fetch_name_cache, refresh_, name_cache_,
+                                current_schema, tables, include_tables,
+                                cache_path);
+}
+
+void Provider_sql::fetch_name_cache(
+    const std::shared_ptr<Name_cache_refresh> &refresh,
+    const std::shared_ptr<Name_cache_holder> &holder,
+    const std::string &current_schema,
+    const std::vector<std::string> &table_names, bool include_tables,
+    const std::string &cache_path) {
+  mysqlsh::thread_init();
+
+  try {
+    auto session = create_session(refresh->options);
+
+    session->connect(refresh->options);
+
+    {
+      // the connection is killed if the refresh is cancelled from now on
+      std::lock_guard<std::mutex> lock(refresh->mutex);
+      if (refresh->cancelled) {
+        session->close();
+        throw std::runtime_error("cancelled");
       }
+      refresh->connection_id = session->get_connection_id();
     }
 
-    // fetch column names for each table
-    for (const std::string &t : *table_names) {
-      if (cancelled_) break;
-      std::vector<std::string> column_names;
-      auto res = session->raw_execute_sql(
-          shcore::sqlstring("show columns from !.!", 0) << current_schema << t);
-      auto row = res->call("fetchOne", shcore::Argument_list());
-      while (row && !cancelled_) {
-        std::string column =
-            row.as_object<mysqlsh::Row>()->get_member(0).get_string();
-        // FIXME add quoting
-        object_names_.push_back(column);
-        object_dot_names_.push_back(t + "." + column);
-        row = res->call("fetchOne", shcore::Argument_list());
+    // tables and their columns are fetched in a single round trip
+    std::string query =
+        shcore::sqlstring(
+            "SELECT TABLE_NAME, COLUMN_NAME FROM information_schema.columns "
+            "WHERE TABLE_SCHEMA = ?",
+            0)
+        << current_schema;
+
+    if (!table_names.empty()) {
+      std::vector<std::string> quoted;
+      for (const auto &t : table_names)
+        quoted.push_back(shcore::sqlstring("?", 0) << t);
+      query += " AND TABLE_NAME IN (" + shcore::str_join(quoted, ", ") + ")";
+    }
+
+    Column_list columns;
+    auto result = session->query(query);
+
+    while (const auto row = result->fetch_one()) {
+      if (refresh->cancelled) break;
+      columns.emplace_back(row->get_string(0), row->get_string(1));
+    }
+
+    session->close();
+
+    if (!refresh->cancelled) {
+      auto cache = build_name_cache(columns, include_tables);
+
+      {
+        std::lock_guard<std::mutex> lock(holder->mutex);
+        if (!refresh->cancelled) holder->cache = std::move(cache);
+      }
+
+      if (!cache_path.empty()) {
+        std::lock_guard<std::mutex> lock(holder->save_mutex);
+        if (!refresh->cancelled) save_name_cache(cache_path, columns);
       }
     }
-    std::sort(object_names_.begin(), object_names_.end(),
-              [](const std::string &a, const std::string &b) -> bool {
-                return shcore::str_casecmp(a, b) < 0;
-              });
-    auto last = std::unique(object_names_.begin(), object_names_.end());
-    object_names_.erase(last, object_names_.end());
-
-    std::sort(object_dot_names_.begin(), object_dot_names_.end(),
-              [](const std::string &a, const std::string &b) -> bool {
-                return shcore::str_casecmp(a, b) < 0;
-              });
-    last = std::unique(object_dot_names_.begin(), object_dot_names_.end());
-    object_dot_names_.erase(last, object_dot_names_.end());
+  } catch (const std::exception &e) {
+    if (!refresh->cancelled)
+      log_warning("Error during auto-completion cache update: %s", e.what());
   }
+
+  {
+    std::lock_guard<std::mutex> lock(refresh->mutex);
+    refresh->finished = true;
+  }
+
+  mysqlsh::thread_end();
 }
 
 namespace {
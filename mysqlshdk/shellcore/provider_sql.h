@@ -24,8 +24,12 @@
 #ifndef MYSQLSHDK_SHELLCORE_PROVIDER_SQL_H_
 #define MYSQLSHDK_SHELLCORE_PROVIDER_SQL_H_
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/db/session.h"
@@ -37,31 +41,112 @@ namespace completer {
 
 class Provider_sql : public Provider {
  public:
+  Provider_sql();
+  ~Provider_sql() override;
+
   Completion_list complete(const std::string &text,
                            size_t *compl_offset) override;
 
   virtual void refresh_schema_cache(
       std::shared_ptr<mysqlsh::ShellBaseSession> session);
 
-  // void refresh_name_cache(std::shared_ptr<mysqlshdk::db::ISession> session,
-  //                         const std::string &current_schema,
-  //                         const std::vector<std::string> *table_names,
-  //                         bool rehash_all);
+  /**
+   * Refreshes the table and column names of the given schema.
+   *
+   * Names persisted by a previous run for the same server and schema are
+   * made available right away, unless load_saved_names is false, while the
+   * up to date list is fetched with a single query in a background thread,
+   * using a separate connection. The cache is swapped once the query
+   * completes, until then only the names which were loaded are completed.
+   */
   virtual void refresh_name_cache(
       std::shared_ptr<mysqlsh::ShellBaseSession> session,
       const std::string &current_schema,
-      const std::vector<std::string> *table_names, bool rehash_all);
+      const std::vector<std::string> *table_names, bool rehash_all,
+      bool load_saved_names = true);
 
+  /**
+   * Stops the current background name cache refresh (if any), waiting for
+   * its thread to finish. Must be called before the client library is
+   * deinitialized.
+   */
   void interrupt_rehash();
 
+  /**
+   * Blocks until the current background name cache refresh (if any)
+   * completes.
+   */
+  void wait_name_cache_refresh();
+
   Completion_list complete_schema(const std::string &prefix);
 
  private:
+  struct Name_cache {
+    std::vector<std::string> object_names;
+    std::vector<std::string> object_dot_names;
+  };
+
+  /**
+   * Current name cache, shared with the background refreshes.
+   */
+  struct Name_cache_holder {
+    std::shared_ptr<const Name_cache> cache;
+    std::mutex mutex;
+    // serializes writing of the persisted caches
+    std::mutex save_mutex;
+  };
+
+  /**
+   * State of a background refresh, shared with its thread. A cancelled
+   * refresh has its connection killed and is joined by a separate thread,
+   * which sets stopped once done.
+   */
+  struct Name_cache_refresh {
+    explicit Name_cache_refresh(const mysqlshdk::db::Connection_options &opts)
+        : options(opts) {}
+
+    const mysqlshdk::db::Connection_options options;
+    std::atomic<bool> cancelled{false};
+    std::atomic<bool> stopped{false};
+    // guarded by mutex
+    bool finished = false;
+    uint64_t connection_id = 0;
+    std::mutex mutex;
+  };
+
+  using Column_list = std::vector<std::pair<std::string, std::string>>;
+
+  static std::shared_ptr<const Name_cache> build_name_cache(
+      const Column_list &columns, bool include_tables);
+
+  static void fetch_name_cache(
+      const std::shared_ptr<Name_cache_refresh> &refresh,
+      const std::shared_ptr<Name_cache_holder> &holder,
+      const std::string &current_schema,
+      const std::vector<std::string> &table_names, bool include_tables,
+      const std::string &cache_path);
+
+  static void stop_name_cache_refresh(
+      const std::shared_ptr<Name_cache_refresh> &refresh, std::thread thread);
+
+  /**
+   * Joins the threads stopping the cancelled refreshes, only the ones which
+   * are done unless all is true.
+   */
+  void join_stopped_refreshes(bool all);
+
+  std::shared_ptr<const Name_cache> get_name_cache() const;
+  void set_name_cache(std::shared_ptr<const Name_cache> cache);
+  void cancel_name_cache_refresh();
+
   std::string default_schema_;
   std::vector<std::string> schema_names_;
-  std::vector<std::string> object_names_;
-  std::vector<std::string> object_dot_names_;
-  bool cancelled_;
+  std::shared_ptr<Name_cache_holder> name_cache_;
+  std::shared_ptr<Name_cache_refresh> refresh_;
+  std::thread refresh_thread_;
+  std::vector<std::pair<std::shared_ptr<Name_cache_refresh>, std::thread>>
+      stopping_;
+  std::atomic<bool> cancelled_;
 };
 
 }  // namespace completer
@@ -428,6 +428,10 @@ void Shell_console::print_value(const shcore::Value &value,
     m_ideleg->print(m_ideleg->user_data, output.c_str());
 }
 
+void Shell_console::print_json(const std::string &json) const {
+  m_ideleg->print(m_ideleg->user_data, json.c_str());
+}
+
 std::shared_ptr<IPager> Shell_console::enable_pager() {
   std::shared_ptr<IPager> pager = m_current_pager.lock();
 
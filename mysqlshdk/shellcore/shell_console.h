@@ -116,6 +116,12 @@ class Shell_console : public IConsole {
   void print_value(const shcore::Value &value,
                    const std::string &tag) const override;
 
+  /**
+   * Sends the provided text to the STDOUT without any changes, regardless of
+   * the active output format. Used to print a JSON document in parts.
+   */
+  void print_json(const std::string &json) const override;
+
   std::shared_ptr<IPager> enable_pager() override;
   void enable_global_pager() override;
   void disable_global_pager() override;
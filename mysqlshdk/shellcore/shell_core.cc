@@ -131,6 +131,17 @@ int Shell_core::process_stream(std::istream &stream, const std::string &source,
 
   // In SQL Mode the stdin and file are processed line by line
   if (_mode == Shell_core::Mode::SQL) {
+    const auto &options = mysqlsh::current_shell_options()->get();
+    auto sql = static_cast<Shell_sql *>(_langs[_mode]);
+
+    // statements are pipelined only in batch mode, where their results are
+    // not interleaved with the input
+    if (!options.interactive)
+      sql->set_pipeline_size(options.batch_pipeline_size);
+
+    shcore::Scoped_callback reset_pipeline(
+        [sql]() { sql->set_pipeline_size(0); });
+
     while (!stream.eof()) {
       std::string line;
 
@@ -146,6 +157,8 @@ int Shell_core::process_stream(std::istream &stream, const std::string &source,
       std::string delimiter = ";";
       handle_input(delimiter, state);
     }
+
+    if (!sql->flush_pipeline()) set_error_processing();
   } else {
     std::string data;
     if (&std::cin == &stream) {
@@ -489,31 +502,36 @@ void Shell_command_handler::add_command(const std::string &triggers,
   }
 
   if (m_use_help) {
-    // Verifies if the command is already registered to avoid double entry
-    auto topics = Help_registry::get()->search_topics(tokens[0], mode,
-                                                      case_sensitive_help);
-
-    if (topics.empty()) {
-      Help_topic *topic;
-      topic = Help_registry::get()->add_help_topic(
-          tokens[0], shcore::Topic_type::COMMAND, help_tag, "Commands", mode);
-
-      // If case insensitive, first trigger is already registered
-      if (!case_sensitive_help) tokens.erase(tokens.begin());
-
-      for (auto &token : tokens) {
-        Help_registry::get()->register_keyword(token, mode, topic,
-                                               case_sensitive_help);
-      }
+    // The help topics are only built when help is first used
+    Help_registry::get()->defer([tokens, help_tag, case_sensitive_help,
+                                 mode]() mutable {
+      // Verifies if the command is already registered to avoid double entry
+      auto topics = Help_registry::get()->search_topics(tokens[0], mode,
+                                                        case_sensitive_help);
+
+      if (topics.empty()) {
+        Help_topic *topic;
+        topic = Help_registry::get()->add_help_topic(
+            tokens[0], shcore::Topic_type::COMMAND, help_tag, "Commands",
+            mode);
+
+        // If case insensitive, first trigger is already registered
+        if (!case_sensitive_help) tokens.erase(tokens.begin());
+
+        for (auto &token : tokens) {
+          Help_registry::get()->register_keyword(token, mode, topic,
+                                                 case_sensitive_help);
+        }
 
-      // If case sensitive, we need now to remove the first trigger
-      if (case_sensitive_help) tokens.erase(tokens.begin());
+        // If case sensitive, we need now to remove the first trigger
+        if (case_sensitive_help) tokens.erase(tokens.begin());
 
-      if (!tokens.empty()) {
-        std::string alias = "(" + shcore::str_join(tokens, ",") + ")";
-        Help_registry::get()->add_help(help_tag + "_ALIAS", alias);
+        if (!tokens.empty()) {
+          std::string alias = "(" + shcore::str_join(tokens, ",") + ")";
+          Help_registry::get()->add_help(help_tag + "_ALIAS", alias);
+        }
       }
-    }
+    });
   }
 }
 
@@ -24,6 +24,12 @@
 #include "shellcore/shell_init.h"
 #include <mysql.h>
 
+#include <string>
+
+#include "mysqlshdk/libs/db/mysqlx/expr_cache.h"
+#include "mysqlshdk/libs/db/session_pool.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
 #ifdef HAVE_V8
 extern void JScript_context_init();
 #endif
@@ -45,6 +51,17 @@ void global_init() {
 }
 
 void global_end() {
+  const auto expr_cache = ::mysqlx::Expr_cache::get();
+
+  if (expr_cache->hits() + expr_cache->misses() > 0) {
+    log_debug("DevAPI expression cache: %s hits, %s misses",
+              std::to_string(expr_cache->hits()).c_str(),
+              std::to_string(expr_cache->misses()).c_str());
+  }
+
+  // pooled sessions need to be closed before the client library is released
+  mysqlshdk::db::Session_pool::get()->clear();
+
   thread_end();
   mysql_library_end();
 }
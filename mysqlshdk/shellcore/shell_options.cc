@@ -243,15 +243,18 @@ Shell_options::Shell_options(int argc, char **argv,
       })
     (cmdline("--json[=format]"),
         "Produce output in JSON format, allowed values:"
-        "raw, pretty. If no format is specified pretty format is produced.",
+        "raw, pretty, ndjson. If no format is specified pretty format is "
+        "produced.",
         [this](const std::string&, const char* value) {
           if (!value || strcmp(value, "pretty") == 0) {
             set_output_format("json");
           } else if (strcmp(value, "raw") == 0) {
             set_output_format("json/raw");
+          } else if (strcmp(value, "ndjson") == 0) {
+            set_output_format("ndjson");
           } else {
             throw std::invalid_argument(
-                "Value for --json must be either pretty or raw.");
+                "Value for --json must be one of pretty, raw or ndjson.");
           }
         })
     (cmdline("--table"),
@@ -320,6 +323,11 @@ Shell_options::Shell_options(int argc, char **argv,
     (&storage.force, false, SHCORE_BATCH_CONTINUE_ON_ERROR, cmdline("--force"),
         "To use in SQL batch mode, forces processing to "
         "continue if an error is found.", shcore::opts::Read_only<bool>())
+    (&storage.batch_pipeline_size, 0, SHCORE_BATCH_PIPELINE_SIZE,
+        cmdline("--batch-pipeline-size=size"),
+        "To use in SQL batch mode, number of statements sent to the server "
+        "before reading their results. 0 disables pipelining.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
     (reinterpret_cast<int*>(&storage.log_level),
         ngcommon::Logger::LOG_INFO, "logLevel", cmdline("--log-level=value"),
         ngcommon::Logger::get_level_range_info(),
@@ -337,12 +345,19 @@ Shell_options::Shell_options(int argc, char **argv,
                 ngcommon::Logger::get_level_range_info());
           return nlog_level;
         })
+    (&storage.log_async, false, SHCORE_LOG_ASYNC, cmdline("--log-async"),
+        "Writes the log file from a background thread, logging does not wait "
+        "for the entries to be written.")
     (&storage.passwords_from_stdin, false, "passwordsFromStdin",
         cmdline("--passwords-from-stdin"),
         "Read passwords from stdin instead of the tty.")
     (&storage.show_warnings, true, SHCORE_SHOW_WARNINGS,
         cmdline("--show-warnings=<true|false>"),
         "Automatically display SQL warnings on SQL mode if available.")
+    (&storage.table_streaming_rows, 0, SHCORE_TABLE_STREAMING_ROWS,
+        "Number of rows used to size the columns of table output, remaining "
+        "rows are printed as they are fetched. 0 buffers the whole result.",
+        shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
     (&storage.history_max_size, 1000, SHCORE_HISTORY_MAX_SIZE,
         "Shell's history maximum size",
         shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
@@ -879,10 +894,10 @@ void Shell_options::check_port_socket_conflicts() {
 
 void Shell_options::set_output_format(const std::string &format) {
   if (format != "table" && format != "json" && format != "json/raw" &&
-      format != "vertical" && format != "tabbed") {
+      format != "ndjson" && format != "vertical" && format != "tabbed") {
     throw shcore::Exception::value_error(
         "The option " SHCORE_OUTPUT_FORMAT
-        " must be one of: tabbed, table, vertical, json or json/raw.");
+        " must be one of: tabbed, table, vertical, json, json/raw or ndjson.");
   }
 
   storage.output_format = format;
@@ -34,6 +34,7 @@
 #include "mysqlshdk/include/shellcore/base_shell.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "shellcore/interrupt_handler.h"
+#include "utils/utils_general.h"
 #include "utils/utils_string.h"
 
 #define MAX_DISPLAY_LENGTH 1024
@@ -299,6 +300,37 @@ class Field_formatter {
     m_max_mb_holes = std::max<size_t>(m_max_mb_holes, blength - dlength);
   }
 
+  /**
+   * Same as process(), but also drops the output buffer if it could be too
+   * small for the new value, used when rows are printed as they are fetched.
+   *
+   * @return true if the column got wider.
+   */
+  bool process_streamed(const shcore::Value &value) {
+    const size_t max_display_length = m_max_display_length;
+    const size_t max_buffer_length = m_max_buffer_length;
+    const size_t max_mb_holes = m_max_mb_holes;
+
+    process(value);
+
+    if (max_buffer_length != m_max_buffer_length ||
+        max_mb_holes != m_max_mb_holes ||
+        max_display_length != m_max_display_length) {
+      m_buffer.reset();
+    }
+
+    return max_display_length != m_max_display_length;
+  }
+
+  /**
+   * Makes the column at least `length` characters wide, used to size columns
+   * using metadata before any data is seen.
+   */
+  void reserve_display_length(size_t length) {
+    m_max_display_length = std::max(m_max_display_length, length);
+    m_max_buffer_length = std::max(m_max_buffer_length, length);
+  }
+
   ~Field_formatter() {}
 
   bool put(const shcore::Value &value) {
@@ -452,12 +484,23 @@ class Field_formatter {
   }
 };
 
+namespace {
+// JSON output is printed in parts of at least this size
+constexpr size_t k_json_buffer_size = 64 * 1024;
+
+void print_json(const std::string &json) {
+  mysqlsh::current_console()->print_json(json);
+}
+}  // namespace
+
 ResultsetDumper::ResultsetDumper(
     std::shared_ptr<mysqlsh::ShellBaseResult> target, bool buffer_data)
     : _resultset(target), _buffer_data(buffer_data), _cancelled(false) {
   _format = mysqlsh::current_shell_options()->get().output_format;
   _interactive = mysqlsh::current_shell_options()->get().interactive;
   _show_warnings = mysqlsh::current_shell_options()->get().show_warnings;
+  _table_streaming_rows =
+      mysqlsh::current_shell_options()->get().table_streaming_rows;
 }
 
 void ResultsetDumper::dump() {
@@ -475,7 +518,7 @@ void ResultsetDumper::dump() {
       _cancelled = true;
       return true;
     });
-    if (_format.find("json") == 0)
+    if (_format.find("json") != std::string::npos)
       dump_json();
     else
       dump_normal();
@@ -489,10 +532,57 @@ void ResultsetDumper::dump() {
 }
 
 void ResultsetDumper::dump_json() {
-  shcore::Value resultset(
-      std::static_pointer_cast<shcore::Object_bridge>(_resultset));
+  if (_format == "ndjson") {
+    dump_ndjson();
+    return;
+  }
+
+  // Rows are printed as they are fetched, result is never held as JSON text
+  shcore::JSON_dumper dumper(_format == "json");
+  dumper.set_output_handler(print_json, k_json_buffer_size);
+
+  // the document is still completed if printing of the rows is interrupted
+  _resultset->set_json_rows_interrupted([this]() { return _cancelled; });
+  shcore::on_leave_scope reset_interrupted(
+      [this]() { _resultset->set_json_rows_interrupted(nullptr); });
+
+  _resultset->append_json(dumper);
+
+  print_json(dumper.str() + "\n");
+}
+
+void ResultsetDumper::dump_ndjson() {
+  bool has_data = true;
 
-  mysqlsh::current_console()->print_value(resultset, "");
+  if (_resultset->has_member("hasData"))
+    has_data = _resultset->call("hasData", shcore::Argument_list()).as_bool();
+  else if (_resultset->class_name() == "Result")
+    has_data = false;
+
+  // Results without rows are printed as a single line object
+  if (!has_data) {
+    shcore::JSON_dumper dumper;
+    _resultset->append_json(dumper);
+    print_json(dumper.str() + "\n");
+    return;
+  }
+
+  std::string output;
+
+  while (!_cancelled) {
+    shcore::JSON_dumper dumper;
+
+    if (!_resultset->append_json_row(dumper)) break;
+
+    output.append(dumper.str()).append("\n");
+
+    if (output.size() >= k_json_buffer_size) {
+      print_json(output);
+      output.clear();
+    }
+  }
+
+  if (!output.empty()) print_json(output);
 }
 
 void ResultsetDumper::dump_normal() {
@@ -726,10 +816,66 @@ size_t ResultsetDumper::dump_vertical(shcore::Value::Array_type_ref records) {
   return records->size();
 }
 
+namespace {
+
+std::string table_separator(const std::vector<Field_formatter> &fmt) {
+  std::string separator("+");
+  for (const auto &field : fmt) {
+    std::string field_separator(field.get_max_display_length() + 2, '-');
+    field_separator.append("+");
+    separator.append(field_separator);
+  }
+  separator.append("\n");
+  return separator;
+}
+
+void print_table_header(const shcore::Value::Array_type &metadata,
+                        const std::vector<Field_formatter> &fmt,
+                        const std::string &separator) {
+  const size_t field_count = fmt.size();
+
+  // Prints the initial separator line and the column headers
+  // TODO: Consider the charset information on the length calculations
+  auto console = mysqlsh::current_console();
+  console->print(separator);
+  console->print("| ");
+  for (size_t index = 0; index < field_count; index++) {
+    std::string format = "%-";
+    format.append(std::to_string(fmt[index].get_max_display_length()));
+    format.append((index == field_count - 1) ? "s |\n" : "s | ");
+    auto column =
+        std::static_pointer_cast<mysqlsh::Column>(metadata.at(index).as_object());
+    console->print(
+        shcore::str_format(format.c_str(), column->get_column_label().c_str()));
+  }
+  console->print(separator);
+}
+
+void print_table_row(const mysqlsh::Row &row,
+                     std::vector<Field_formatter> *fmt) {
+  const size_t field_count = fmt->size();
+  auto console = mysqlsh::current_console();
+
+  console->print("| ");
+
+  for (size_t field_index = 0; field_index < field_count; field_index++) {
+    shcore::Value value(row.get_member(field_index));
+    if ((*fmt)[field_index].put(value)) {
+      console->print((*fmt)[field_index].c_str());
+    } else {
+      assert(value.type == shcore::String);
+      console->print(*value.value.s);
+    }
+    if (field_index < field_count - 1) console->print(" | ");
+  }
+  console->print(" |\n");
+}
+
+}  // namespace
+
 size_t ResultsetDumper::dump_table(shcore::Value::Array_type_ref records) {
   std::shared_ptr<shcore::Value::Array_type> metadata =
       _resultset->get_member("columns").as_array();
-  std::vector<std::string> columns;
   std::vector<Field_formatter> fmt;
 
   size_t field_count = metadata->size();
@@ -741,7 +887,6 @@ size_t ResultsetDumper::dump_table(shcore::Value::Array_type_ref records) {
     auto column = std::static_pointer_cast<mysqlsh::Column>(
         metadata->at(field_index).as_object());
 
-    columns.push_back(column->get_column_label());
     fmt.emplace_back(ResultFormat::TABLE, *column);
   }
 
@@ -757,54 +902,101 @@ size_t ResultsetDumper::dump_table(shcore::Value::Array_type_ref records) {
 
   //-----------
 
-  size_t index = 0;
+  std::string separator = table_separator(fmt);
+  print_table_header(*metadata, fmt, separator);
 
-  std::string separator("+");
-  for (index = 0; index < field_count; index++) {
-    std::string field_separator(fmt[index].get_max_display_length() + 2, '-');
-    field_separator.append("+");
-    separator.append(field_separator);
+  // Now prints the records
+  for (row_index = 0; row_index < records->size() && !_cancelled; row_index++) {
+    print_table_row(*(*records)[row_index].as_object<mysqlsh::Row>(), &fmt);
   }
-  separator.append("\n");
 
-  // Prints the initial separator line and the column headers
-  // TODO: Consider the charset information on the length calculations
-  auto console = mysqlsh::current_console();
-  console->print(separator);
-  console->print("| ");
-  for (index = 0; index < field_count; index++) {
-    std::string format = "%-";
-    format.append(std::to_string(fmt[index].get_max_display_length()));
-    format.append((index == field_count - 1) ? "s |\n" : "s | ");
+  mysqlsh::current_console()->print(separator);
+
+  return row_index;
+}
+
+size_t ResultsetDumper::dump_table_streaming(size_t sample_size) {
+  std::shared_ptr<shcore::Value::Array_type> metadata =
+      _resultset->get_member("columns").as_array();
+  std::vector<Field_formatter> fmt;
+
+  size_t field_count = metadata->size();
+  if (field_count == 0) return 0;
+
+  // Numeric columns are sized using the metadata, for the other ones only the
+  // sampled rows are used, as their metadata length is usually too big
+  for (size_t field_index = 0; field_index < field_count; field_index++) {
     auto column = std::static_pointer_cast<mysqlsh::Column>(
-        metadata->at(index).as_object());
-    console->print(
-        shcore::str_format(format.c_str(), column->get_column_label().c_str()));
+        metadata->at(field_index).as_object());
+
+    fmt.emplace_back(ResultFormat::TABLE, *column);
+
+    if (column->is_numeric()) {
+      fmt.back().reserve_display_length(column->get_length());
+    }
   }
-  console->print(separator);
 
-  // Now prints the records
-  for (row_index = 0; row_index < records->size() && !_cancelled; row_index++) {
-    console->print("| ");
+  const auto fetch_one = [this]() -> std::shared_ptr<mysqlsh::Row> {
+    shcore::Value record =
+        _resultset->call("fetchOne", shcore::Argument_list());
+    if (record.type != shcore::Object) return nullptr;
+    return record.as_object<mysqlsh::Row>();
+  };
 
-    auto row = (*records)[row_index].as_object<mysqlsh::Row>();
+  // Sizes the columns using the first rows
+  std::vector<std::shared_ptr<mysqlsh::Row>> sample;
+  sample.reserve(sample_size);
+
+  while (sample.size() < sample_size && !_cancelled) {
+    auto row = fetch_one();
+    if (!row) break;
 
     for (size_t field_index = 0; field_index < field_count; field_index++) {
-      shcore::Value value(row->get_member(field_index));
-      if (fmt[field_index].put(value)) {
-        console->print(fmt[field_index].c_str());
-      } else {
-        assert(value.type == shcore::String);
-        console->print(*value.value.s);
-      }
-      if (field_index < field_count - 1) console->print(" | ");
+      fmt[field_index].process(row->get_member(field_index));
     }
-    console->print(" |\n");
+
+    sample.emplace_back(std::move(row));
   }
 
-  console->print(separator.c_str());
+  if (_cancelled || sample.empty()) return 0;
 
-  return row_index;
+  std::string separator = table_separator(fmt);
+  print_table_header(*metadata, fmt, separator);
+
+  size_t row_count = 0;
+  for (; row_count < sample.size() && !_cancelled; row_count++) {
+    print_table_row(*sample[row_count], &fmt);
+    sample[row_count].reset();
+  }
+
+  sample.clear();
+
+  // Prints the remaining rows as they are fetched, if a value does not fit
+  // the column is widened and the header is printed again
+  while (!_cancelled) {
+    auto row = fetch_one();
+    if (!row) break;
+
+    bool widened = false;
+    for (size_t field_index = 0; field_index < field_count; field_index++) {
+      if (fmt[field_index].process_streamed(row->get_member(field_index)))
+        widened = true;
+    }
+
+    if (widened) {
+      // closes the rows printed so far before the wider header
+      mysqlsh::current_console()->print(separator);
+      separator = table_separator(fmt);
+      print_table_header(*metadata, fmt, separator);
+    }
+
+    print_table_row(*row, &fmt);
+    row_count++;
+  }
+
+  mysqlsh::current_console()->print(separator);
+
+  return row_count;
 }
 
 std::string ResultsetDumper::get_affected_stats(const std::string &legend) {
@@ -846,6 +1038,20 @@ int ResultsetDumper::get_warning_and_execution_time_stats(
 }
 
 void ResultsetDumper::dump_records(std::string &output_stats) {
+  // Buffered results are kept in memory anyway, there is no point in streaming
+  if (_format == "table" && _table_streaming_rows > 0 && !_buffer_data) {
+    size_t row_count = dump_table_streaming(_table_streaming_rows);
+
+    // when interrupted the result is not known to be empty, dump() reports
+    // the interruption
+    if (row_count || _cancelled)
+      output_stats = shcore::str_format("%zu %s in set", row_count,
+                                        (row_count == 1 ? "row" : "rows"));
+    else
+      output_stats = "Empty set";
+    return;
+  }
+
   shcore::Value records = _resultset->call("fetchAll", shcore::Argument_list());
   shcore::Value::Array_type_ref array_records = records.as_array();
 
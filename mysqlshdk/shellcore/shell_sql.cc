@@ -31,6 +31,8 @@
 #include "mysqlshdk/libs/utils/profiling.h"
 #include "shellcore/base_session.h"
 #include "shellcore/interrupt_handler.h"
+#include "shellcore/shell_options.h"
+#include "utils/utils_general.h"
 #include "utils/utils_string.h"
 
 REGISTER_HELP(CMD_G_UC_BRIEF,
@@ -129,6 +131,119 @@ bool Shell_sql::process_sql(const std::string &query_str,
   return ret_val;
 }
 
+bool Shell_sql::pipeline_sql(
+    const std::string &query_str,
+    mysql::splitter::Delimiters::delim_type_t delimiter,
+    std::shared_ptr<mysqlshdk::db::ISession> session) {
+  bool ret_val = true;
+
+  // statements are executed in the order they were given
+  if (!_pipeline.empty() &&
+      (_pipeline_size == 0 || session != _pipeline_session))
+    ret_val = flush_pipeline();
+
+  if (_pipeline_session && session != _pipeline_session) end_pipeline();
+
+  if (_pipeline_size > 0 && session && session->is_open()) {
+    _pipeline_session = session;
+    _pipeline.push_back({query_str, delimiter});
+
+    if (_pipeline.size() >= _pipeline_size && !flush_pipeline())
+      ret_val = false;
+  } else if (!process_sql(query_str, delimiter, session)) {
+    ret_val = false;
+  }
+
+  return ret_val;
+}
+
+bool Shell_sql::flush_pipeline() {
+  if (_pipeline.empty()) return true;
+
+  std::vector<Pipelined_statement> pipeline;
+  std::swap(pipeline, _pipeline);
+  const auto session = _pipeline_session;
+
+  std::vector<std::string> statements;
+  statements.reserve(pipeline.size());
+
+  for (const auto &stmt : pipeline) statements.push_back(stmt.sql);
+
+  bool ret_val = true;
+  std::unique_ptr<mysqlshdk::utils::Profile_timer> timer;
+
+  const auto callback = [&](size_t index,
+                            std::shared_ptr<mysqlshdk::db::IResult> result,
+                            const mysqlshdk::db::Error *error) {
+    const auto &stmt = pipeline[index];
+
+    timer->stage_end();
+
+    try {
+      if (error) {
+        throw shcore::Exception::mysql_error_with_code_and_state(
+            error->what(), error->code(), error->sqlstate());
+      }
+
+      Sql_result_info info;
+      if (stmt.delimiter == "\\G") info.show_vertical = true;
+      info.ellapsed_seconds = timer->total_seconds_ellapsed();
+
+      _result_processor(result, info);
+    } catch (shcore::Exception &exc) {
+      print_exception(exc);
+      ret_val = false;
+    }
+
+    _last_handled += stmt.sql + stmt.delimiter;
+
+    // time of the next statement is measured since its predecessor completed
+    timer.reset(new mysqlshdk::utils::Profile_timer());
+    timer->stage_begin("query");
+
+    return true;
+  };
+
+  try {
+    // Install kill query as ^C handler
+    uint64_t conn_id = session->get_connection_id();
+    const auto &conn_opts = session->get_connection_options();
+    Interrupts::push_handler([this, conn_id, conn_opts]() {
+      kill_query(conn_id, conn_opts);
+      return true;
+    });
+    shcore::Scoped_callback pop_handler([]() { Interrupts::pop_handler(); });
+
+    timer.reset(new mysqlshdk::utils::Profile_timer());
+    timer->stage_begin("query");
+
+    session->execute_pipelined(
+        statements, !mysqlsh::current_shell_options()->get().force, callback);
+  } catch (mysqlshdk::db::Error &e) {
+    print_exception(shcore::Exception::mysql_error_with_code_and_state(
+        e.what(), e.code(), e.sqlstate()));
+    ret_val = false;
+  }
+
+  if (0 == _pipeline_size) end_pipeline();
+
+  return ret_val;
+}
+
+void Shell_sql::set_pipeline_size(size_t size) {
+  _pipeline_size = size;
+
+  // pending statements end the run once they are flushed
+  if (0 == size && _pipeline.empty()) end_pipeline();
+}
+
+void Shell_sql::end_pipeline() {
+  if (_pipeline_session && _pipeline_session->is_open())
+    _pipeline_session->end_pipeline();
+
+  _pipeline_session.reset();
+}
+
 void Shell_sql::handle_input(std::string &code, Input_state &state) {
   state = Input_state::Ok;
   std::shared_ptr<mysqlshdk::db::ISession> session;
@@ -193,13 +308,13 @@ void Shell_sql::handle_input(std::string &code, Input_state &state) {
 
           _sql_cache.clear();
 
-          if (!process_sql(cached_query, ranges[range_index].get_delimiter(),
-                           session))
+          if (!pipeline_sql(cached_query, ranges[range_index].get_delimiter(),
+                            session))
             got_error = true;
         } else {
-          if (!process_sql(code.substr(ranges[range_index].offset(),
-                                       ranges[range_index].length()),
-                           ranges[range_index].get_delimiter(), session))
+          if (!pipeline_sql(code.substr(ranges[range_index].offset(),
+                                        ranges[range_index].length()),
+                            ranges[range_index].get_delimiter(), session))
             got_error = true;
         }
       }
@@ -22,6 +22,7 @@
  */
 
 #include "shellcore/utils_help.h"
+#include <algorithm>
 #include <cctype>
 #include <vector>
 #include "mysqlshdk/libs/textui/textui.h"
@@ -141,7 +142,18 @@ const char Help_registry::HELP_SQL[] = "SQL Syntax";
 
 Help_registry::Help_registry()
     : m_help_data(Help_registry::icomp), m_keywords(Help_registry::icomp) {
-  // The Contents category is registered right away since it is the root
+  // There are over two thousand static registrations
+  m_static_help.reserve(2048);
+  m_static_topics.reserve(1024);
+}
+
+void Help_registry::load_topics() {
+  if (m_topics_loaded) return;
+
+  // Set first, the registration functions call back into this one
+  m_topics_loaded = true;
+
+  // The Contents category is registered first since it is the root
   // Of the help system
   add_help_topic(HELP_ROOT, Topic_type::CATEGORY, "CONTENTS", "",
                  Mode_mask::all());
@@ -150,6 +162,23 @@ Help_registry::Help_registry()
   // at the client side but will be used as parent for SQL topics
   add_help_topic(HELP_SQL, Topic_type::SQL, "SQL_CONTENTS", HELP_ROOT,
                  Mode_mask::all());
+
+  // Topics are registered in the same order they were recorded, as orphans
+  // and class inheritance are resolved while registering
+  for (const auto &topic : m_static_topics) {
+    if (topic.upper_class)
+      add_help_class(topic.name, topic.parent, topic.upper_class);
+    else
+      add_help_topic(topic.name, topic.type, topic.tag, topic.parent,
+                     topic.mode);
+  }
+
+  std::vector<Static_topic>().swap(m_static_topics);
+
+  std::vector<std::function<void()>> deferred;
+  deferred.swap(m_deferred);
+
+  for (const auto &registration : deferred) registration();
 }
 
 bool Help_registry::icomp(const std::string &lhs, const std::string &rhs) {
@@ -166,11 +195,38 @@ void Help_registry::add_help(const std::string &token,
   m_help_data[token] = data;
 }
 
+void Help_registry::add_static_help(const char *token, const char *data) {
+  m_static_help.push_back({token, data});
+  m_static_help_sorted = false;
+}
+
+void Help_registry::add_static_topic(const char *name, Topic_type type,
+                                     const char *tag, const char *parent,
+                                     Mode_mask mode, const char *upper_class) {
+  if (m_topics_loaded) {
+    if (upper_class)
+      add_help_class(name, parent, upper_class);
+    else
+      add_help_topic(name, type, tag, parent, mode);
+  } else {
+    m_static_topics.push_back({name, type, tag, parent, mode, upper_class});
+  }
+}
+
+void Help_registry::defer(const std::function<void()> &registration) {
+  if (m_topics_loaded)
+    registration();
+  else
+    m_deferred.push_back(registration);
+}
+
 Help_topic *Help_registry::add_help_topic(const std::string &name,
                                           Topic_type type,
                                           const std::string &tag,
                                           const std::string &parent_id,
                                           Mode_mask mode) {
+  load_topics();
+
   size_t topic_count = m_topics.size();
   m_topics[topic_count] = {name, name, type, tag, nullptr, {}, this};
   Help_topic *new_topic = &m_topics[topic_count];
@@ -221,6 +277,8 @@ Help_topic *Help_registry::add_help_topic(const std::string &name,
 void Help_registry::add_help_class(const std::string &name,
                                    const std::string &parent,
                                    const std::string &upper_class) {
+  load_topics();
+
   Mode_mask mode(IShell_core::Mode::JavaScript);
   mode.set(IShell_core::Mode::Python);
 
@@ -461,6 +519,8 @@ void Help_registry::register_keywords(Help_topic *topic, Mode_mask mode) {
 void Help_registry::register_keyword(const std::string &keyword,
                                      Mode_mask context, Help_topic *topic,
                                      bool case_sensitive) {
+  load_topics();
+
   if (!case_sensitive) {
     if (m_keywords.find(keyword) == m_keywords.end()) {
       m_keywords[keyword] = {};
@@ -487,8 +547,28 @@ void Help_registry::register_keyword(const std::string &keyword,
 std::string Help_registry::get_token(const std::string &token) {
   std::string ret_val;
 
-  if (m_help_data.find(token) != m_help_data.end())
-    ret_val = m_help_data[token];
+  const auto data = m_help_data.find(token);
+
+  if (data != m_help_data.end()) {
+    ret_val = data->second;
+  } else {
+    const auto less = [](const Static_help &lhs, const Static_help &rhs) {
+      return str_casecmp(lhs.token, rhs.token) < 0;
+    };
+
+    if (!m_static_help_sorted) {
+      // Stable, so the last registration of a token is the last among equals
+      std::stable_sort(m_static_help.begin(), m_static_help.end(), less);
+      m_static_help_sorted = true;
+    }
+
+    const auto it = std::upper_bound(m_static_help.begin(), m_static_help.end(),
+                                     Static_help{token.c_str(), nullptr}, less);
+
+    if (it != m_static_help.begin() &&
+        str_casecmp((it - 1)->token, token.c_str()) == 0)
+      ret_val = (it - 1)->data;
+  }
 
   return ret_val;
 }
@@ -549,6 +629,8 @@ std::vector<Help_topic *> get_topics(const Iterable &topic_map,
 std::vector<Help_topic *> Help_registry::search_topics(
     const std::string &pattern, IShell_core::Mode_mask mode,
     bool case_sensitive) {
+  load_topics();
+
   // First searches on the case sensitive topics
   std::vector<Help_topic *> ret_val = get_topics(m_cs_keywords, pattern, mode);
 
@@ -567,6 +649,8 @@ std::vector<Help_topic *> Help_registry::search_topics(
 
 Help_topic *Help_registry::get_topic(const std::string &id,
                                      bool allow_unexisting) {
+  load_topics();
+
   if (m_keywords.find(id) == m_keywords.end()) {
     if (!allow_unexisting)
       throw std::logic_error("Unable to find topic '" + id + "'");
@@ -583,6 +667,8 @@ Help_topic *Help_registry::get_topic(const std::string &id,
 }
 
 Help_topic *Help_registry::get_class_parent(Help_topic *topic) {
+  load_topics();
+
   if (m_class_parents.find(topic) != m_class_parents.end())
     return m_class_parents.at(topic);
 
@@ -605,6 +605,8 @@ static void finalize_shell(std::shared_ptr<mysqlsh::Command_line_shell> shell) {
 #ifdef ENABLE_SESSION_RECORDING
   finalize_debug_shell(shell);
 #endif
+  // the background name cache refresh uses the client library
+  if (shell->provider_sql()) shell->provider_sql()->interrupt_rehash();
   mysqlsh::global_end();
 }
 
@@ -928,7 +928,8 @@ bool Mysql_shell::cmd_status(const std::vector<std::string> &UNUSED(args)) {
     (*status)["DELIMITER"] = shcore::Value(_shell->get_main_delimiter());
     std::string output_format = options().output_format;
 
-    if (output_format.find("json") == 0) {
+    if (output_format == "json" || output_format == "json/raw" ||
+        output_format == "ndjson") {
       println(shcore::Value(status).json(output_format == "json"));
     } else {
       const std::string format = "%-30s%s";
@@ -1172,12 +1173,14 @@ void Mysql_shell::refresh_completion(bool force) {
     if (session && _provider_sql && !current_schema.empty()) {
       // Only refresh the full DB name cache if we're in SQL mode
       if (_shell->interactive_mode() == shcore::IShell_core::Mode::SQL) {
+        // names are fetched in the background, the prompt is not blocked
         println("Fetching table and column names from `" + current_schema +
-                "` for auto-completion... Press ^C to stop.");
+                "` for auto-completion...");
         try {
+          // names saved by a previous run are stale after an explicit rehash
           _provider_sql->refresh_name_cache(session, current_schema,
                                             nullptr,  // &table_names,
-                                            true);
+                                            true, !force);
         } catch (std::exception &e) {
           handle_error(e);
         }
@@ -25,6 +25,8 @@
 #include "unittest/test_utils/mocks/gmock_clean.h"
 
 #include "mysqlsh/cmdline_shell.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "unittest/test_utils.h"
 
 namespace mysqlsh {
@@ -582,4 +584,83 @@ TEST_F(Completion_cache_refresh, options_db_name_cache) {
   MY_EXPECT_STDOUT_CONTAINS("Fetching table and column");
 }
 
+// Table and column names are fetched in the background and persisted, so
+// they're available right away the next time the schema is used
+TEST_F(Completion_cache_refresh, persisted_name_cache) {
+  _options->db_name_cache = true;
+  _options->devapi_schema_object_handles = true;
+
+  reset_shell(_uri + "/mysql", shcore::IShell_core::Mode::SQL);
+  MY_EXPECT_STDOUT_CONTAINS("Fetching table and column names from `mysql`");
+  _interactive_shell->provider_sql()->wait_name_cache_refresh();
+
+  const std::string server_uuid =
+      _interactive_shell->shell_context()->get_dev_session()->query_one_string(
+          "SELECT @@server_uuid");
+  const std::string cache = shcore::path::join_path(
+      shcore::get_user_config_path(), "name_cache", server_uuid, "mysql");
+
+  ASSERT_TRUE(shcore::file_exists(cache));
+  EXPECT_NE(std::string::npos,
+            shcore::get_text_file(cache).find("plugin\tname\n"));
+}
+
+// Names persisted by a previous run are not used after an explicit rehash
+TEST_F(Completion_cache_refresh, rehash_skips_persisted_name_cache) {
+  _options->db_name_cache = true;
+  _options->devapi_schema_object_handles = true;
+
+  reset_shell(_uri + "/mysql", shcore::IShell_core::Mode::SQL);
+  const auto provider = _interactive_shell->provider_sql();
+  provider->wait_name_cache_refresh();
+
+  const std::string server_uuid =
+      _interactive_shell->shell_context()->get_dev_session()->query_one_string(
+          "SELECT @@server_uuid");
+  const std::string cache = shcore::path::join_path(
+      shcore::get_user_config_path(), "name_cache", server_uuid, "mysql");
+
+  // names which do not exist in the schema
+  ASSERT_TRUE(shcore::create_file(cache, "stale_table\tstale_column\n"));
+
+  const auto complete = [&provider](const std::string &text) {
+    size_t offset = 0;
+    return provider->complete(text, &offset);
+  };
+
+  wipe_all();
+  execute("\\rehash");
+  MY_EXPECT_STDOUT_CONTAINS("Fetching table and column names from `mysql`");
+  EXPECT_TRUE(complete("stale_").empty());
+
+  provider->wait_name_cache_refresh();
+  EXPECT_TRUE(complete("stale_").empty());
+  EXPECT_EQ(std::vector<std::string>({"help_topic_id"}),
+            complete("help_topic_i"));
+}
+
+// An interrupted refresh is stopped before returning, the next one is not
+// affected by it
+TEST_F(Completion_cache_refresh, interrupt_name_cache_refresh) {
+  _options->db_name_cache = true;
+  _options->devapi_schema_object_handles = true;
+
+  reset_shell(_uri + "/mysql", shcore::IShell_core::Mode::SQL);
+  const auto provider = _interactive_shell->provider_sql();
+
+  wipe_all();
+  execute("\\rehash");
+  MY_EXPECT_STDOUT_CONTAINS("Fetching table and column names from `mysql`");
+  provider->interrupt_rehash();
+
+  wipe_all();
+  execute("\\rehash");
+  MY_EXPECT_STDOUT_CONTAINS("Fetching table and column names from `mysql`");
+  provider->wait_name_cache_refresh();
+
+  size_t offset = 0;
+  EXPECT_EQ(std::vector<std::string>({"help_topic_id"}),
+            provider->complete("help_topic_i", &offset));
+}
+
 }  // namespace mysqlsh
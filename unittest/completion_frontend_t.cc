@@ -216,6 +216,8 @@ class Completer_frontend : public Shell_core_test_wrapper {
       const std::string &line) {
     // refresh the prompt, which triggers auto-complete refresh
     _interactive_shell->prompt();
+    // table and column names are fetched in the background
+    _interactive_shell->provider_sql()->wait_name_cache_refresh();
 
     linenoiseCompletions lc;
 
@@ -27,7 +27,10 @@
 #include <string>
 #include <vector>
 
+#include "db/mysqlx/expr_cache.h"
 #include "db/mysqlx/expr_parser.h"
+#include "db/mysqlx/orderby_parser.h"
+#include "db/mysqlx/proj_parser.h"
 #include "gtest_clean.h"
 #include "scripting/types_cpp.h"
 
@@ -394,5 +397,78 @@ TEST(Expr_parser_tests, json_in) {
                         "(1 CONT_IN $.bla[*])", true);
 }
 
+TEST(Expr_parser_tests, cache) {
+  Expr_cache cache(2);
+  const std::string filter = "a = :x and b > :y";
+  const auto expected = [&filter](bool document_mode) {
+    Expr_parser parser(filter, document_mode);
+    return Expr_unparser::expr_to_string(*parser.expr());
+  };
+  std::vector<std::string> placeholders;
+  std::unique_ptr<Mysqlx::Expr::Expr> e;
+
+  // placeholders found by the parser are restored on a hit
+  for (int i = 0; i < 2; ++i) {
+    SCOPED_TRACE(i);
+    placeholders.clear();
+    e = cache.filter(filter, true, &placeholders);
+    EXPECT_EQ(expected(true), Expr_unparser::expr_to_string(*e));
+    EXPECT_EQ(std::vector<std::string>({"x", "y"}), placeholders);
+  }
+  EXPECT_EQ(1u, cache.hits());
+  EXPECT_EQ(1u, cache.misses());
+
+  // the parse mode is part of the key
+  e = cache.filter(filter, false, nullptr);
+  EXPECT_EQ(expected(false), Expr_unparser::expr_to_string(*e));
+  EXPECT_EQ(1u, cache.hits());
+  EXPECT_EQ(2u, cache.misses());
+  EXPECT_EQ(2u, cache.size());
+
+  // positions depend on the placeholders already known, cache is not used
+  placeholders = {"y"};
+  e = cache.filter(filter, true, &placeholders);
+  EXPECT_EQ(std::vector<std::string>({"y", "x"}), placeholders);
+  EXPECT_EQ(1u, cache.hits());
+  EXPECT_EQ(2u, cache.misses());
+
+  // invalid expressions are not cached
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_THROW(cache.filter("a = ", true, nullptr), Parser_error);
+  }
+  EXPECT_EQ(4u, cache.misses());
+
+  google::protobuf::RepeatedPtrField<Mysqlx::Crud::Order> orders;
+  Orderby_parser("name desc", true).parse(orders);
+  Mysqlx::Crud::Order order;
+  for (int i = 0; i < 2; ++i) {
+    cache.order("name desc", true, &order);
+    EXPECT_EQ(Expr_unparser::order_to_string(orders.Get(0)),
+              Expr_unparser::order_to_string(order));
+  }
+  EXPECT_EQ(2u, cache.hits());
+  EXPECT_EQ(5u, cache.misses());
+
+  google::protobuf::RepeatedPtrField<Mysqlx::Crud::Projection> projections;
+  Proj_parser("age + 1 as next", false, true).parse(projections);
+  Mysqlx::Crud::Projection projection;
+  for (int i = 0; i < 2; ++i) {
+    cache.projection("age + 1 as next", false, true, &projection);
+    EXPECT_EQ(Expr_unparser::column_to_string(projections.Get(0)),
+              Expr_unparser::column_to_string(projection));
+    EXPECT_EQ("next", projection.alias());
+  }
+  EXPECT_EQ(3u, cache.hits());
+  EXPECT_EQ(6u, cache.misses());
+
+  // least recently used expressions are dropped
+  EXPECT_EQ(2u, cache.size());
+  e = cache.filter(filter, false, nullptr);
+  EXPECT_EQ(7u, cache.misses());
+
+  cache.clear();
+  EXPECT_EQ(0u, cache.size());
+}
+
 };  // namespace expr_parser_tests
 };  // namespace shcore
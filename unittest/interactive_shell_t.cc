@@ -1367,6 +1367,23 @@ TEST_F(Interactive_shell_test, classic_sql_result) {
       "    \"autoIncrementValue\": 0\n"
       "}\n");
 
+  execute(to_scripting);
+  execute("shell.options['outputFormat']='ndjson'");
+  execute("\\sql");
+  wipe_all();
+
+  execute("select * from itst.tbl where a < 3;");
+  MY_EXPECT_STDOUT_CONTAINS(
+      "{\"a\":1,\"b\":\"one\",\"c\":-42,\"d\":42,\"e\":42,\"f\":42,"
+      "\"ggggg\":42,\"h\":42,\"i\":42.0}\n"
+      "{\"a\":2,\"b\":\"two\",\"c\":-12345,\"d\":12345,\"e\":12345,"
+      "\"f\":12345,\"ggggg\":123,\"h\":12345,\"i\":12345.0}\n");
+
+  // status is printed as a single line JSON document
+  wipe_all();
+  execute("\\status");
+  MY_EXPECT_STDOUT_CONTAINS("\"DELIMITER\":\";\"");
+
   execute("drop schema itst;");
 }
 
@@ -20,6 +20,8 @@
  * along with this program; if not, write to the Free Software Foundation, Inc.,
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
+#include <chrono>
+
 #include "modules/adminapi/mod_dba_common.h"
 #include "modules/adminapi/mod_dba_metadata_storage.h"
 #include "modules/adminapi/mod_dba_replicaset.h"
@@ -292,4 +294,44 @@ TEST_F(Dba_replicaset_test, bug28219398) {
 
   md_session->close();
 }
+
+TEST_F(Dba_replicaset_test, probe_members) {
+  std::vector<mysqlsh::dba::Instance_definition> instances(4);
+  instances[0].endpoint = "localhost:" + std::to_string(_mysql_sandbox_port1);
+  instances[0].state = "ONLINE";
+  // the X Plugin waits for the client to speak first, so a classic session
+  // never gets the server greeting from its port
+  instances[1].endpoint =
+      "localhost:" + std::to_string(_mysql_sandbox_port1 * 10);
+  instances[1].state = "RECOVERING";
+  instances[2].endpoint =
+      "localhost:" + std::to_string(_mysql_sandbox_port2 * 10);
+  instances[2].state = "OFFLINE";
+  instances[3].endpoint = "localhost:" + std::to_string(_mysql_sandbox_port2);
+  instances[3].state = "ONLINE";
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto states = mysqlsh::dba::probe_members(
+      instances, shcore::get_connection_options("root:root@localhost", false),
+      instances[3].endpoint, 2000);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // only the active members are asked, the one which did not respond is
+  // reported once its deadline expires
+  ASSERT_EQ(2u, states.size());
+  EXPECT_EQ("ONLINE", states.at(instances[0].endpoint));
+  EXPECT_EQ("UNREACHABLE", states.at(instances[1].endpoint));
+  EXPECT_LT(elapsed, std::chrono::seconds(10));
+}
+
+TEST_F(Dba_replicaset_test, status_of_reachable_members) {
+  auto status = m_cluster->call("status", shcore::Argument_list()).as_map();
+  auto topology = status->get_map("defaultReplicaSet")->get_map("topology");
+
+  ASSERT_FALSE(topology->empty());
+  for (const auto &member : *topology) {
+    SCOPED_TRACE(member.first);
+    EXPECT_EQ("ONLINE", member.second.as_map()->get_string("status"));
+  }
+}
 }  // namespace tests
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "unittest/gtest_clean.h"
+
+#include "modules/devapi/base_resultset.h"
+#include "mysqlshdk/libs/db/row_buffer.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::db::Type;
+
+TEST(Row, buffered_fields) {
+  auto fields = std::make_shared<Row_fields>(std::vector<std::string>{
+      "id", "firstName", "last name", "length", "note"});
+  auto buffer = std::make_shared<mysqlshdk::db::Row_buffer>();
+
+  for (int i = 0; i < 3; ++i) {
+    mysqlshdk::db::Mutable_row row(
+        {Type::Integer, Type::String, Type::String, Type::Integer,
+         Type::String});
+    row.set_row_values(i, "John" + std::to_string(i), std::string("Doe"),
+                       i * 10, nullptr);
+    buffer->append(row);
+  }
+
+  for (size_t i = 0; i < buffer->size(); ++i) {
+    SCOPED_TRACE(i);
+    Row row(fields, buffer, i);
+
+    EXPECT_EQ(5, row.get_length());
+    EXPECT_EQ(static_cast<int64_t>(i), row.get_member(0).as_int());
+    EXPECT_EQ("John" + std::to_string(i),
+              row.get_member("firstName").as_string());
+    EXPECT_EQ("Doe", row.get_field_("last name").as_string());
+    EXPECT_EQ(shcore::Null, row.get_member(4).type);
+    EXPECT_EQ(shcore::Null, row.get_member("note").type);
+    EXPECT_EQ(shcore::Undefined, row.get_member(5).type);
+
+    // the length field is hidden by the length property
+    EXPECT_EQ(5, row.get_member("length").as_int());
+    EXPECT_EQ(static_cast<int64_t>(i * 10), row.get_member(3).as_int());
+
+    EXPECT_TRUE(row.has_member("firstName"));
+    EXPECT_FALSE(row.has_member("last name"));
+    EXPECT_TRUE(row.has_member_advanced("first_name",
+                                        shcore::LowerCaseUnderscores));
+    EXPECT_FALSE(
+        row.has_member_advanced("first_name", shcore::LowerCamelCase));
+    EXPECT_EQ("John" + std::to_string(i),
+              row.get_member_advanced("first_name",
+                                      shcore::LowerCaseUnderscores)
+                  .as_string());
+
+    const auto members = row.get_members();
+    EXPECT_EQ((std::vector<std::string>{"length", "id", "firstName", "note"}),
+              std::vector<std::string>(members.begin(), members.begin() + 4));
+  }
+}
+
+TEST(Row, duplicated_field_names) {
+  auto fields =
+      std::make_shared<Row_fields>(std::vector<std::string>{"id", "a", "a"});
+  mysqlshdk::db::Mutable_row data({Type::Integer, Type::Integer, Type::Integer},
+                                  1, 2, 3);
+  Row row(fields, data);
+
+  EXPECT_EQ(3, row.get_length());
+  EXPECT_EQ(2, row.get_member("a").as_int());
+  EXPECT_EQ(3, row.get_member(2).as_int());
+
+  const auto members = row.get_members();
+  EXPECT_EQ((std::vector<std::string>{"length", "id", "a"}),
+            std::vector<std::string>(members.begin(), members.begin() + 3));
+  EXPECT_EQ(1, std::count(members.begin(), members.end(), "a"));
+}
+
+TEST(Row, add_item) {
+  Row row;
+  row.add_item("Level", shcore::Value("Warning"));
+  row.add_item("Code", shcore::Value(1287));
+
+  EXPECT_EQ(2, row.get_length());
+  EXPECT_EQ("Warning", row.get_member("Level").as_string());
+  EXPECT_EQ(1287, row.get_member(1).as_int());
+  EXPECT_TRUE(row.has_member("Code"));
+  std::string descr;
+  EXPECT_EQ("[\"Warning\",1287]", row.append_descr(descr));
+}
+
+}  // namespace mysqlsh
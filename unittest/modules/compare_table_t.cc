@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/compare_table.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/utils/diff.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+using Query_handler = std::function<std::shared_ptr<mysqlshdk::db::IResult>(
+    int port, const std::string &sql)>;
+
+/*
+ * Session which answers the queries without connecting to a server.
+ */
+class Fake_session : public mysqlshdk::db::mysql::Session {
+ public:
+  explicit Fake_session(const Query_handler &handler) : m_handler(handler) {}
+
+  void connect(const mysqlshdk::db::Connection_options &options) override {
+    m_port = options.get_port();
+  }
+
+  std::shared_ptr<mysqlshdk::db::IResult> query(const std::string &sql,
+                                                bool) override {
+    return m_handler(m_port, sql);
+  }
+
+  void execute(const std::string &) override {}
+
+  void close() override {}
+
+ private:
+  Query_handler m_handler;
+  int m_port = 0;
+};
+
+}  // namespace
+
+TEST(Compare_table, checksum_expression) {
+  EXPECT_EQ(
+      "BIT_XOR(CAST(CRC32(CONCAT_WS('#', CHAR_LENGTH(`id`), `id`, "
+      "CONCAT(ISNULL(`id`)))) AS UNSIGNED))",
+      checksum_expression({"id"}));
+
+  EXPECT_EQ(
+      "BIT_XOR(CAST(CRC32(CONCAT_WS('#', CHAR_LENGTH(`id`), `id`, "
+      "CHAR_LENGTH(`na``me`), `na``me`, CONCAT(ISNULL(`id`), "
+      "ISNULL(`na``me`)))) AS UNSIGNED))",
+      checksum_expression({"id", "na`me"}));
+}
+
+TEST(Compare_table, key_order_expression) {
+  EXPECT_EQ("`id`", key_order_expression("id", "int"));
+  EXPECT_EQ("`created`", key_order_expression("created", "datetime"));
+  EXPECT_EQ("`hash`", key_order_expression("hash", "varbinary"));
+  EXPECT_EQ("WEIGHT_STRING(`na``me`)",
+            key_order_expression("na`me", "varchar"));
+  EXPECT_EQ("WEIGHT_STRING(`name`)", key_order_expression("name", "char"));
+  EXPECT_EQ("`size` + 0", key_order_expression("size", "enum"));
+  EXPECT_EQ("`flags` + 0", key_order_expression("flags", "bit"));
+}
+
+TEST(Compare_table, merge_rows) {
+  using mysqlshdk::db::IRow;
+  using mysqlshdk::db::Mutable_result;
+  using mysqlshdk::db::Row_difference;
+  using mysqlshdk::db::Type;
+
+  // PRIMARY KEY (b, a), rows are fetched as (b, a, c), ordered by the key
+  const std::vector<Type> types = {Type::Integer, Type::Integer,
+                                   Type::Integer};
+  Mutable_result left(types);
+  left.append(1, 2, 0);
+  left.append(1, 3, 0);
+  left.append(2, 1, 0);
+  left.append(3, 0, 0);
+
+  Mutable_result right(types);
+  right.append(1, 2, 0);
+  right.append(1, 3, 5);
+  right.append(2, 1, 0);
+  right.append(2, 4, 0);
+
+  std::vector<std::string> differences;
+
+  mysqlshdk::db::find_different_rows_with_key_indexes(
+      &left, &right, {0, 1},
+      [&differences](const IRow *lrow, const IRow *rrow,
+                     Row_difference difference) {
+        const auto row = lrow ? lrow : rrow;
+        const auto key = row->get_as_string(0) + "," + row->get_as_string(1);
+
+        switch (difference) {
+          case Row_difference::Row_missing:
+            differences.emplace_back("missing " + key);
+            break;
+          case Row_difference::Row_added:
+            differences.emplace_back("added " + key);
+            break;
+          case Row_difference::Fields_differ:
+            differences.emplace_back("differs " + key);
+            break;
+          case Row_difference::Identical:
+            break;
+        }
+
+        return true;
+      });
+
+  EXPECT_EQ(
+      std::vector<std::string>({"differs 1,3", "added 2,4", "missing 3,0"}),
+      differences);
+}
+
+TEST(Compare_table, run) {
+  using mysqlshdk::db::Mutable_result;
+  using mysqlshdk::db::Type;
+
+  struct Row {
+    std::string name;
+    int id;
+    std::string value;
+  };
+
+  // PRIMARY KEY (name, id), rows of each instance are ordered by the key
+  const std::map<int, std::vector<Row>> rows = {
+      {3306,
+       {{"a", 1, "x"}, {"b", 1, "x"}, {"b", 2, "x"}, {"c", 1, "x"},
+        {"d", 1, "x"}}},
+      {3307,
+       {{"b", 1, "y"}, {"b", 2, "x"}, {"c", 1, "x"}, {"d", 1, "x"},
+        {"e", 1, "x"}}}};
+
+  // key is walked on the first instance, two rows per chunk
+  const std::map<std::string, std::vector<std::string>> boundaries = {
+      {"", {"b", "2"}},
+      {"(`name`, `id`) >= ('b', 2)", {"d", "1"}},
+      {"(`name`, `id`) >= ('d', 1)", {}}};
+
+  const std::vector<std::string> chunks = {
+      "(`name`, `id`) < ('b', 2)",
+      "(`name`, `id`) >= ('b', 2) AND (`name`, `id`) < ('d', 1)",
+      "(`name`, `id`) >= ('d', 1)"};
+
+  const auto chunk_of = [](const Row &row) -> size_t {
+    const auto key = std::make_pair(row.name, row.id);
+    if (key < std::make_pair(std::string("b"), 2)) return 0;
+    if (key < std::make_pair(std::string("d"), 1)) return 1;
+    return 2;
+  };
+
+  const auto handler = [&](int port, const std::string &sql)
+      -> std::shared_ptr<mysqlshdk::db::IResult> {
+    const auto where_begin = sql.find(" WHERE ");
+    const auto where_end = sql.find(" ORDER BY ");
+    const auto where =
+        where_begin == std::string::npos
+            ? std::string()
+            : sql.substr(where_begin + 7, where_end == std::string::npos
+                                              ? std::string::npos
+                                              : where_end - where_begin - 7);
+    const auto chunk = static_cast<size_t>(
+        std::find(chunks.begin(), chunks.end(), where) - chunks.begin());
+
+    if (sql.find("information_schema.columns") != std::string::npos) {
+      auto result = std::make_shared<Mutable_result>(
+          std::vector<Type>{Type::String, Type::String, Type::String});
+      result->append("name", "varchar(10)", "varchar");
+      result->append("id", "int(11)", "int");
+      result->append("value", "text", "text");
+      return result;
+    }
+
+    if (sql.find("information_schema.statistics") != std::string::npos) {
+      auto result =
+          std::make_shared<Mutable_result>(std::vector<Type>{Type::String});
+      result->append("name");
+      result->append("id");
+      return result;
+    }
+
+    if (shcore::str_beginswith(sql, "SELECT `name`, `id` FROM `s`.`t`") &&
+        shcore::str_endswith(sql, " ORDER BY `name`, `id` LIMIT 1 OFFSET 2") &&
+        3306 == port) {
+      auto result = std::make_shared<Mutable_result>(
+          std::vector<Type>{Type::String, Type::Integer});
+      const auto &boundary = boundaries.at(where);
+      if (!boundary.empty()) {
+        result->append(boundary[0], std::stoi(boundary[1]));
+      }
+      return result;
+    }
+
+    if (shcore::str_beginswith(sql, "SELECT COUNT(*), ") &&
+        chunk < chunks.size()) {
+      auto result = std::make_shared<Mutable_result>(
+          std::vector<Type>{Type::UInteger, Type::String});
+      int count = 0;
+      std::string checksum;
+      for (const auto &row : rows.at(port)) {
+        if (chunk_of(row) == chunk) {
+          ++count;
+          checksum += row.name + std::to_string(row.id) + row.value;
+        }
+      }
+      result->append(count, checksum);
+      return result;
+    }
+
+    if (shcore::str_beginswith(sql,
+                               "SELECT WEIGHT_STRING(`name`), `id`, `name`, "
+                               "`id`, `value` FROM `s`.`t` WHERE ") &&
+        shcore::str_endswith(sql, " ORDER BY `name`, `id`") &&
+        chunk < chunks.size()) {
+      auto result = std::make_shared<Mutable_result>(
+          std::vector<Type>{Type::Bytes, Type::Integer, Type::String,
+                            Type::Integer, Type::String});
+      for (const auto &row : rows.at(port)) {
+        if (chunk_of(row) == chunk) {
+          result->append(shcore::str_upper(row.name), row.id, row.name,
+                         row.id, row.value);
+        }
+      }
+      return result;
+    }
+
+    throw std::logic_error("Unexpected query: " + sql);
+  };
+
+  mysqlshdk::db::mysql::Session::set_factory_function(
+      [&handler]() { return std::make_shared<Fake_session>(handler); });
+  shcore::on_leave_scope reset_factory(
+      []() { mysqlshdk::db::mysql::Session::set_factory_function({}); });
+
+  mysqlshdk::db::Connection_options first("root@localhost:3306");
+  mysqlshdk::db::Connection_options second("root@localhost:3307");
+
+  Compare_table compare({first, second}, "s", "t");
+  compare.set_threads(2);
+  compare.set_rows_per_chunk(2);
+
+  std::vector<std::string> output;
+  compare.set_print_callback(
+      [&output](const std::string &msg) { output.emplace_back(msg); });
+
+  EXPECT_FALSE(compare.run());
+  EXPECT_EQ(std::vector<std::string>(
+                {"Computing checksums of 3 chunks using 2 threads...\n",
+                 "Row (name=a, id=1) is missing on localhost:3307\n",
+                 "Row (name=b, id=1) differs on localhost:3307 (value)\n",
+                 "Row (name=e, id=1) exists only on localhost:3307\n"}),
+            output);
+}
+
+TEST(Compare_table, arguments) {
+  mysqlshdk::db::Connection_options first("root@localhost:3306");
+  mysqlshdk::db::Connection_options second("root@localhost:3307");
+
+  EXPECT_THROW(Compare_table({first}, "schema", "table"),
+               std::invalid_argument);
+
+  Compare_table compare({first, second}, "schema", "table");
+  EXPECT_THROW(compare.set_threads(0), std::invalid_argument);
+  EXPECT_THROW(compare.set_rows_per_chunk(0), std::invalid_argument);
+  EXPECT_NO_THROW(compare.set_threads(2));
+  EXPECT_NO_THROW(compare.set_rows_per_chunk(10));
+}
+
+}  // namespace mysqlsh
@@ -36,10 +36,14 @@ class Collection_find : public Shell_core_test_wrapper {
   const std::string start_txn_stmt = "session.startTransaction();";
   const std::string lock_shared_fn = "lockShared";
   const std::string lock_exclusive_fn = "lockExclusive";
+  const std::string fetch_one_fn = "fetchOne";
+  const std::string var = "var ";
 #else
   const std::string start_txn_stmt = "session.start_transaction();";
   const std::string lock_shared_fn = "lock_shared";
   const std::string lock_exclusive_fn = "lock_exclusive";
+  const std::string fetch_one_fn = "fetch_one";
+  const std::string var = "";
 #endif
  public:
   virtual void set_options() {
@@ -614,4 +618,40 @@ TEST_F(Collection_find, lock_exclusive_skip_lock_constant) {
   execute("session.rollback();");
   _cout.str("");
 }
+
+TEST_F(Collection_find, prepared_statement) {
+  if (_target_server_version < mysqlshdk::utils::Version(8, 0, 14))
+    SKIP_TEST("X Protocol prepared statements are available since 8.0.14");
+
+  const auto print_status = [this](const std::string &name) {
+    execute("print('" + name +
+            ": ' + session.sql(\"select variable_value from "
+            "performance_schema.session_status where variable_name = '" +
+            name + "'\").execute()." + fetch_one_fn + "()[0]);");
+  };
+
+  // the statement is prepared by the second execution, the third one only
+  // executes it again using the same statement ID
+  execute(var + "stmt = col.find('_id = :id').bind('id', '1');");
+  for (int i = 0; i < 3; ++i) execute("stmt.execute();");
+
+  wipe_out();
+  print_status("Mysqlx_prep_prepare");
+  print_status("Mysqlx_prep_execute");
+  MY_EXPECT_STDOUT_CONTAINS("Mysqlx_prep_prepare: 1");
+  MY_EXPECT_STDOUT_CONTAINS("Mysqlx_prep_execute: 2");
+
+  // each statement object prepares its own statement
+  execute(var + "stmt2 = col.find('_id = :id').bind('id', '2');");
+  for (int i = 0; i < 2; ++i) execute("stmt2.execute();");
+  execute("stmt.execute();");
+
+  wipe_out();
+  print_status("Mysqlx_prep_prepare");
+  print_status("Mysqlx_prep_execute");
+  MY_EXPECT_STDOUT_CONTAINS("Mysqlx_prep_prepare: 2");
+  MY_EXPECT_STDOUT_CONTAINS("Mysqlx_prep_execute: 4");
+
+  _cout.str("");
+}
 }  // namespace tests
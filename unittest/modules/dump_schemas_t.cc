@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/dump_schemas.h"
+
+namespace mysqlsh {
+
+TEST(Dump_schemas, append_escaped_field) {
+  const auto escape = [](const std::string &field) {
+    std::string out = "x";
+    append_escaped_field(field.data(), field.length(), &out);
+    return out;
+  };
+
+  EXPECT_EQ("x", escape(""));
+  EXPECT_EQ("xabc", escape("abc"));
+  EXPECT_EQ("x\\\\N", escape("\\N"));
+  EXPECT_EQ("xa\\tb\\nc\\rd", escape("a\tb\nc\rd"));
+  EXPECT_EQ("x\\0\\Z\\\\", escape(std::string("\0\032\\", 3)));
+  EXPECT_EQ("x\"'\xe2\x82\xac", escape("\"'\xe2\x82\xac"));
+}
+
+TEST(Dump_schemas, encode_file_name) {
+  EXPECT_EQ("sakila", encode_file_name("sakila"));
+  EXPECT_EQ("film_text-2", encode_file_name("film_text-2"));
+  EXPECT_EQ("a%40b%2Ec%20d", encode_file_name("a@b.c d"));
+  EXPECT_EQ("%2F%5C%25", encode_file_name("/\\%"));
+  EXPECT_EQ("%C5%BC", encode_file_name("\xc5\xbc"));
+}
+
+TEST(Dump_schemas, is_generated_column) {
+  EXPECT_FALSE(is_generated_column(""));
+  EXPECT_FALSE(is_generated_column("auto_increment"));
+  EXPECT_TRUE(is_generated_column("VIRTUAL GENERATED"));
+  EXPECT_TRUE(is_generated_column("STORED GENERATED"));
+  EXPECT_TRUE(is_generated_column("virtual generated"));
+
+  // DEFAULT CURRENT_TIMESTAMP and expression defaults in 8.0
+  EXPECT_FALSE(is_generated_column("DEFAULT_GENERATED"));
+  EXPECT_FALSE(
+      is_generated_column("DEFAULT_GENERATED on update CURRENT_TIMESTAMP"));
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+#include <vector>
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/import_table.h"
+
+namespace mysqlsh {
+
+namespace {
+
+std::vector<std::string> split_rows(const std::string &data,
+                                    const Import_table_dialect &dialect) {
+  Row_end_scanner scanner(dialect);
+  std::vector<std::string> rows;
+  size_t begin = 0;
+
+  while (begin < data.size()) {
+    auto end =
+        scanner.next_row_end(data.data() + begin, data.size() - begin, 1);
+    if (std::string::npos == end) end = data.size() - begin;
+    scanner.consume(end);
+    rows.emplace_back(data.substr(begin, end));
+    begin += end;
+  }
+
+  return rows;
+}
+
+}  // namespace
+
+TEST(Import_table, row_end_scanner_default) {
+  const auto dialect = Import_table_dialect::from_name("default");
+
+  EXPECT_EQ((std::vector<std::string>{"1\ta\n", "2\tb\\\nc\n", "3\t\"d\n",
+                                      "\"\n", "4"}),
+            split_rows("1\ta\n2\tb\\\nc\n3\t\"d\n\"\n4", dialect));
+}
+
+TEST(Import_table, row_end_scanner_csv) {
+  const auto dialect = Import_table_dialect::from_name("csv");
+
+  EXPECT_EQ(
+      (std::vector<std::string>{"1,\"a\r\nb\"\r\n", "2,\"c\"\"\r\n\"\r\n",
+                                "3,d\"e\r\n", "4,\"f\\\"\r\n\"\r\n"}),
+      split_rows("1,\"a\r\nb\"\r\n2,\"c\"\"\r\n\"\r\n3,d\"e\r\n"
+                 "4,\"f\\\"\r\n\"\r\n",
+                 dialect));
+}
+
+TEST(Import_table, row_end_scanner_min_offset) {
+  const auto dialect = Import_table_dialect::from_name("csv-unix");
+  std::string data = "1,a\n2,b\n3,c\n4,d\n";
+  Row_end_scanner scanner(dialect);
+
+  EXPECT_EQ(8, scanner.next_row_end(data.data(), data.size(), 5));
+  scanner.consume(8);
+  EXPECT_EQ(std::string::npos,
+            scanner.next_row_end(data.data() + 8, data.size() - 8, 10));
+
+  // scan continues where it stopped
+  data += "5,e\n";
+  EXPECT_EQ(12, scanner.next_row_end(data.data() + 8, data.size() - 8, 10));
+}
+
+TEST(Import_table, row_end_scanner_appended_data) {
+  auto dialect = Import_table_dialect::from_name("csv");
+  Row_end_scanner scanner(dialect);
+  std::string data = "1,\"a\r";
+
+  // terminator, enclosure or escape at the end of data needs more bytes
+  EXPECT_EQ(std::string::npos,
+            scanner.next_row_end(data.data(), data.size(), 1));
+  data += "\n\"";
+  EXPECT_EQ(std::string::npos,
+            scanner.next_row_end(data.data(), data.size(), 1));
+  data += "\r";
+  EXPECT_EQ(std::string::npos,
+            scanner.next_row_end(data.data(), data.size(), 1));
+  data += "\n2";
+  EXPECT_EQ(9, scanner.next_row_end(data.data(), data.size(), 1));
+}
+
+TEST(Import_table, dialect) {
+  EXPECT_THROW(Import_table_dialect::from_name("xml"), std::invalid_argument);
+
+  Import_table_dialect dialect;
+  EXPECT_NO_THROW(dialect.validate());
+
+  dialect.lines_terminated_by = "";
+  EXPECT_THROW(dialect.validate(), std::invalid_argument);
+
+  dialect = Import_table_dialect::from_name("tsv");
+  EXPECT_EQ("\t", dialect.fields_terminated_by);
+  dialect.fields_enclosed_by = "''";
+  EXPECT_THROW(dialect.validate(), std::invalid_argument);
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/json_importer.h"
+#include "mysqlshdk/libs/utils/utils_buffered_input.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+
+namespace {
+
+class Recording_consumer : public Document_consumer {
+ public:
+  explicit Recording_consumer(const std::string &fail_on = "")
+      : m_fail_on(fail_on) {}
+
+  void begin() override { ++begun; }
+
+  void consume(const shcore::Input_span &document) override {
+    if (!m_fail_on.empty() && document.str() == m_fail_on)
+      throw std::runtime_error("Duplicate entry");
+    documents.emplace_back(document.str());
+  }
+
+  void end() override { ++ended; }
+
+  void abort() override { ++aborted; }
+
+  std::vector<std::string> documents;
+  int begun = 0;
+  int ended = 0;
+  int aborted = 0;
+
+ private:
+  std::string m_fail_on;
+};
+
+}  // namespace
+
+class Distribute_documents_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_path = shcore::path::join_path(getenv("TMPDIR"),
+                                     "distribute_documents_test.json");
+
+    std::string contents;
+    for (int i = 0; i < k_documents; ++i) {
+      m_documents.emplace_back("{\"_id\": " + std::to_string(i) +
+                               ", \"v\": \"" + std::string(100, 'x') + "\"}");
+      contents += m_documents.back() + "\n";
+    }
+    shcore::create_file(m_path, contents);
+  }
+
+  void TearDown() override { shcore::delete_file(m_path); }
+
+  bool distribute(const std::vector<Document_consumer *> &consumers,
+                  size_t chunk_bytes, int *chunks = nullptr) {
+    shcore::Buffered_input input;
+    input.open(m_path);
+    int queued = 0;
+    const auto result =
+        distribute_documents(&input, false, chunk_bytes, consumers,
+                             [&queued]() { ++queued; });
+    if (chunks) *chunks = queued;
+    return result;
+  }
+
+  static constexpr int k_documents = 1000;
+  std::string m_path;
+  std::vector<std::string> m_documents;
+};
+
+constexpr int Distribute_documents_test::k_documents;
+
+TEST_F(Distribute_documents_test, every_document_consumed_once) {
+  std::vector<Recording_consumer> consumers(4);
+  std::vector<Document_consumer *> ptrs;
+  for (auto &c : consumers) ptrs.emplace_back(&c);
+
+  int chunks = 0;
+  EXPECT_TRUE(distribute(ptrs, 1024, &chunks));
+
+  // each document takes ~120 bytes, so a chunk holds 9 of them
+  EXPECT_EQ(k_documents / 9, chunks);
+
+  std::vector<std::string> all;
+  int partial_chunks = 0;
+  for (const auto &c : consumers) {
+    EXPECT_EQ(1, c.begun);
+    EXPECT_EQ(1, c.ended);
+    EXPECT_EQ(0, c.aborted);
+    // documents are never split between chunks, only the last one is short
+    if (c.documents.size() % 9 != 0) {
+      ++partial_chunks;
+      EXPECT_EQ(k_documents % 9, c.documents.size() % 9);
+    }
+    all.insert(all.end(), c.documents.begin(), c.documents.end());
+  }
+  EXPECT_EQ(1, partial_chunks);
+
+  std::sort(all.begin(), all.end());
+  auto expected = m_documents;
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(expected, all);
+}
+
+TEST_F(Distribute_documents_test, single_consumer_keeps_order) {
+  Recording_consumer consumer;
+  EXPECT_TRUE(distribute({&consumer}, 4096));
+
+  EXPECT_EQ(m_documents, consumer.documents);
+  EXPECT_EQ(1, consumer.ended);
+}
+
+TEST_F(Distribute_documents_test, consumer_error) {
+  // whichever consumer gets this document fails
+  std::vector<Recording_consumer> consumers(4, Recording_consumer(
+                                                   m_documents[500]));
+  std::vector<Document_consumer *> ptrs;
+  for (auto &c : consumers) ptrs.emplace_back(&c);
+
+  try {
+    distribute(ptrs, 512);
+    FAIL() << "Expected exception";
+  } catch (const std::runtime_error &e) {
+    EXPECT_STREQ("Duplicate entry", e.what());
+  }
+
+  // none of the consumers commits once any of them failed
+  size_t consumed = 0;
+  for (const auto &c : consumers) {
+    EXPECT_EQ(1, c.begun);
+    EXPECT_EQ(0, c.ended);
+    EXPECT_EQ(1, c.aborted);
+    consumed += c.documents.size();
+  }
+  EXPECT_GT(static_cast<size_t>(k_documents), consumed);
+}
+
+}  // namespace mysqlsh
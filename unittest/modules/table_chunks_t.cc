@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <atomic>
+#include <string>
+#include <vector>
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/table_chunks.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+
+namespace mysqlsh {
+namespace table_chunks {
+
+TEST(Table_chunks, split_on_boundaries) {
+  EXPECT_EQ(std::vector<std::string>({""}),
+            split_on_boundaries({"a", "b"}, {}));
+
+  EXPECT_EQ(std::vector<std::string>({"`name` < 'k'", "`name` >= 'k'"}),
+            split_on_boundaries({"name"}, {{"'k'"}}));
+
+  EXPECT_EQ(std::vector<std::string>(
+                {"(`a`, `b`) < (1, 'x')",
+                 "(`a`, `b`) >= (1, 'x') AND (`a`, `b`) < (2, X'00ff')",
+                 "(`a`, `b`) >= (2, X'00ff')"}),
+            split_on_boundaries({"a", "b"}, {{"1", "'x'"}, {"2", "X'00ff'"}}));
+}
+
+TEST(Table_chunks, walk_key) {
+  testing::Mock_session session;
+  const std::vector<std::string> names = {"a", "b"};
+  const std::vector<mysqlshdk::db::Type> types = {mysqlshdk::db::Type::Integer,
+                                                  mysqlshdk::db::Type::String};
+  const std::string select = "SELECT `a`, HEX(`b`) FROM `db`.`t`";
+  const std::string limit = " ORDER BY `a`, `b` LIMIT 1 OFFSET 2";
+
+  // each walk starts from the previous boundary, binary values are read as
+  // hex literals
+  const std::vector<std::string> queries = {
+      select + limit, select + " WHERE (`a`, `b`) >= (1, X'00FF')" + limit,
+      select + " WHERE (`a`, `b`) >= (3, X'61')" + limit};
+  const std::vector<std::vector<std::vector<std::string>>> rows = {
+      {{"1", "00FF"}}, {{"3", "61"}}, {}};
+
+  for (size_t i = 0; i < queries.size(); ++i) {
+    session.expect_query(queries[i])
+        .then_return({{queries[i], names, types, rows[i]}});
+  }
+
+  std::atomic<bool> interrupted{false};
+  EXPECT_EQ(std::vector<std::vector<std::string>>(
+                {{"1", "X'00FF'"}, {"3", "X'61'"}}),
+            walk_key(&session, "db", "t", {"a", "b"}, {"int", "varbinary"}, 2,
+                     interrupted));
+
+  // nothing is read once interrupted
+  interrupted = true;
+  EXPECT_TRUE(walk_key(&session, "db", "t", {"a"}, {"int"}, 2, interrupted)
+                  .empty());
+}
+
+}  // namespace table_chunks
+}  // namespace mysqlsh
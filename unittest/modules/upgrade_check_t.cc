@@ -606,6 +606,72 @@ TEST_F(MySQL_upgrade_check_test, check_table_command) {
   EXPECT_TRUE(issues.size() == 1 && issues[0].table == "part");
 }
 
+TEST_F(MySQL_upgrade_check_test, check_table_command_parallel) {
+  if (_target_server_version < Version(5, 7, 0) ||
+      _target_server_version >= Version(8, 0, 0))
+    SKIP_TEST("This test requires running against MySQL server version 5.7");
+  PrepareTestDatabase("mysql_check_table_test");
+
+  ASSERT_NO_THROW(
+      session->execute("create table part(i integer) engine=myisam partition "
+                       "by range(i) (partition p0 values less than (1000), "
+                       "partition p1 values less than MAXVALUE);"));
+  ASSERT_NO_THROW(
+      session->execute("create table part2(i integer) engine=myisam partition "
+                       "by range(i) (partition p0 values less than (1000), "
+                       "partition p1 values less than MAXVALUE);"));
+  ASSERT_NO_THROW(session->execute("create table big(i integer)"));
+  ASSERT_NO_THROW(session->execute("insert into big values (1), (2), (3)"));
+
+  Check_table_command check;
+  std::vector<Upgrade_issue> serial;
+  ASSERT_NO_THROW(serial = check.run(session));
+  ASSERT_EQ(2, serial.size());
+
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+  for (int i = 0; i < 3; ++i) {
+    auto s = mysqlshdk::db::mysql::Session::create();
+    s->connect(shcore::get_connection_options(_mysql_uri));
+    sessions.push_back(s);
+  }
+
+  // issues are reported in the same order, regardless of the table sizes
+  std::vector<Upgrade_issue> parallel;
+  ASSERT_NO_THROW(parallel = check.run(sessions));
+  ASSERT_EQ(serial.size(), parallel.size());
+  for (size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(serial[i].table, parallel[i].table);
+    EXPECT_EQ(serial[i].description, parallel[i].description);
+  }
+
+  for (size_t i = 1; i < sessions.size(); ++i) sessions[i]->close();
+}
+
+TEST_F(MySQL_upgrade_check_test, threads_option) {
+  if (_target_server_version < Version(5, 7, 0) ||
+      _target_server_version >= Version(8, 0, 0))
+    SKIP_TEST("This test requires running against MySQL server version 5.7");
+  Util util(_interactive_shell->shell_context().get());
+  shcore::Argument_list args;
+  args.push_back(shcore::Value(_mysql_uri));
+  shcore::Value::Map_type_ref opts(new shcore::Value::Map_type());
+  args.push_back(shcore::Value(opts));
+
+  EXPECT_NO_THROW(util.check_for_server_upgrade(args));
+  const std::string serial = output_handler.std_out;
+  output_handler.wipe_out();
+
+  // the report is the same, the checks just run in parallel
+  opts->set("threads", shcore::Value(4));
+  EXPECT_NO_THROW(util.check_for_server_upgrade(args));
+  EXPECT_EQ(serial, output_handler.std_out);
+  output_handler.wipe_out();
+
+  opts->set("threads", shcore::Value(0));
+  EXPECT_THROW_LIKE(util.check_for_server_upgrade(args), shcore::Exception,
+                    "Number of threads must be a positive integer value.");
+}
+
 TEST_F(MySQL_upgrade_check_test, corner_cases_of_upgrade_check) {
   if (_target_server_version < Version(5, 7, 0) ||
       _target_server_version >= Version(8, 0, 0))
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/worker_threads.h"
+
+namespace mysqlsh {
+
+TEST(Worker_threads, validate_threads) {
+  EXPECT_NO_THROW(validate_threads(1));
+  EXPECT_NO_THROW(validate_threads(64));
+
+  for (const int64_t threads : {0, -1}) {
+    try {
+      validate_threads(threads);
+      ADD_FAILURE() << "Expected exception for " << threads;
+    } catch (const std::invalid_argument &e) {
+      EXPECT_STREQ("Number of threads must be a positive integer value.",
+                   e.what());
+    }
+  }
+}
+
+TEST(Worker_threads, all_workers_run) {
+  std::atomic<int> runs{0};
+
+  Worker_threads threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.start([&runs]() { ++runs; });
+  }
+
+  EXPECT_NO_THROW(threads.wait());
+  EXPECT_EQ(4, runs);
+}
+
+TEST(Worker_threads, first_error_stops_workers) {
+  std::atomic<bool> interrupted{false};
+  std::atomic<int> on_error_calls{0};
+
+  {
+    Worker_threads threads(&interrupted);
+    threads.set_on_error([&on_error_calls]() { ++on_error_calls; });
+
+    // waits until it is stopped by the failure of the other worker
+    threads.start([&interrupted]() {
+      while (!interrupted) std::this_thread::yield();
+    });
+    threads.start([]() { throw std::runtime_error("first"); });
+
+    try {
+      threads.wait();
+      ADD_FAILURE() << "Expected exception";
+    } catch (const std::runtime_error &e) {
+      EXPECT_STREQ("first", e.what());
+    }
+  }
+
+  EXPECT_TRUE(interrupted);
+  EXPECT_EQ(1, on_error_calls);
+}
+
+TEST(Worker_threads, error_kept_after_join) {
+  Worker_threads threads;
+  threads.start([]() { throw std::logic_error("failed"); });
+
+  // stats are collected after join(), wait() still reports the error
+  threads.join();
+  EXPECT_THROW(threads.wait(), std::logic_error);
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/row_buffer.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+TEST(Row_buffer, append_and_read) {
+  Row_buffer buffer;
+  const std::vector<Type> types{Type::Integer, Type::UInteger, Type::Double,
+                                Type::String, Type::Decimal, Type::Json};
+
+  EXPECT_TRUE(buffer.empty());
+
+  for (int i = 0; i < 100; ++i) {
+    Mutable_row row(types);
+    if (i % 10 == 0) {
+      row.set_row_values(-i, nullptr, 0.5, nullptr, nullptr, nullptr);
+    } else {
+      row.set_row_values(-i, static_cast<uint64_t>(i), 0.5 * i,
+                         std::to_string(i), std::string("12"),
+                         std::string("{\"a\": 1}"));
+    }
+    buffer.append(row);
+  }
+
+  ASSERT_EQ(100, buffer.size());
+
+  for (int i = 0; i < 100; ++i) {
+    SCOPED_TRACE(i);
+    const auto cursor = buffer.row(i);
+    const IRow *row = &cursor;
+    ASSERT_EQ(6, row->num_fields());
+    EXPECT_EQ(Type::String, row->get_type(3));
+    EXPECT_EQ(-i, row->get_int(0));
+
+    if (i % 10 == 0) {
+      EXPECT_EQ(0.5, row->get_double(2));
+      EXPECT_TRUE(row->is_null(1));
+      EXPECT_TRUE(row->is_null(3));
+      EXPECT_EQ("NULL", row->get_as_string(4));
+      EXPECT_THROW(row->get_string(3), std::invalid_argument);
+    } else {
+      EXPECT_EQ(i, row->get_uint(1));
+      EXPECT_EQ(0.5 * i, row->get_double(2));
+      EXPECT_EQ(std::to_string(i), row->get_string(3));
+      auto data = row->get_string_data(3);
+      EXPECT_EQ(std::to_string(i), std::string(data.first, data.second));
+      EXPECT_EQ(12, row->get_int(4));
+      EXPECT_EQ(12.0, row->get_double(4));
+      EXPECT_EQ("{\"a\": 1}", row->get_string(5));
+      EXPECT_THROW(row->get_string_data(5), std::invalid_argument);
+      EXPECT_THROW(row->get_int(3), std::invalid_argument);
+    }
+  }
+
+  EXPECT_THROW(buffer.row(100), std::out_of_range);
+  EXPECT_THROW(buffer.row(0).get_int(6), std::invalid_argument);
+
+  const size_t used = buffer.memory_usage();
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_GT(used, buffer.memory_usage());
+}
+
+TEST(Row_buffer, layout_mismatch) {
+  Row_buffer buffer;
+  Mutable_row row({Type::Integer, Type::String}, 1, std::string("one"));
+  Mutable_row other({Type::Integer}, 2);
+
+  buffer.append(row);
+  EXPECT_THROW(buffer.append(other), std::invalid_argument);
+  EXPECT_EQ(1, buffer.size());
+  EXPECT_EQ("one", buffer.row(0).get_string(1));
+}
+
+TEST(Row_buffer, independent_rows) {
+  Row_buffer buffer;
+
+  for (int i = 0; i < 3; ++i) {
+    buffer.append(
+        Mutable_row({Type::Integer, Type::String}, i, std::to_string(i)));
+  }
+
+  // each view keeps referring to its own row
+  const auto first = buffer.row(0);
+  const auto last = buffer.row(2);
+  auto copy = first;
+
+  EXPECT_EQ(0, first.get_int(0));
+  EXPECT_EQ("2", last.get_string(1));
+  EXPECT_EQ("0", copy.get_string(1));
+
+  copy = buffer.row(1);
+  EXPECT_EQ(1, copy.get_int(0));
+  EXPECT_EQ(0, first.get_int(0));
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
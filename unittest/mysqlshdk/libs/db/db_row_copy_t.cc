@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+#include <vector>
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+TEST(Row_copy, copy_fields) {
+  const std::vector<Type> types{Type::Integer, Type::UInteger, Type::Float,
+                                Type::Double,  Type::String,   Type::Decimal,
+                                Type::Bytes,   Type::Json};
+  Mutable_row source(types, -5, static_cast<uint64_t>(7), 1.5f, 2.25,
+                     std::string("text"), std::string("12.50"), nullptr,
+                     std::string("{}"));
+  Row_copy copy(source);
+
+  ASSERT_EQ(8, copy.num_fields());
+  EXPECT_EQ(Type::Double, copy.get_type(3));
+  EXPECT_EQ(-5, copy.get_int(0));
+  EXPECT_EQ(7, copy.get_uint(1));
+  EXPECT_EQ(1.5f, copy.get_float(2));
+  EXPECT_EQ(2.25, copy.get_double(3));
+  EXPECT_EQ("text", copy.get_string(4));
+  auto data = copy.get_string_data(4);
+  EXPECT_EQ("text", std::string(data.first, data.second));
+  EXPECT_EQ("12.50", copy.get_as_string(5));
+  EXPECT_EQ(12.5, copy.get_double(5));
+  EXPECT_TRUE(copy.is_null(6));
+  EXPECT_EQ("NULL", copy.get_as_string(6));
+  EXPECT_THROW(copy.get_string(6), std::invalid_argument);
+  EXPECT_EQ("{}", copy.get_string(7));
+  EXPECT_THROW(copy.get_string_data(7), std::invalid_argument);
+  EXPECT_THROW(copy.get_int(4), std::invalid_argument);
+  EXPECT_THROW(copy.get_type(8), std::invalid_argument);
+}
+
+TEST(Row_copy, shared_layout) {
+  Mutable_row first({Type::Integer, Type::String}, 1, std::string("one"));
+  Mutable_row second({Type::Integer, Type::String}, 2, std::string("two"));
+  Mutable_row other({Type::String}, std::string("three"));
+
+  Row_copy row1(first);
+  Row_copy row2(second, row1);
+  Row_copy row3(other, row1);
+
+  EXPECT_EQ("one", row1.get_string(1));
+  EXPECT_EQ(2, row2.get_int(0));
+  EXPECT_EQ("two", row2.get_string(1));
+  EXPECT_EQ(1, row3.num_fields());
+  EXPECT_EQ(Type::String, row3.get_type(0));
+  EXPECT_EQ("three", row3.get_string(0));
+
+  // adding a field does not change the layout of the other rows
+  row2.add_field(Type::Double, 1);
+  EXPECT_EQ(3, row2.num_fields());
+  EXPECT_EQ(Type::Double, row2.get_type(1));
+  EXPECT_TRUE(row2.is_null(1));
+  EXPECT_EQ("two", row2.get_string(2));
+  EXPECT_EQ(2, row1.num_fields());
+  EXPECT_EQ(Type::String, row1.get_type(1));
+}
+
+TEST(Row_copy, overwrite_mutable_fields) {
+  Mutable_row row({Type::String, Type::Double}, std::string("a"), 1.0f);
+
+  EXPECT_EQ(1.0, row.get_double(1));
+  row.set_row_values(std::string("longer value"), nullptr);
+  EXPECT_EQ("longer value", row.get_string(0));
+  EXPECT_TRUE(row.is_null(1));
+  row.set_row_values(nullptr, 3.5);
+  EXPECT_TRUE(row.is_null(0));
+  EXPECT_EQ(3.5, row.get_double(1));
+}
+
+TEST(Row_copy, overwrite_string_fields) {
+  class Test_row : public Mutable_row {
+   public:
+    using Mutable_row::Mutable_row;
+
+    size_t arena_size() const { return _data->arena.size(); }
+  };
+
+  Test_row row({Type::String, Type::Integer, Type::String});
+  row.set_row_values(std::string("first value"), 1, std::string("other"));
+  const size_t size = row.arena_size();
+
+  // values which fit in the bytes of the previous one reuse them
+  for (int i = 0; i < 100; ++i) {
+    row.set_field(0, std::to_string(i));
+    EXPECT_EQ(std::to_string(i), row.get_string(0));
+  }
+
+  EXPECT_EQ(size, row.arena_size());
+  EXPECT_EQ("other", row.get_string(2));
+
+  // growing values do not grow the arena without bound
+  std::string value;
+
+  for (int i = 0; i < 1000; ++i) {
+    value.push_back('a' + i % 26);
+    row.set_field(0, value);
+    ASSERT_EQ(value, row.get_string(0));
+  }
+
+  EXPECT_GE(2 * (value.size() + 5), row.arena_size());
+  EXPECT_EQ(1, row.get_int(1));
+  EXPECT_EQ("other", row.get_string(2));
+
+  // null fields give their bytes back once the arena is compacted
+  row.set_field(0, nullptr);
+  for (int i = 0; i < 10; ++i) row.set_field(2, std::string(100 * i, 'x'));
+
+  EXPECT_TRUE(row.is_null(0));
+  EXPECT_EQ(std::string(900, 'x'), row.get_string(2));
+  EXPECT_GE(2 * 900u, row.arena_size());
+
+  row.set_field(0, std::string("back"));
+  EXPECT_EQ("back", row.get_string(0));
+  EXPECT_EQ(std::string(900, 'x'), row.get_string(2));
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -19,6 +19,8 @@
  along with this program; if not, write to the Free Software Foundation, Inc.,
  51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
+#include <mysqld_error.h>
+
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -182,6 +184,214 @@ TEST_F(Db_tests, query) {
   } while (switch_proto());
 }
 
+TEST_F(Db_tests, execute_pipelined) {
+  do {
+    SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
+    ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+    const std::vector<std::string> sql = {
+        "select 1 -- trailing comment", "select 2", "select * from unknown",
+        "do sleep(0)", "/* comment */ call unknown()", "select 6"};
+    std::vector<std::string> outcome;
+
+    const auto callback = [&outcome](size_t index,
+                                     std::shared_ptr<IResult> result,
+                                     const Error *error) {
+      if (error) {
+        outcome.push_back(std::to_string(index) + ": " +
+                          std::to_string(error->code()));
+      } else {
+        const IRow *row = result->fetch_one();
+        outcome.push_back(std::to_string(index) + ": " +
+                          (row ? row->get_as_string(0) : "OK"));
+      }
+      return true;
+    };
+
+    // Statements following the failed one are not executed
+    EXPECT_NO_THROW(session->execute("use mysql"));
+    EXPECT_NO_THROW(session->execute_pipelined(sql, true, callback));
+    EXPECT_EQ(std::vector<std::string>({"0: 1", "1: 2", "2: 1146"}), outcome);
+
+    // All the statements are executed, errors are reported in place
+    outcome.clear();
+    EXPECT_NO_THROW(session->execute_pipelined(sql, false, callback));
+    EXPECT_EQ(std::vector<std::string>(
+                  {"0: 1", "1: 2", "2: 1146", "3: OK", "4: 1305", "5: 6"}),
+              outcome);
+
+    // Callback stops the execution, session is still usable
+    outcome.clear();
+    EXPECT_NO_THROW(session->execute_pipelined(
+        sql, false,
+        [&outcome](size_t index, std::shared_ptr<IResult>, const Error *) {
+          outcome.push_back(std::to_string(index));
+          return index < 1;
+        }));
+    EXPECT_EQ(std::vector<std::string>({"0", "1"}), outcome);
+    EXPECT_EQ(7, session->query("select 7")->fetch_one()->get_int(0));
+
+    session->close();
+  } while (switch_proto());
+}
+
+TEST_F(Db_tests, execute_pipelined_max_allowed_packet) {
+  do {
+    SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
+    ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+    const auto max_packet =
+        session->query("select @@max_allowed_packet")->fetch_one()->get_uint(
+            0);
+
+    // Statements which together do not fit into max_allowed_packet
+    const std::string value(max_packet / 4, 'x');
+    const std::vector<std::string> sql(6, "select length('" + value + "')");
+    std::vector<std::string> outcome;
+
+    EXPECT_NO_THROW(session->execute_pipelined(
+        sql, true,
+        [&outcome](size_t, std::shared_ptr<IResult> result,
+                   const Error *error) {
+          outcome.push_back(error ? std::to_string(error->code())
+                                  : result->fetch_one()->get_as_string(0));
+          return true;
+        }));
+    EXPECT_EQ(std::vector<std::string>(6, std::to_string(value.length())),
+              outcome);
+
+    session->close();
+  } while (switch_proto());
+}
+
+TEST_F(Db_tests, execute_pipelined_large_results) {
+  do {
+    SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
+    ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+    // Statements and results which together exceed the socket buffers, the
+    // server would be blocked writing the results while the client is still
+    // sending the statements, unless the results are read in between
+    const std::string value(256 * 1024, 'x');
+    const std::vector<std::string> sql(64, "select '" + value + "'");
+    std::vector<size_t> outcome;
+
+    EXPECT_NO_THROW(session->execute_pipelined(
+        sql, true,
+        [&outcome](size_t, std::shared_ptr<IResult> result,
+                   const Error *error) {
+          outcome.push_back(
+              error ? 0 : result->fetch_one()->get_string(0).length());
+          return true;
+        }));
+    EXPECT_EQ(std::vector<size_t>(sql.size(), value.length()), outcome);
+
+    session->close();
+  } while (switch_proto());
+}
+
+TEST_F(Db_tests, execute_pipelined_warnings) {
+  do {
+    SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
+    ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+    const std::vector<std::string> sql = {
+        "select 1/0", "select 2", "select 3/0", "select 4 union select 5",
+        "select found_rows()"};
+    std::vector<std::string> outcome;
+
+    const auto callback = [&outcome](size_t, std::shared_ptr<IResult> result,
+                                     const Error *error) {
+      if (error) {
+        outcome.push_back(std::to_string(error->code()));
+        return true;
+      }
+
+      std::string value;
+      while (const IRow *row = result->fetch_one())
+        value = row->get_as_string(0);
+
+      // warnings are read once all the rows were fetched
+      while (auto warning = result->fetch_one_warning())
+        value += " " + std::to_string(warning->code);
+
+      outcome.push_back(value);
+      return true;
+    };
+
+    // Each statement reports its own warnings, SHOW WARNINGS is not placed
+    // before a statement which reads the state of its predecessor
+    for (int run = 0; run < 2; ++run) {
+      outcome.clear();
+      EXPECT_NO_THROW(session->execute_pipelined(sql, true, callback));
+      EXPECT_EQ(std::vector<std::string>(
+                    {"NULL 1365", "2", "NULL 1365", "5", "2"}),
+                outcome);
+    }
+
+    // Warnings which are not requested are skipped
+    outcome.clear();
+    EXPECT_NO_THROW(session->execute_pipelined(
+        sql, true,
+        [&outcome](size_t, std::shared_ptr<IResult> result, const Error *) {
+          outcome.push_back(result->fetch_one()->get_as_string(0));
+          return true;
+        }));
+    EXPECT_EQ(std::vector<std::string>({"NULL", "2", "NULL", "4", "2"}),
+              outcome);
+
+    session->end_pipeline();
+
+    // multi-statements are disabled once the pipelined run ends
+    if (is_classic) {
+      EXPECT_THROW(session->query("select 1; select 2"), Error);
+    }
+
+    session->close();
+  } while (switch_proto());
+}
+
+TEST_F(Db_tests, mysqlx_fetch_all_buffered) {
+  switch_proto();
+  ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+  const auto sql = "select 1 union select 2 union select 3";
+
+  // Streamed rows are not buffered, the buffer starts with the remaining ones
+  auto result = std::dynamic_pointer_cast<mysqlx::Result>(session->query(sql));
+  ASSERT_TRUE(result != nullptr);
+  EXPECT_EQ(1, result->fetch_one()->get_int(0));
+
+  auto rows = result->fetch_all_buffered();
+  ASSERT_EQ(2, rows.first->size());
+  EXPECT_EQ(0, rows.second);
+  EXPECT_EQ(2, rows.first->row(0).get_int(0));
+  EXPECT_EQ(3, result->get_fetched_row_count());
+  EXPECT_EQ(nullptr, result->fetch_one());
+
+  // Pre-fetched rows are handed out from the position of the first unread
+  // one, the buffer is the one of the result
+  result = std::dynamic_pointer_cast<mysqlx::Result>(session->query(sql));
+  ASSERT_TRUE(result != nullptr);
+  ASSERT_TRUE(result->pre_fetch_rows());
+  EXPECT_EQ(1, result->fetch_one()->get_int(0));
+
+  rows = result->fetch_all_buffered();
+  ASSERT_EQ(3, rows.first->size());
+  EXPECT_EQ(1, rows.second);
+  EXPECT_EQ(2, rows.first->row(rows.second).get_int(0));
+
+  // all rows are read
+  const auto again = result->fetch_all_buffered();
+  EXPECT_EQ(rows.first, again.first);
+  EXPECT_EQ(3, again.second);
+
+  // rows handed out stay valid after the result moves on
+  result->next_resultset();
+  EXPECT_EQ(3, rows.first->row(2).get_int(0));
+
+  session->close();
+}
+
 TEST_F(Db_tests, auto_close) {
   do {
     SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
@@ -224,5 +434,137 @@ TEST_F(Db_tests, auto_close) {
   } while (switch_proto());
 }
 
+TEST_F(Db_tests, mysqlx_insert_in_batches) {
+  // rows are sent in batches once they do not fit into a single message, the
+  // limit is read by a new connection
+  auto xsession = mysqlshdk::db::mysqlx::Session::create();
+  ASSERT_NO_THROW(xsession->connect(Connection_options(_uri)));
+  const auto max_packet = xsession->query("select @@mysqlx_max_allowed_packet")
+                              ->fetch_one()
+                              ->get_uint(0);
+  xsession->close();
+
+  run_script_classic(
+      {"set global mysqlx_max_allowed_packet = 1024",
+       "create table xtest.batches (id int primary key auto_increment, "
+       "data varchar(100))"});
+
+  const auto make_insert = [](int first_id, int count) {
+    Mysqlx::Crud::Insert msg;
+    msg.mutable_collection()->set_schema("xtest");
+    msg.mutable_collection()->set_name("batches");
+    msg.set_data_model(Mysqlx::Crud::TABLE);
+    msg.add_projection()->set_name("id");
+    msg.add_projection()->set_name("data");
+
+    for (int id = first_id; id < first_id + count; ++id) {
+      auto row = msg.add_row();
+
+      for (const auto &value : {std::to_string(id), std::string(50, 'x')}) {
+        auto field = row->add_field();
+        field->set_type(Mysqlx::Expr::Expr::LITERAL);
+        field->mutable_literal()->set_type(Mysqlx::Datatypes::Scalar::V_STRING);
+        field->mutable_literal()->mutable_v_string()->set_value(value);
+      }
+    }
+
+    return msg;
+  };
+
+  ASSERT_NO_THROW(xsession->connect(Connection_options(_uri)));
+
+  std::shared_ptr<IResult> result;
+  ASSERT_NO_THROW(result = xsession->execute_crud(make_insert(1, 100)));
+  EXPECT_EQ(100, result->get_affected_row_count());
+  EXPECT_EQ(100, xsession->query("select count(*) from xtest.batches")
+                     ->fetch_one()
+                     ->get_int(0));
+
+  // batches following the failed one are not executed
+  try {
+    xsession->execute_crud(make_insert(51, 100));
+    ADD_FAILURE() << "Duplicate key was not reported";
+  } catch (const mysqlshdk::db::Error &e) {
+    EXPECT_EQ(ER_DUP_ENTRY, e.code());
+  }
+  EXPECT_EQ(100, xsession->query("select count(*) from xtest.batches")
+                     ->fetch_one()
+                     ->get_int(0));
+
+  xsession->close();
+
+  run_script_classic(
+      {"drop table xtest.batches",
+       "set global mysqlx_max_allowed_packet = " + std::to_string(max_packet)});
+}
+
+TEST_F(Db_tests, mysqlx_prepared_statements) {
+  run_script_classic(
+      {"create table xtest.prep (id int primary key, data varchar(10))",
+       "insert into xtest.prep values (1, 'one'), (2, 'two')"});
+
+  auto xsession = mysqlshdk::db::mysqlx::Session::create();
+  ASSERT_NO_THROW(xsession->connect(Connection_options(_uri)));
+
+  // select * from xtest.prep where id = ?
+  Mysqlx::Crud::Find find;
+  find.mutable_collection()->set_schema("xtest");
+  find.mutable_collection()->set_name("prep");
+  find.set_data_model(Mysqlx::Crud::TABLE);
+  auto criteria = find.mutable_criteria();
+  criteria->set_type(Mysqlx::Expr::Expr::OPERATOR);
+  criteria->mutable_operator_()->set_name("==");
+  auto column = criteria->mutable_operator_()->add_param();
+  column->set_type(Mysqlx::Expr::Expr::IDENT);
+  column->mutable_identifier()->set_name("id");
+  auto placeholder = criteria->mutable_operator_()->add_param();
+  placeholder->set_type(Mysqlx::Expr::Expr::PLACEHOLDER);
+  placeholder->set_position(0);
+
+  const auto select = [&xsession](uint32_t stmt_id, int64_t id) {
+    ::google::protobuf::RepeatedPtrField<::Mysqlx::Datatypes::Scalar> args;
+    args.Add()->set_type(Mysqlx::Datatypes::Scalar::V_SINT);
+    args.Mutable(0)->set_v_signed_int(id);
+    return xsession->execute_prep_stmt(stmt_id, args)->fetch_one()->get_string(
+        1);
+  };
+
+  const auto status = [&xsession](const std::string &name) {
+    return xsession
+        ->query(
+            "select variable_value from performance_schema.session_status "
+            "where variable_name = '" +
+            name + "'")
+        ->fetch_one()
+        ->get_string(0);
+  };
+
+  const auto stmt_id = xsession->new_stmt_id();
+
+  if (_target_server_version < mysqlshdk::utils::Version(8, 0, 14)) {
+    // the server does not know the Prepare message
+    EXPECT_FALSE(xsession->prepare_stmt(stmt_id, find));
+    EXPECT_FALSE(xsession->supports_prepared_statements());
+  } else {
+    ASSERT_TRUE(xsession->supports_prepared_statements());
+    ASSERT_TRUE(xsession->prepare_stmt(stmt_id, find));
+
+    // each execution only sends the statement ID and the values
+    EXPECT_EQ("one", select(stmt_id, 1));
+    EXPECT_EQ("two", select(stmt_id, 2));
+    EXPECT_EQ("1", status("Mysqlx_prep_prepare"));
+    EXPECT_EQ("2", status("Mysqlx_prep_execute"));
+
+    // deallocated before the next query
+    xsession->deallocate_stmt(stmt_id);
+    EXPECT_EQ("1", status("Mysqlx_prep_deallocate"));
+    EXPECT_THROW(select(stmt_id, 1), mysqlshdk::db::Error);
+  }
+
+  xsession->close();
+
+  run_script_classic({"drop table xtest.prep"});
+}
+
 }  // namespace db
 }  // namespace mysqlshdk
@@ -488,4 +488,37 @@ TEST_F(Group_replication_Test, is_group_replication_delayed_starting) {
   EXPECT_FALSE(mysqlshdk::gr::is_group_replication_delayed_starting(instance));
 }
 
+
+TEST_F(Group_replication_Test, check_server_variables) {
+  using mysqlshdk::db::Type;
+
+  std::shared_ptr<Mock_session> mock_session = std::make_shared<Mock_session>();
+  mysqlshdk::mysql::Instance instance{mock_session};
+
+  // all the variables are read using a single query
+  const std::string query =
+      "show GLOBAL variables where `variable_name` in ('log_bin', "
+      "'binlog_format', 'binlog_checksum', 'gtid_mode', 'log_slave_updates', "
+      "'enforce_gtid_consistency', 'master_info_repository', "
+      "'relay_log_info_repository', 'transaction_write_set_extraction')";
+  mock_session->expect_query(query).then_return(
+      {{query,
+        {"Variable_name", "Value"},
+        {Type::String, Type::String},
+        {{"log_bin", "ON"},
+         {"binlog_format", "MIXED"},
+         {"binlog_checksum", "NONE"},
+         {"gtid_mode", "ON"},
+         {"log_slave_updates", "1"},
+         {"enforce_gtid_consistency", "ON"},
+         {"master_info_repository", "FILE"},
+         {"relay_log_info_repository", "TABLE"}}}});
+
+  std::map<std::string, std::string> expected = {
+      {"binlog_format", "MIXED"},
+      {"master_info_repository", "FILE"},
+      {"transaction_write_set_extraction", "<not set>"}};
+  EXPECT_EQ(expected, mysqlshdk::gr::check_server_variables(instance));
+}
+
 }  // namespace testing
@@ -1171,4 +1171,74 @@ TEST_F(Instance_test, cached_sysvars) {
   _session->close();
 }
 
+TEST_F(Instance_test, snapshot_sysvars) {
+  EXPECT_CALL(session, connect(_connection_options));
+  _session->connect(_connection_options);
+  mysqlshdk::mysql::Instance instance(_session);
+
+  // All variables are read using a single query.
+  session
+      .expect_query(
+          "show GLOBAL variables where `variable_name` in "
+          "('server_id', 'super_read_only', 'report_host')")
+      .then_return({{"show GLOBAL variables where `variable_name` in "
+                     "('server_id', 'super_read_only', 'report_host')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"server_id", "3"}, {"super_read_only", "OFF"}}}});
+  instance.snapshot_sysvars({"server_id", "super_read_only", "report_host"},
+                            mysqlshdk::mysql::Var_qualifier::GLOBAL);
+
+  // Values are taken from the snapshot, including the ones not found.
+  EXPECT_EQ(3, *instance.get_sysvar_int(
+                   "server_id", mysqlshdk::mysql::Var_qualifier::GLOBAL));
+  EXPECT_FALSE(*instance.get_sysvar_bool(
+      "super_read_only", mysqlshdk::mysql::Var_qualifier::GLOBAL));
+  EXPECT_TRUE(instance
+                  .get_sysvar_string("report_host",
+                                     mysqlshdk::mysql::Var_qualifier::GLOBAL)
+                  .is_null());
+
+  // Setting a variable discards its value from the snapshot.
+  EXPECT_CALL(session, execute("SET GLOBAL `super_read_only` = 'ON'"));
+  instance.set_sysvar("super_read_only", true,
+                      mysqlshdk::mysql::Var_qualifier::GLOBAL);
+  session
+      .expect_query(
+          "show GLOBAL variables where `variable_name` in ('super_read_only')")
+      .then_return({{"show GLOBAL variables "
+                     "where `variable_name` in ('super_read_only')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"super_read_only", "ON"}}}});
+  EXPECT_TRUE(*instance.get_sysvar_bool(
+      "super_read_only", mysqlshdk::mysql::Var_qualifier::GLOBAL));
+
+  // Session scope is not served from the global snapshot.
+  session
+      .expect_query("show SESSION variables where `variable_name` in "
+                    "('server_id')")
+      .then_return({{"show SESSION variables "
+                     "where `variable_name` in ('server_id')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"server_id", "3"}}}});
+  EXPECT_EQ(3, *instance.get_sysvar_int("server_id"));
+
+  instance.clear_sysvar_snapshot();
+  session
+      .expect_query(
+          "show GLOBAL variables where `variable_name` in ('server_id')")
+      .then_return({{"show GLOBAL variables "
+                     "where `variable_name` in ('server_id')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"server_id", "4"}}}});
+  EXPECT_EQ(4, *instance.get_sysvar_int(
+                   "server_id", mysqlshdk::mysql::Var_qualifier::GLOBAL));
+
+  EXPECT_CALL(session, close());
+  _session->close();
+}
+
 }  // namespace testing
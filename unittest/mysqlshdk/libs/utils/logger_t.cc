@@ -20,10 +20,14 @@
    51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -80,6 +84,8 @@ class Logger_test : public ::testing::Test {
   }
 
   void TearDown() override {
+    Logger::singleton()->set_async(false);
+
     const auto current_log_file = Logger::singleton()->logfile_name();
 
     if (current_log_file != m_previous_log_file) {
@@ -254,6 +260,130 @@ TEST_F(Logger_test, log_format) {
   EXPECT_TRUE(tests.empty());
 }
 
+TEST_F(Logger_test, log_async) {
+  Logger::setup_instance(get_log_file("mylog.txt").c_str(), false,
+                         Logger::LOG_DEBUG);
+
+  const auto l = Logger::singleton();
+  l->set_async(true);
+  EXPECT_TRUE(l->is_async());
+
+  static constexpr int k_threads = 4;
+  static constexpr int k_entries = 5000;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < k_entries; ++i) {
+        Logger::log(Logger::LOG_DEBUG, "Unit Test Domain", "Thread %d: %d", t,
+                    i);
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // pending entries are written when asynchronous mode is disabled
+  l->set_async(false);
+  EXPECT_FALSE(l->is_async());
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  std::vector<int> next_entry(k_threads, 0);
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    if (line.empty()) {
+      continue;
+    }
+
+    EXPECT_TRUE(is_timestamp(line.c_str()));
+
+    int t = 0;
+    int i = 0;
+    ASSERT_EQ(2, sscanf(line.substr(19).c_str(),
+                        ": Debug: Unit Test Domain: Thread %d: %d", &t, &i));
+    ASSERT_LT(t, k_threads);
+
+    // entries logged by the same thread keep their order
+    EXPECT_EQ(next_entry[t]++, i);
+  }
+
+  for (const auto count : next_entry) {
+    EXPECT_EQ(k_entries, count);
+  }
+}
+
+TEST_F(Logger_test, log_async_toggle) {
+  Logger::setup_instance(get_log_file("mylog.txt").c_str(), false,
+                         Logger::LOG_DEBUG);
+
+  const auto l = Logger::singleton();
+
+  static constexpr int k_threads = 4;
+  static constexpr int k_entries = 5000;
+  // does not fit into a slot of the queue
+  const std::string long_text(1000, 'x');
+  std::atomic<int> running{k_threads};
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back([t, &long_text, &running]() {
+      for (int i = 0; i < k_entries; ++i) {
+        Logger::log(Logger::LOG_DEBUG, "Unit Test Domain", "Thread %d: %d %s",
+                    t, i, i % 10 ? "" : long_text.c_str());
+      }
+
+      --running;
+    });
+  }
+
+  // mode is switched while other threads are logging
+  bool async = false;
+
+  while (running > 0) {
+    async = !async;
+    l->set_async(async);
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  l->set_async(false);
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  std::vector<std::vector<bool>> logged(k_threads,
+                                        std::vector<bool>(k_entries, false));
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    if (line.empty()) {
+      continue;
+    }
+
+    int t = 0;
+    int i = 0;
+    ASSERT_EQ(2, sscanf(line.substr(19).c_str(),
+                        ": Debug: Unit Test Domain: Thread %d: %d", &t, &i));
+    ASSERT_LT(t, k_threads);
+    ASSERT_LT(i, k_entries);
+
+    EXPECT_EQ(i % 10 ? std::string::npos : line.length() - long_text.length(),
+              line.find(long_text));
+    EXPECT_FALSE(logged[t][i]);
+    logged[t][i] = true;
+  }
+
+  // entries are not lost when the mode changes
+  for (const auto &entries : logged) {
+    EXPECT_EQ(k_entries, std::count(entries.begin(), entries.end(), true));
+  }
+}
+
 TEST_F(Logger_test, log_exception_format) {
   // exception should always be logged, even if log is disabled
   Logger::setup_instance(get_log_file("mylog.txt").c_str(), false,
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+
+#include "mysqlshdk/libs/utils/lru_cache.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+TEST(Lru_cache, find_and_evict) {
+  Lru_cache<std::string, int> cache(2);
+
+  EXPECT_EQ(nullptr, cache.find("a"));
+  cache.put("a", 1);
+  cache.put("b", 2);
+  EXPECT_EQ(2u, cache.size());
+
+  // "a" becomes the most recently used, "b" is evicted
+  ASSERT_NE(nullptr, cache.find("a"));
+  EXPECT_EQ(1, *cache.find("a"));
+  cache.put("c", 3);
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_EQ(nullptr, cache.find("b"));
+  EXPECT_EQ(3, *cache.find("c"));
+
+  // replacing a value does not grow the cache
+  cache.put("a", 10);
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_EQ(10, *cache.find("a"));
+
+  EXPECT_EQ(4u, cache.hits());
+  EXPECT_EQ(2u, cache.misses());
+
+  cache.set_capacity(1);
+  EXPECT_EQ(1u, cache.size());
+  EXPECT_EQ(nullptr, cache.find("c"));
+  EXPECT_EQ(10, *cache.find("a"));
+
+  cache.clear();
+  EXPECT_EQ(0u, cache.size());
+  EXPECT_EQ(5u, cache.hits());
+  EXPECT_EQ(3u, cache.misses());
+}
+
+TEST(Lru_cache, zero_capacity) {
+  Lru_cache<int, std::string> cache(0);
+
+  cache.put(1, "one");
+  EXPECT_EQ(0u, cache.size());
+  EXPECT_EQ(nullptr, cache.find(1));
+  EXPECT_EQ(1u, cache.misses());
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
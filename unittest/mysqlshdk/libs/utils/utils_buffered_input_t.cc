@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_buffered_input.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+class Buffered_input_test : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    m_path = path::join_path(getenv("TMPDIR"), "buffered_input_test.json");
+  }
+
+  void TearDown() override { delete_file(m_path); }
+
+  std::vector<std::string> split(const std::string &contents) {
+    create_file(m_path, contents);
+
+    Buffered_input input;
+    input.open(m_path, GetParam());
+#ifndef _WIN32
+    EXPECT_EQ(GetParam(), input.is_mapped());
+#endif  // !_WIN32
+
+    std::vector<std::string> docs;
+    std::string buffer;
+
+    while (!input.eof()) {
+      const auto doc = span_one_maybe_json(&input, &buffer);
+      if (doc.empty()) break;
+      docs.emplace_back(doc.str());
+    }
+
+    return docs;
+  }
+
+  std::string m_path;
+};
+
+TEST_P(Buffered_input_test, span_documents) {
+  EXPECT_EQ(std::vector<std::string>({"{}", "{\"a\": [1, {\"b\": 2}]}"}),
+            split("{}\n  {\"a\": [1, {\"b\": 2}]}\n"));
+
+  EXPECT_EQ(std::vector<std::string>(
+                {"{\"a\": \"}{][\\\"\"}", "{\"b\": \"\\\\\"}"}),
+            split("{\"a\": \"}{][\\\"\"}{\"b\": \"\\\\\"}"));
+
+  const std::string long_value(3 * 64 * 1024 + 7, 'x');
+  EXPECT_EQ(std::vector<std::string>({"{\"a\": \"" + long_value + "\"}",
+                                      "{\"c\": 1}"}),
+            split("{\"a\": \"" + long_value + "\"}{\"c\": 1}"));
+}
+
+TEST_P(Buffered_input_test, span_invalid_documents) {
+  try {
+    split("{\"_id\": \"a\"}{\"_id\": \"b\"}}{\"_id\": \"c\"}");
+    FAIL() << "Expected exception";
+  } catch (const invalid_json &e) {
+    EXPECT_EQ(24, e.offset());
+    EXPECT_STREQ("Input does not start with a JSON object at offset 24",
+                 e.what());
+  }
+
+  try {
+    split("{\"a\": [1, 2}");
+    FAIL() << "Expected exception";
+  } catch (const invalid_json &e) {
+    EXPECT_EQ(11, e.offset());
+  }
+
+  try {
+    split("{\"a\": {\"b\": 1}");
+    FAIL() << "Expected exception";
+  } catch (const invalid_json &e) {
+    EXPECT_STREQ("Premature end of input stream at offset 14", e.what());
+  }
+
+  EXPECT_THROW(split("{\"a\": \"b"), std::out_of_range);
+}
+
+INSTANTIATE_TEST_CASE_P(Buffered_input, Buffered_input_test,
+                        ::testing::Values(false, true));
+
+}  // namespace shcore
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+
+#include "unittest/gprod_clean.h"
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/include/shellcore/utils_help.h"
+
+namespace shcore {
+
+using Mode_mask = IShell_core::Mode_mask;
+
+// Uses its own registry, the static help is already loaded into the global
+// one by the time the tests run
+class Help_registry_test : public ::testing::Test {
+ protected:
+  void SetUp() override { m_registry.reset(new Help_registry()); }
+
+  std::unique_ptr<Help_registry> m_registry;
+};
+
+TEST_F(Help_registry_test, token_precedence) {
+  m_registry->add_static_help("TOKEN_A", "static a");
+  m_registry->add_static_help("TOKEN_B", "static b");
+  m_registry->add_static_help("TOKEN_B", "static b, registered again");
+
+  // tokens are case insensitive and the last static registration wins
+  EXPECT_EQ("static a", m_registry->get_token("token_a"));
+  EXPECT_EQ("static b, registered again", m_registry->get_token("TOKEN_B"));
+  EXPECT_EQ("", m_registry->get_token("TOKEN_C"));
+
+  // static help recorded after the first lookup is found as well
+  m_registry->add_static_help("TOKEN_C", "static c");
+  EXPECT_EQ("static c", m_registry->get_token("TOKEN_C"));
+
+  // help added at runtime takes precedence over the static one, no matter
+  // which was registered first
+  m_registry->add_help("TOKEN_A", "runtime a");
+  EXPECT_EQ("runtime a", m_registry->get_token("TOKEN_A"));
+
+  m_registry->add_help("TOKEN_D", "runtime d");
+  m_registry->add_static_help("TOKEN_D", "static d");
+  EXPECT_EQ("runtime d", m_registry->get_token("TOKEN_D"));
+}
+
+TEST_F(Help_registry_test, deferred_topic_resolution) {
+  Mode_mask scripting(IShell_core::Mode::JavaScript);
+  scripting.set(IShell_core::Mode::Python);
+
+  // recorded before their parents, as the static initialization order across
+  // translation units is not defined
+  m_registry->add_static_topic("orphan", Topic_type::TOPIC, "ORPHAN",
+                               "TESTCATEGORY", Mode_mask::all());
+  m_registry->add_static_topic("Sub", Topic_type::CLASS, "Sub", "testmod",
+                               scripting, "Base");
+  m_registry->add_static_topic("baseFunction", Topic_type::FUNCTION,
+                               "baseFunction", "Base", scripting);
+  m_registry->add_static_topic("Test Category", Topic_type::CATEGORY,
+                               "TESTCATEGORY", Help_registry::HELP_ROOT,
+                               Mode_mask::all());
+  m_registry->add_static_topic("testmod", Topic_type::MODULE, "testmod",
+                               Help_registry::HELP_ROOT, scripting);
+  m_registry->add_static_topic("Base", Topic_type::CLASS, "Base", "testmod",
+                               scripting, "");
+
+  // the first lookup builds the help tree
+  const auto category = m_registry->get_topic("TESTCATEGORY");
+  const auto orphan = m_registry->get_topic("orphan");
+  EXPECT_EQ(category, orphan->m_parent);
+
+  const auto base = m_registry->get_topic("Base");
+  const auto sub = m_registry->get_topic("Sub");
+  EXPECT_EQ(m_registry->get_topic("testmod"), sub->m_parent);
+  EXPECT_EQ(base, m_registry->get_class_parent(sub));
+  EXPECT_EQ(nullptr, m_registry->get_class_parent(base));
+
+  // members of the upper class are inherited
+  EXPECT_NE(nullptr, m_registry->get_topic("Base.baseFunction", true));
+  EXPECT_NE(nullptr, m_registry->get_topic("Sub.baseFunction", true));
+
+  // topics recorded once the tree is loaded are registered right away
+  m_registry->add_static_topic("late", Topic_type::TOPIC, "LATE",
+                               "TESTCATEGORY", Mode_mask::all());
+  EXPECT_EQ(category, m_registry->get_topic("late")->m_parent);
+}
+
+TEST_F(Help_registry_test, defer) {
+  int before_load = 0;
+  int after_load = 0;
+
+  m_registry->add_static_topic("Test Category", Topic_type::CATEGORY,
+                               "TESTCATEGORY", Help_registry::HELP_ROOT,
+                               Mode_mask::all());
+
+  // registrations deferred before the tree is loaded run after the static
+  // topics, so they can refer to any of them
+  m_registry->defer([this, &before_load]() {
+    ++before_load;
+    m_registry->add_help_topic("deferred", Topic_type::TOPIC, "DEFERRED",
+                               "TESTCATEGORY", Mode_mask::all());
+  });
+
+  m_registry->add_static_help("TOKEN", "data");
+  EXPECT_EQ("data", m_registry->get_token("TOKEN"));
+  // help text lookups do not load the tree
+  EXPECT_EQ(0, before_load);
+
+  EXPECT_EQ(m_registry->get_topic("TESTCATEGORY"),
+            m_registry->get_topic("deferred")->m_parent);
+  EXPECT_EQ(1, before_load);
+
+  // once loaded, registrations run right away and only once
+  m_registry->defer([&after_load]() { ++after_load; });
+  EXPECT_EQ(1, after_load);
+
+  m_registry->get_topic("deferred");
+  EXPECT_EQ(1, before_load);
+  EXPECT_EQ(1, after_load);
+}
+
+}  // namespace shcore
@@ -22,7 +22,16 @@
  */
 
 #include <gtest_clean.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/devapi/base_constants.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/shellcore/shell_console.h"
+#include "unittest/test_utils.h"
 
 using Print_flags = mysqlsh::Print_flags;
 using Print_flag = mysqlsh::Print_flag;
@@ -67,3 +76,189 @@ TEST(ResultsetDumper, get_data_sizes) {
   // Multibyte character 3 bytes represented in 2 spaces
   TEST_DATA_SIZES("I 爱 MySQL Shell\0", 17, Print_flags(), 16, 17);
 }
+
+namespace {
+
+/**
+ * Result which returns the given rows from fetchOne(), calling the callback
+ * with the index of each of them.
+ */
+class Fake_result : public mysqlsh::ShellBaseResult {
+ public:
+  Fake_result(const std::vector<std::string> &names,
+              const std::vector<std::vector<shcore::Value>> &rows)
+      : m_columns(shcore::make_array()) {
+    for (const auto &name : names) {
+      const bool numeric = name == "id";
+      m_columns->push_back(shcore::Value::wrap(new mysqlsh::Column(
+          "", "", "", name, name,
+          mysqlsh::Constant::get_constant("mysql", "Type",
+                                          numeric ? "INT" : "VARCHAR",
+                                          shcore::Argument_list()),
+          numeric ? 3 : 255, 0, false, "", "", false)));
+    }
+
+    for (const auto &values : rows) {
+      auto row = std::make_shared<mysqlsh::Row>();
+      for (size_t i = 0; i < names.size(); ++i) {
+        row->add_item(names[i], values[i]);
+      }
+      m_rows.emplace_back(std::move(row));
+    }
+  }
+
+  std::string class_name() const override { return "Fake_result"; }
+
+  shcore::Value get_member(const std::string &prop) const override {
+    if (prop == "columns") return shcore::Value(m_columns);
+    return ShellBaseResult::get_member(prop);
+  }
+
+  shcore::Value call(const std::string &name,
+                     const shcore::Argument_list &args) override {
+    if (name != "fetchOne") return ShellBaseResult::call(name, args);
+
+    if (on_fetch) on_fetch(m_next);
+    if (m_next == m_rows.size()) return shcore::Value::Null();
+    return shcore::Value(
+        std::static_pointer_cast<shcore::Object_bridge>(m_rows[m_next++]));
+  }
+
+  std::function<void(size_t)> on_fetch;
+
+ private:
+  shcore::Value::Array_type_ref m_columns;
+  std::vector<std::shared_ptr<mysqlsh::Row>> m_rows;
+  size_t m_next = 0;
+};
+
+class Test_dumper : public mysqlsh::ResultsetDumper {
+ public:
+  explicit Test_dumper(std::shared_ptr<mysqlsh::ShellBaseResult> target)
+      : ResultsetDumper(target, false) {}
+
+  std::string dump_records() {
+    std::string stats;
+    ResultsetDumper::dump_records(stats);
+    return stats;
+  }
+
+  void cancel() { _cancelled = true; }
+};
+
+}  // namespace
+
+class Table_streaming_test : public ::testing::Test {
+ protected:
+  Table_streaming_test()
+      : m_options{std::make_shared<mysqlsh::Shell_options>(0, nullptr)},
+        m_console{
+            std::make_shared<mysqlsh::Shell_console>(&output_handler.deleg)} {
+    m_options.get()->set(SHCORE_TABLE_STREAMING_ROWS, shcore::Value(2));
+  }
+
+  std::shared_ptr<Fake_result> result(
+      const std::vector<std::vector<shcore::Value>> &rows) {
+    return std::make_shared<Fake_result>(
+        std::vector<std::string>{"id", "name"}, rows);
+  }
+
+  Shell_test_output_handler output_handler;
+
+ private:
+  mysqlsh::Scoped_shell_options m_options;
+  mysqlsh::Scoped_console m_console;
+};
+
+TEST_F(Table_streaming_test, sampled_rows) {
+  auto rows = result({{shcore::Value(1), shcore::Value("a")},
+                      {shcore::Value(2), shcore::Value("bb")},
+                      {shcore::Value(3), shcore::Value("ccc")},
+                      {shcore::Value(4), shcore::Value::Null()}});
+  size_t fetched_before_header = 0;
+  rows->on_fetch = [this, &fetched_before_header](size_t) {
+    if (output_handler.std_out.empty()) ++fetched_before_header;
+  };
+
+  Test_dumper dumper(rows);
+  EXPECT_EQ("4 rows in set", dumper.dump_records());
+
+  // header is printed once the sample of two rows is read
+  EXPECT_EQ(2, fetched_before_header);
+  EXPECT_EQ(
+      "+-----+------+\n"
+      "| id  | name |\n"
+      "+-----+------+\n"
+      "|   1 | a    |\n"
+      "|   2 | bb   |\n"
+      "|   3 | ccc  |\n"
+      "|   4 | NULL |\n"
+      "+-----+------+\n",
+      output_handler.std_out);
+}
+
+TEST_F(Table_streaming_test, widened_column) {
+  Test_dumper dumper(result({{shcore::Value(1), shcore::Value("a")},
+                             {shcore::Value(2), shcore::Value("bb")},
+                             {shcore::Value(3), shcore::Value("cccccc")},
+                             {shcore::Value(4), shcore::Value("d")}}));
+  EXPECT_EQ("4 rows in set", dumper.dump_records());
+
+  EXPECT_EQ(
+      "+-----+------+\n"
+      "| id  | name |\n"
+      "+-----+------+\n"
+      "|   1 | a    |\n"
+      "|   2 | bb   |\n"
+      "+-----+------+\n"
+      "+-----+--------+\n"
+      "| id  | name   |\n"
+      "+-----+--------+\n"
+      "|   3 | cccccc |\n"
+      "|   4 | d      |\n"
+      "+-----+--------+\n",
+      output_handler.std_out);
+}
+
+TEST_F(Table_streaming_test, empty_result) {
+  Test_dumper dumper(result({}));
+  EXPECT_EQ("Empty set", dumper.dump_records());
+  EXPECT_EQ("", output_handler.std_out);
+}
+
+TEST_F(Table_streaming_test, cancel_while_sampling) {
+  auto rows = result({{shcore::Value(1), shcore::Value("a")},
+                      {shcore::Value(2), shcore::Value("bb")},
+                      {shcore::Value(3), shcore::Value("ccc")}});
+  Test_dumper dumper(rows);
+  rows->on_fetch = [&dumper](size_t index) {
+    if (index == 1) dumper.cancel();
+  };
+
+  // not reported as an empty result
+  EXPECT_EQ("0 rows in set", dumper.dump_records());
+  EXPECT_EQ("", output_handler.std_out);
+}
+
+TEST_F(Table_streaming_test, cancel_while_streaming) {
+  auto rows = result({{shcore::Value(1), shcore::Value("a")},
+                      {shcore::Value(2), shcore::Value("bb")},
+                      {shcore::Value(3), shcore::Value("ccc")},
+                      {shcore::Value(4), shcore::Value("d")}});
+  Test_dumper dumper(rows);
+  rows->on_fetch = [&dumper](size_t index) {
+    if (index == 2) dumper.cancel();
+  };
+
+  // row which was being fetched is still printed
+  EXPECT_EQ("3 rows in set", dumper.dump_records());
+  EXPECT_EQ(
+      "+-----+------+\n"
+      "| id  | name |\n"
+      "+-----+------+\n"
+      "|   1 | a    |\n"
+      "|   2 | bb   |\n"
+      "|   3 | ccc  |\n"
+      "+-----+------+\n",
+      output_handler.std_out);
+}
@@ -32,6 +32,16 @@ SYNTAX
 RETURNS
        A Result object that can be used to retrieve the results ofoperation.
 
+DESCRIPTION
+      If the rows do not fit into a single message of mysqlx_max_allowed_packet
+      bytes, they are sent in several batches, without waiting for the previous
+      ones to complete. The returned Result reports the affected items of all
+      the batches.
+
+      If one of the batches fails, the following ones are not executed, the
+      rows inserted by the previous ones are kept unless the operation is
+      executed in a transaction.
+
 //@<OUT> Help on help
 NAME
       help - Provides help about this class and it's members
@@ -550,6 +550,26 @@ EXPECT_STDOUT_CONTAINS(
     '" to collection `wl10606`.`2MB_less________` in MySQL Server at');
 EXPECT_STDOUT_CONTAINS("Total successfully imported documents 1 ");
 
+//@ Import using multiple threads
+util.importJson(__import_data_path + '/sample.json', {
+  schema : target_schema,
+  collection: "parallel_sample",
+  threads: 4
+});
+EXPECT_STDOUT_CONTAINS(
+    'Importing from file "' + __import_data_path + '/sample.json' +
+    '" to collection `wl10606`.`parallel_sample` in MySQL Server at');
+EXPECT_EQ(session.getSchema(target_schema).getCollection('parallel_sample').count(),
+          session.getSchema(target_schema).getCollection('fr1_02_sample').count());
+
+EXPECT_THROWS(function() {
+  util.importJson(__import_data_path + '/sample.json', {
+    schema : target_schema,
+    collection: "parallel_sample",
+    threads: 0
+  });
+}, "Number of threads must be a positive integer value.");
+
 //@ Teardown
 session.close();
 testutil.destroySandbox(target_port);
@@ -4,6 +4,9 @@
 //@ batchContinueOnError option help text
 \option --help batchContinueOnError
 
+//@ batchPipelineSize option help text
+\option -h batchPipelineSize
+
 //@ defaultMode option help text
 \option -h defaultMode
 
@@ -22,6 +25,9 @@
 //@ interactive option help text
 \option --help interactive
 
+//@ logAsync option help text
+\option --help logAsync
+
 //@ logLevel option help text
 \option -h logLevel
 
@@ -37,6 +43,9 @@
 //@ showWarnings option help text
 \option -h showWarnings
 
+//@ tableStreamingRows option help text
+\option -h tableStreamingRows
+
 //@ useWizards option help text
 \option --help useWizards
 
@@ -0,0 +1,52 @@
+//@<> Setup
+testutil.deploySandbox(__mysql_sandbox_port1, 'root');
+shell.connect(__sandbox_uri1);
+
+session.runSql('CREATE SCHEMA dump_test');
+session.runSql('CREATE TABLE dump_test.t (id INT PRIMARY KEY, ' +
+               'created TIMESTAMP NOT NULL DEFAULT CURRENT_TIMESTAMP, ' +
+               'doubled INT AS (id * 2) VIRTUAL)');
+// dump writes TIMESTAMP values in UTC
+session.runSql("SET TIME_ZONE = '+00:00'");
+session.runSql("INSERT INTO dump_test.t (id, created) VALUES " +
+               "(1, '2018-01-02 03:04:05'), (2, '2018-06-07 08:09:10')");
+
+var dump_dir = testutil.getSandboxPath() + '/dump_test';
+
+//@<> Columns with DEFAULT CURRENT_TIMESTAMP are dumped, generated are not
+util.dumpSchemas(['dump_test'], dump_dir, {compression: 'none', threads: 2});
+
+var metadata = JSON.parse(testutil.catFile(dump_dir + '/dump_test@t.json'));
+EXPECT_EQ(['id', 'created'], metadata.columns);
+
+var data = '';
+for (var i = 0; i < metadata.chunks; ++i) {
+  data += testutil.catFile(dump_dir + '/dump_test@t@' + i + '.tsv');
+}
+EXPECT_TRUE(data.indexOf('1\t2018-01-02 03:04:05\n') >= 0);
+EXPECT_TRUE(data.indexOf('2\t2018-06-07 08:09:10\n') >= 0);
+
+//@<> Tables are split on composite and non-integer primary keys
+session.runSql('CREATE TABLE dump_test.c (name VARCHAR(10), n INT, ' +
+               'PRIMARY KEY (name, n))');
+session.runSql("INSERT INTO dump_test.c VALUES ('a', 1), ('a', 2), ('b', 1)");
+
+var chunked_dir = testutil.getSandboxPath() + '/dump_test_chunked';
+util.dumpSchemas(['dump_test'], chunked_dir,
+                 {compression: 'none', rowsPerChunk: 1, tables: ['c']});
+
+metadata = JSON.parse(testutil.catFile(chunked_dir + '/dump_test@c.json'));
+EXPECT_EQ(['name', 'n'], metadata.primaryKey);
+EXPECT_EQ(3, metadata.chunks);
+
+data = '';
+for (var i = 0; i < metadata.chunks; ++i) {
+  data += testutil.catFile(chunked_dir + '/dump_test@c@' + i + '.tsv');
+}
+EXPECT_EQ('a\t1\na\t2\nb\t1\n', data);
+
+//@<> Cleanup
+testutil.rmdir(dump_dir, true);
+testutil.rmdir(chunked_dir, true);
+session.close();
+testutil.destroySandbox(__mysql_sandbox_port1);
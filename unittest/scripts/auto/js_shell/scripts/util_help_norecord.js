@@ -4,6 +4,14 @@ util.help();
 //@ util checkForServerUpgrade help
 util.help('checkForServerUpgrade');
 
+//@ util compareTable help
+util.help('compareTable');
+
+//@ util dumpSchemas help
+util.help('dumpSchemas');
+
 //@ util importJson help
 util.help('importJson');
 
+//@ util importTable help
+util.help('importTable');
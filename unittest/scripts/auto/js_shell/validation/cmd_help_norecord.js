@@ -73,8 +73,8 @@ The following modules and objects are ready for use when the shell starts:
  - shell    Gives access to general purpose functions and properties.
  - sys      Gives access to system specific parameters.
  - testutil
- - util     Global object that groups miscellaneous tools like upgrade checker
-            and JSON import.
+ - util     Global object that groups miscellaneous tools like upgrade checker,
+            JSON import, table import, dump and table comparison.
 
 For additional information on these global objects use: <object>.help()
 
@@ -259,8 +259,8 @@ mysql module that enables executing SQL on MySQL Servers.
 
 OBJECTS
  - shell Gives access to general purpose functions and properties.
- - util  Global object that groups miscellaneous tools like upgrade checker and
-         JSON import.
+ - util  Global object that groups miscellaneous tools like upgrade checker,
+         JSON import, table import, dump and table comparison.
 
 CLASSES
  - Column Represents the metadata for a column in a result.
@@ -404,5 +404,8 @@
 //@ Import document with size less than mysqlx_max_allowed_packet
 ||
 
+//@ Import using multiple threads
+||
+
 //@ Teardown
 ||
@@ -60,8 +60,8 @@ Usage: mysqlsh [OPTIONS] [URI]
   --js, --javascript            Start in JavaScript mode.
   --py, --python                Start in Python mode.
   --json[=format]               Produce output in JSON format, allowed
-                                values:raw, pretty. If no format is specified
-                                pretty format is produced.
+                                values:raw, pretty, ndjson. If no format is
+                                specified pretty format is produced.
   --table                       Produce output in table format (default for
                                 interactive mode). This option can be used to
                                 force that format when running in batch mode.
@@ -86,10 +86,16 @@ Usage: mysqlsh [OPTIONS] [URI]
                                 mode.
   --force                       To use in SQL batch mode, forces processing to
                                 continue if an error is found.
+  --batch-pipeline-size=size    To use in SQL batch mode, number of statements
+                                sent to the server before reading their
+                                results. 0 disables pipelining.
   --log-level=value             The log level value must be an integer between
                                 1 and 8 or any of [none, internal, error,
                                 warning, info, debug, debug2, debug3]
                                 respectively.
+  --log-async                   Writes the log file from a background thread,
+                                logging does not wait for the entries to be
+                                written.
   --passwords-from-stdin        Read passwords from stdin instead of the tty.
   --show-warnings=<true|false>  Automatically display SQL warnings on SQL mode
                                 if available.
@@ -77,6 +77,9 @@ DESCRIPTION
         enabled. The \rehash command can be used for manual refresh
       - batchContinueOnError: read-only, boolean value to indicate if the
         execution of an SQL script in batch mode shall continue if errors occur
+      - batchPipelineSize: number of statements sent to the server before
+        reading their results when executing SQL in batch mode; 0 (default)
+        disables pipelining
       - credentialStore.excludeFilters: array of URLs for which automatic
         password storage is disabled, supports glob characters '*' and '?'
       - credentialStore.helper: name of the credential helper to use to
@@ -97,6 +100,8 @@ DESCRIPTION
         filter out of the command history in SQL mode
       - interactive: read-only, boolean value that indicates if the shell is
         running in interactive mode
+      - logAsync: boolean value that indicates if the log file is written from
+        a background thread
       - logLevel: current log level
       - outputFormat: controls the type of output produced for SQL results.
       - pager: string which specifies the external command which is going to be
@@ -107,6 +112,9 @@ DESCRIPTION
         cluster will be deployed
       - showWarnings: boolean value to indicate whether warnings shall be
         included when printing an SQL result
+      - tableStreamingRows: number of rows used to size the columns of the
+        table output format, after which the remaining rows are printed as they
+        are fetched; 0 (default) buffers the whole result before printing it
       - useWizards: read-only, boolean value to indicate if the Shell is using
         the interactive wrappers (wizard mode)
 
@@ -115,6 +123,8 @@ DESCRIPTION
       - table: displays the output in table format (default)
       - json: displays the output in JSON format
       - json/raw: displays the output in a JSON format but in a single line
+      - ndjson: displays each row of the results as a JSON document in a single
+        line
       - vertical: displays the outputs vertically, one line per column value
 
 FUNCTIONS
@@ -5,6 +5,10 @@
  batchContinueOnError  To use in SQL batch mode, forces processing to continue
                        if an error is found.
 
+//@<OUT> batchPipelineSize option help text
+ batchPipelineSize  To use in SQL batch mode, number of statements sent to the
+                    server before reading their results. 0 disables pipelining.
+
 //@<OUT> defaultMode option help text
  defaultMode  Specifies the shell mode to use when shell is started - one of
               sql, js or py.
@@ -25,6 +29,10 @@
 //@<OUT> interactive option help text
  interactive  Enables interactive mode
 
+//@<OUT> logAsync option help text
+ logAsync  Writes the log file from a background thread, logging does not wait
+           for the entries to be written.
+
 //@<OUT> logLevel option help text
  logLevel  The log level value must be an integer between 1 and 8 or any of
            [none, internal, error, warning, info, debug, debug2, debug3]
@@ -42,6 +50,11 @@
 //@<OUT> showWarnings option help text
  showWarnings  Automatically display SQL warnings on SQL mode if available.
 
+//@<OUT> tableStreamingRows option help text
+ tableStreamingRows  Number of rows used to size the columns of table output,
+                     remaining rows are printed as they are fetched. 0 buffers
+                     the whole result.
+
 //@<OUT> useWizards option help text
  useWizards  Enables wizard mode.
 
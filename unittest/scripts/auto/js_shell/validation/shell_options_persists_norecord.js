@@ -234,6 +234,7 @@
 //@<OUT> List all the options using \option
  autocomplete.nameCache          true
  batchContinueOnError            false
+ batchPipelineSize               0
  credentialStore.excludeFilters  []
  credentialStore.helper          default
  credentialStore.savePasswords   prompt
@@ -244,17 +245,20 @@
  history.maxSize                 1000
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
  interactive                     true
+ logAsync                        false
  logLevel                        5
  outputFormat                    table
  pager                           ""
  passwordsFromStdin              false
  sandboxDir                      <<<_defaultSandboxDir>>>
  showWarnings                    true
+ tableStreamingRows              0
  useWizards                      true
 
 //@<OUT> List all the options using \option and show-origin
  autocomplete.nameCache          true (Compiled default)
  batchContinueOnError            false (Compiled default)
+ batchPipelineSize               0 (Compiled default)
  credentialStore.excludeFilters  [] (Compiled default)
  credentialStore.helper          default (Compiled default)
  credentialStore.savePasswords   prompt (Compiled default)
@@ -265,12 +269,14 @@
  history.maxSize                 1000 (Compiled default)
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
  interactive                     true (Compiled default)
+ logAsync                        false (Compiled default)
  logLevel                        5 (Compiled default)
  outputFormat                    table (Compiled default)
  pager                           "" (Compiled default)
  passwordsFromStdin              false (Compiled default)
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showWarnings                    true (Compiled default)
+ tableStreamingRows              0 (Compiled default)
  useWizards                      true (Compiled default)
 
 //@ List an option which origin is Compiled default
@@ -307,6 +313,7 @@
 //@<OUT> List all the options using \option for SQL mode
  autocomplete.nameCache          true
  batchContinueOnError            false
+ batchPipelineSize               0
  credentialStore.excludeFilters  []
  credentialStore.helper          default
  credentialStore.savePasswords   prompt
@@ -317,18 +324,21 @@
  history.maxSize                 1000
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
  interactive                     true
+ logAsync                        false
  logLevel                        5
  outputFormat                    table
  pager                           ""
  passwordsFromStdin              false
  sandboxDir                      <<<_defaultSandboxDir>>>
  showWarnings                    true
+ tableStreamingRows              0
  useWizards                      true
 
 //@<OUT> List all the options using \option and show-origin for SQL mode
  Switching to SQL mode... Commands end with ;
  autocomplete.nameCache          true (Compiled default)
  batchContinueOnError            false (Compiled default)
+ batchPipelineSize               0 (Compiled default)
  credentialStore.excludeFilters  [] (Compiled default)
  credentialStore.helper          default (Compiled default)
  credentialStore.savePasswords   prompt (Compiled default)
@@ -339,10 +349,12 @@
  history.maxSize                 1000 (Compiled default)
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
  interactive                     true (Compiled default)
+ logAsync                        false (Compiled default)
  logLevel                        5 (Compiled default)
  outputFormat                    table (Compiled default)
  pager                           "" (Compiled default)
  passwordsFromStdin              false (Compiled default)
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showWarnings                    true (Compiled default)
+ tableStreamingRows              0 (Compiled default)
  useWizards                      true (Compiled default)
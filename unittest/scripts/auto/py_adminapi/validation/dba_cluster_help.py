@@ -639,7 +639,8 @@ DESCRIPTION
       - mode: the instance mode
       - readReplicas: a list of read replica Instances of the instance.
       - role: the instance role
-      - status: the instance status
+      - status: the instance status, as reported by the instance itself,
+        UNREACHABLE if the instance did not respond in time
 
 EXCEPTIONS
       MetadataError in the following scenarios:
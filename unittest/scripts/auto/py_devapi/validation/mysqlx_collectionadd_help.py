@@ -71,6 +71,16 @@ SYNTAX
 RETURNS
        A Result object.
 
+DESCRIPTION
+      If the documents do not fit into a single message of
+      mysqlx_max_allowed_packet bytes, they are sent in several batches,
+      without waiting for the previous ones to complete. The returned Result
+      reports the affected items and generated IDs of all the batches.
+
+      If one of the batches fails, the following ones are not executed, the
+      documents added by the previous ones are kept unless the operation is
+      executed in a transaction.
+
 #@<OUT> colladd.help
 NAME
       help - Provides help about this class and it's members
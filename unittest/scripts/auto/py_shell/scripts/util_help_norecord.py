@@ -4,6 +4,14 @@ util.help()
 #@ util check_for_server_upgrade help
 util.help('check_for_server_upgrade')
 
+#@ util compare_table help
+util.help('compare_table')
+
+#@ util dump_schemas help
+util.help('dump_schemas')
+
 #@ util import_json help
 util.help('import_json')
 
+#@ util import_table help
+util.help('import_table')
@@ -1,17 +1,25 @@
 #@<OUT> util help
 NAME
-      util - Global object that groups miscellaneous tools like upgrade checker
-             and JSON import.
+      util - Global object that groups miscellaneous tools like upgrade
+             checker, JSON import, table import, dump and table comparison.
 
 DESCRIPTION
-      Global object that groups miscellaneous tools like upgrade checker and
-      JSON import.
+      Global object that groups miscellaneous tools like upgrade checker, JSON
+      import, table import, dump and table comparison.
 
 FUNCTIONS
       check_for_server_upgrade([connectionData][, options])
             Performs series of tests on specified MySQL server to check if the
             upgrade process will succeed.
 
+      compare_table(schema, table, instances[, options])
+            Compares contents of a table on multiple instances of MySQL Server,
+            computing checksums of its chunks in parallel.
+
+      dump_schemas(schemas, outputDir[, options])
+            Dumps schemas from MySQL Server to a directory, reading table data
+            in parallel using classic protocol sessions.
+
       help([member])
             Provides help about this object and it's members
 
@@ -19,6 +27,10 @@ FUNCTIONS
             Import JSON documents from file to collection or table in MySQL
             Server using X Protocol session.
 
+      import_table(file, options)
+            Import a delimited file to table in MySQL Server using classic
+            protocol sessions in parallel.
+
 
 #@<OUT> util check_for_server_upgrade help
 NAME
@@ -43,6 +55,8 @@ DESCRIPTION
       - targetVersion - version to which upgrade will be checked
         (default=8.0.13)
       - password - password for connection.
+      - threads - number of sessions used to run the checks in parallel
+        (default=1).
 
       The connection data may be specified in the following formats:
 
@@ -109,6 +123,113 @@ DESCRIPTION
       For additional information on connection data use \? connection.
 
 
+#@<OUT> util compare_table help
+NAME
+      compare_table - Compares contents of a table on multiple instances of
+                      MySQL Server, computing checksums of its chunks in
+                      parallel.
+
+SYNTAX
+      util.compare_table(schema, table, instances[, options])
+
+WHERE
+      schema: Name of the schema of the table
+      table: Name of the table to be compared
+      instances: List with connection data of at least two instances, the first
+                 one is the reference
+      options: Optional dictionary with options
+
+RETURNS
+       true if the table is the same on all instances.
+
+DESCRIPTION
+      Options dictionary:
+
+      - threads: int (default: 4) - number of parallel workers, each one has a
+        classic protocol session to every instance.
+      - rowsPerChunk: int (default: 100000) - approximate number of rows in a
+        single chunk.
+
+      The table is split into chunks on the ranges of its primary key. The
+      checksum of each chunk is computed by the server. The rows of a chunk are
+      fetched and compared only if its checksum differs from the one on the
+      first instance.
+
+      If connection data of an instance does not specify the user, the
+      credentials of the global session are used.
+
+      The instances should not be modified during the comparison, concurrent
+      changes may be reported as differences.
+
+EXCEPTIONS
+      Throws ArgumentError when:
+
+      - Option name is invalid
+      - Less than two instances are given
+
+      Throws RuntimeError when:
+
+      - The table does not exist or has different columns on one of the
+        instances
+      - The table does not have a primary key
+      - MySQL Server returns an error
+
+
+#@<OUT> util dump_schemas help
+NAME
+      dump_schemas - Dumps schemas from MySQL Server to a directory, reading
+                     table data in parallel using classic protocol sessions.
+
+SYNTAX
+      util.dump_schemas(schemas, outputDir[, options])
+
+WHERE
+      schemas: List of schemas to be dumped
+      outputDir: Path to the directory where the dump is written, it must not
+                 exist or be empty
+
+DESCRIPTION
+      Options dictionary:
+
+      - tables: array of strings - only these tables are dumped, requires a
+        single schema.
+      - threads: int (default: 4) - number of classic protocol sessions used to
+        read data in parallel.
+      - rowsPerChunk: int (default: 250000) - approximate number of rows in a
+        single data file.
+      - compression: string (default: "gzip") - compression of the data files,
+        "gzip" or "none".
+      - consistent: bool (default: true) - all data is read from the same
+        consistent snapshot, a global read lock is held while the snapshot is
+        being created.
+
+      Tables which have a primary key are split into chunks on its ranges, other
+      tables are dumped to a single file. Views, routines, triggers and events
+      are not dumped.
+
+      The directory holds a <schema>.sql file with DDL of each schema and its
+      tables, a <schema>@<table>.json file with metadata of each table and its
+      data in the <schema>@<table>@<chunk>.tsv files, which can be loaded using
+      util.importTable() with the default dialect. The @.json file is written
+      once the dump is complete.
+
+EXCEPTIONS
+      Throws ArgumentError when:
+
+      - Option name is invalid
+      - No schemas are given or tables are given for multiple schemas
+
+      Throws LogicError when:
+
+      - Output path is not a directory or the directory is not empty
+
+      Throws RuntimeError when:
+
+      - Shell is not connected to MySQL Server using classic protocol
+      - The schema or the table does not exist
+      - MySQL Server returns an error
+
+
 #@<OUT> util import_json help
 NAME
       import_json - Import JSON documents from file to collection or table in
@@ -132,6 +253,8 @@ DESCRIPTION
         where the imported JSON documents will be stored.
       - convertBsonOid: bool (default: false) - enable BSON ObjectId type
         conversion in strict representation of MongoDB Extended JSON
+      - threads: int (default: 1) - number of X Protocol sessions used to
+        import documents in parallel.
 
       If the schema is not provided, an active schema on the global session, if
       set, will be used.
@@ -169,3 +292,71 @@ EXCEPTIONS
 
       - JSON document is ill-formed
 
+
+#@<OUT> util import_table help
+NAME
+      import_table - Import a delimited file to table in MySQL Server using
+                     classic protocol sessions in parallel.
+
+SYNTAX
+      util.import_table(file, options)
+
+WHERE
+      file: Path to the delimited file
+      options: Dictionary with options
+
+DESCRIPTION
+      Options dictionary:
+
+      - schema: string - name of target schema.
+      - table: string - name of table where the data will be imported.
+      - columns: array of strings - columns which receive the fields of each
+        row, all columns of the table by default.
+      - dialect: string (default: "default") - format of the file, one of
+        "default", "csv", "tsv" or "csv-unix", sets the defaults of the field
+        and line options.
+      - fieldsTerminatedBy: string (default: "\t") - string which separates the
+        fields.
+      - fieldsEnclosedBy: char (default: '') - character which encloses the
+        fields.
+      - fieldsOptionallyEnclosed: bool (default: false) - only fields of string
+        types are enclosed.
+      - fieldsEscapedBy: char (default: '\') - character which escapes the
+        special characters.
+      - linesTerminatedBy: string (default: "\n") - string which terminates the
+        rows.
+      - replaceDuplicates: bool (default: false) - rows which duplicate an
+        existing row on a unique key replace it, they are skipped otherwise.
+      - skipRows: int (default: 0) - number of rows skipped at the beginning of
+        the file.
+      - threads: int (default: 8) - number of classic protocol sessions used to
+        import data in parallel.
+      - bytesPerChunk: int (default: 52428800) - approximate size of the data
+        loaded by a single LOAD DATA statement.
+
+      If the schema is not provided, an active schema on the global session, if
+      set, will be used. If the table is not provided, the basename of the file
+      without extension will be used as target table name.
+
+      The file is split into chunks which end at row boundaries, each chunk is
+      sent using LOAD DATA LOCAL INFILE statement, which requires the
+      local_infile server variable to be enabled. The target table has to
+      exist.
+
+EXCEPTIONS
+      Throws ArgumentError when:
+
+      - Option name is invalid
+      - Dialect or field and line options are invalid
+
+      Throws LogicError when:
+
+      - Path to the file does not exists or is not a file
+
+      Throws RuntimeError when:
+
+      - Shell is not connected to MySQL Server using classic protocol
+      - Schema is not provided and there is no active schema on the global
+        session
+      - MySQL Server returns an error
+
@@ -132,6 +132,8 @@ class Shell_cmdline_options : public tests::Shell_base_test {
       return AS__STRING(options->trace_protocol);
     else if (option == "log_level")
       return AS__STRING(options->log_level);
+    else if (option == "log_async")
+      return AS__STRING(options->log_async);
     else if (option == "initial-mode")
       return shell_mode_name(options->initial_mode);
     else if (option == "session-type")
@@ -769,6 +771,8 @@ TEST_F(Shell_cmdline_options, app) {
                          IS_NULLABLE, "output_format", "json");
   test_option_with_value("json", "", "raw", "json", !IS_CONNECTION_DATA,
                          IS_NULLABLE, "output_format", "json/raw");
+  test_option_with_value("json", "", "ndjson", "json", !IS_CONNECTION_DATA,
+                         IS_NULLABLE, "output_format", "ndjson");
   test_option_with_no_value("--json", "output_format", "json");
   test_option_with_no_value("--table", "output_format", "table");
   test_option_with_no_value("--tabbed", "output_format", "tabbed");
@@ -788,6 +792,7 @@ TEST_F(Shell_cmdline_options, app) {
 
   test_option_with_no_value("--passwords-from-stdin", "passwords_from_stdin",
                             "1");
+  test_option_with_no_value("--log-async", "log_async", "1");
 
   test_option_with_value("file", "f", "/some/file", "", !IS_CONNECTION_DATA,
                          !IS_NULLABLE, "run_file");
@@ -567,6 +567,71 @@ TEST(Parsing, Array) {
   EXPECT_EQ(array2->size(), 0);
 }
 
+TEST(Parsing, Json) {
+  const std::string data =
+      "{\"int\": -450, \"uint\": 18446744073709551615, \"double\": 450.3, "
+      "\"string\": \"a \\\"quoted\\\" \\u0161tring\\n\", "
+      "\"array\": [1, [], {}, true, false, null], "
+      "\"nested\": {\"key\": \"value\"}}";
+
+  // both the copying and the in-situ parsers
+  for (const auto &v :
+       {shcore::Value::parse_json(data),
+        shcore::Value::parse_json(std::string(data))}) {
+    EXPECT_EQ(shcore::Map, v.type);
+
+    Value::Map_type_ref map = v.as_map();
+    EXPECT_EQ(6, map->size());
+
+    EXPECT_EQ(shcore::Integer, (*map)["int"].type);
+    EXPECT_EQ(-450, (*map)["int"].as_int());
+
+    EXPECT_EQ(shcore::UInteger, (*map)["uint"].type);
+    EXPECT_EQ(18446744073709551615ULL, (*map)["uint"].as_uint());
+
+    EXPECT_EQ(shcore::Float, (*map)["double"].type);
+    EXPECT_EQ(450.3, (*map)["double"].as_double());
+
+    EXPECT_EQ(shcore::String, (*map)["string"].type);
+    EXPECT_EQ("a \"quoted\" \xc5\xa1tring\n", (*map)["string"].get_string());
+
+    EXPECT_EQ(shcore::Array, (*map)["array"].type);
+    Value::Array_type_ref array = (*map)["array"].as_array();
+    EXPECT_EQ(6, array->size());
+    EXPECT_EQ(1, (*array)[0].as_int());
+    EXPECT_EQ(shcore::Array, (*array)[1].type);
+    EXPECT_TRUE((*array)[1].as_array()->empty());
+    EXPECT_EQ(shcore::Map, (*array)[2].type);
+    EXPECT_TRUE((*array)[2].as_map()->empty());
+    EXPECT_TRUE((*array)[3].as_bool());
+    EXPECT_FALSE((*array)[4].as_bool());
+    EXPECT_EQ(shcore::Null, (*array)[5].type);
+
+    EXPECT_EQ(shcore::Map, (*map)["nested"].type);
+    EXPECT_EQ("value", (*map)["nested"].as_map()->get_string("key"));
+
+    // same result as the repr() parser for a document it handles
+    map->erase("uint");
+    EXPECT_EQ(v, shcore::Value::parse(v.repr()));
+  }
+
+  EXPECT_EQ("string", shcore::Value::parse_json("\"string\"").get_string());
+  EXPECT_EQ(shcore::Null, shcore::Value::parse_json(" null ").type);
+
+  // members are kept in key order, the last of repeated keys wins
+  EXPECT_EQ(
+      "{\"a\": 2, \"b\": 3, \"c\": 4}",
+      shcore::Value::parse_json("{\"c\": 4, \"b\": 1, \"a\": 2, \"b\": 3}")
+          .repr());
+
+  // strict JSON is required
+  EXPECT_THROW(shcore::Value::parse_json("{'a': 1}"), shcore::Exception);
+  EXPECT_THROW(shcore::Value::parse_json("[undefined]"), shcore::Exception);
+  EXPECT_THROW(shcore::Value::parse_json("{\"a\": 1} {}"), shcore::Exception);
+  EXPECT_THROW(shcore::Value::parse_json("[1, 2"), shcore::Exception);
+  EXPECT_THROW(shcore::Value::parse_json(""), shcore::Exception);
+}
+
 TEST(Argument_map, all) {
   {
     Argument_map args;
@@ -863,5 +928,41 @@ TEST(Types_repr, wrong_repr) {
                  shcore::Exception);
   }
 }
+
+TEST(ValueTests, MapCopyMemberToNewKey) {
+  // inserting a member moves the other ones, a copy of a member must be
+  // taken before a new key is added
+  const std::string password(64, 'x');
+
+  {
+    Value::Map_type map;
+    map["password"] = Value(password);
+    map["user"] = Value("root");
+
+    const auto value = map.at("password");
+    map["passwd"] = value;
+
+    EXPECT_EQ(password, map.get_string("passwd"));
+    EXPECT_EQ(password, map.get_string("password"));
+    EXPECT_EQ("root", map.get_string("user"));
+  }
+
+  {
+    Value::Map_type map;
+    map["password"] = Value(password);
+
+    // set() takes a copy, so a member of the same map can be passed
+    for (int i = 0; i < 32; ++i) {
+      map.set("a" + std::to_string(i), map.at("password"));
+    }
+
+    map.set("passwd", map.at("password"));
+
+    EXPECT_EQ(34u, map.size());
+    EXPECT_EQ(password, map.get_string("passwd"));
+    EXPECT_EQ(password, map.get_string("password"));
+    EXPECT_EQ(password, map.get_string("a31"));
+  }
+}
 }  // namespace tests
 }  // namespace shcore
@@ -31,6 +31,7 @@
 #include "scripting/common.h"
 #include "scripting/jscript_context.h"
 #include "scripting/lang_base.h"
+#include "scripting/obj_date.h"
 #include "scripting/object_registry.h"
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
@@ -241,6 +242,26 @@ TEST_F(JavaScript, simple_to_js_and_back) {
         env.js->v8_value_to_shcore_value(env.js->shcore_value_to_v8_value(v)),
         v);
   }
+  {
+    // embedded NULs are kept
+    shcore::Value v(Value(std::string("hello\0world", 11)));
+    ASSERT_EQ(
+        env.js->v8_value_to_shcore_value(env.js->shcore_value_to_v8_value(v)),
+        v);
+  }
+  {
+    // long ASCII strings are passed as external strings
+    shcore::Value v(Value(std::string(4096, 'x')));
+    ASSERT_EQ(
+        env.js->v8_value_to_shcore_value(env.js->shcore_value_to_v8_value(v)),
+        v);
+  }
+  {
+    shcore::Value v(Value(std::string(4096, 'x') + "\xc5\xa1"));
+    ASSERT_EQ(
+        env.js->v8_value_to_shcore_value(env.js->shcore_value_to_v8_value(v)),
+        v);
+  }
   {
     shcore::Value v(Value(123.45));
     ASSERT_EQ(
@@ -490,5 +511,23 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 00:00:00\"", object.repr());
 }
+
+TEST_F(JavaScript, date_to_js_and_back) {
+  v8::Isolate::Scope isolate_scope(env.js->isolate());
+  v8::HandleScope handle_scope(env.js->isolate());
+  v8::TryCatch try_catch;
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(env.js->isolate(), env.js->context()));
+
+  for (const auto &date :
+       {Value(Object_bridge_ref(new Date(2014, 1, 1, 0, 0, 0, 0))),
+        Value(Object_bridge_ref(new Date(2018, 7, 21, 13, 45, 10, 250000))),
+        Value(Object_bridge_ref(new Date(1901, 12, 31, 23, 59, 59, 0)))}) {
+    v8::Handle<v8::Value> js_date = env.js->shcore_value_to_v8_value(date);
+
+    ASSERT_TRUE(js_date->IsDate());
+    ASSERT_EQ(date.repr(), env.js->v8_value_to_shcore_value(js_date).repr());
+  }
+}
 }  // namespace tests
 }  // namespace shcore